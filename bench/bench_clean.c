@@ -0,0 +1,84 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <html/html_parser.h>
+
+//
+// Bench_BuildIndentedDocument
+// -----
+// Builds a document of roughly target_size bytes made of
+// nested <div>s, each line indented one step deeper than
+// the last, which is the worst case for whitespace cleaning.
+//
+static char* Bench_BuildIndentedDocument(size_t target_size, size_t* out_length)
+{
+    char* doc = malloc(target_size + 256);
+    size_t len = 0;
+    int depth = 0;
+
+    while (len < target_size) {
+        // Wrap back around so lines don't grow forever.
+        if (depth > 64)
+            depth = 0;
+
+        size_t indent = depth * 4;
+        if (len + indent + 64 > target_size)
+            break;
+
+        memset(&doc[len], ' ', indent);
+        len += indent;
+        len += sprintf(&doc[len], "<div class=\"row\">  some   text  </div>\n");
+        depth++;
+    }
+
+    doc[len] = '\0';
+    *out_length = len;
+    return doc;
+}
+
+static double Bench_Seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[])
+{
+    printf("%10s %12s %12s %10s %10s\n", "size", "saved", "seconds", "MB/s", "ns/byte");
+
+    for (size_t size = 1 << 20; size <= 16 << 20; size <<= 1) {
+        size_t length;
+        char* doc = Bench_BuildIndentedDocument(size, &length);
+
+        html_cleaner_t cleaner = {0};
+        double start = Bench_Seconds();
+        HTML_CleanDocument(doc, length, &cleaner);
+        double elapsed = Bench_Seconds() - start;
+
+        printf("%10zu %12zu %12.6f %10.1f %10.3f\n", length, cleaner.bytes_saved,
+            elapsed, (length / (1024.0 * 1024.0)) / elapsed, (elapsed * 1e9) / length);
+
+        free(doc);
+    }
+
+    return 0;
+}
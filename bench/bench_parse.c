@@ -0,0 +1,375 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <scan.h>
+#include <diag.h>
+#include <prtcl/protocol.h>
+#include <html/html_parser.h>
+#include <html/html_cache.h>
+#include <html/html_charset.h>
+
+// Every phase is run this many times, the fastest counts.
+#define BENCH_ROUNDS    5
+
+// Single character edits timed on each parsed document.
+#define BENCH_EDITS     64
+
+//
+// Shape of a generated document. Each knob maps to one of
+// the things that makes real pages slow to parse.
+//
+typedef struct {
+    const char*     name;
+    size_t          size;           // Approximate size in bytes.
+    int             depth;          // How deep elements nest before unwinding.
+    int             attributes;     // Attributes on each start tag.
+    int             comment_pct;    // Percentage of blocks that are comments.
+    int             script_pct;     // Percentage of blocks that are inline scripts.
+} bench_corpus_t;
+
+static const bench_corpus_t bench_corpora[] = {
+    { "text",       1 << 20,    2,  0,  0,  0  },
+    { "text",       8 << 20,    2,  0,  0,  0  },
+    { "nested",     1 << 20,    48, 1,  0,  0  },
+    { "nested",     8 << 20,    48, 1,  0,  0  },
+    { "attributes", 1 << 20,    4,  6,  0,  0  },
+    { "attributes", 8 << 20,    4,  6,  0,  0  },
+    { "comments",   1 << 20,    4,  1,  40, 0  },
+    { "comments",   8 << 20,    4,  1,  40, 0  },
+    { "scripts",    1 << 20,    4,  1,  0,  40 },
+    { "scripts",    8 << 20,    4,  1,  0,  40 },
+    { "mixed",      1 << 20,    16, 3,  10, 0  },
+    { "mixed",      8 << 20,    16, 3,  10, 0  },
+};
+
+// Attributes to sprinkle on tags, with values that go
+// through each of the main value parsers.
+static const char* bench_attributes[] = {
+    "class=\"row item\"",
+    "id=\"section-12\"",
+    "style=\"color: red; margin-left: 4em;\"",
+    "width=\"50%\"",
+    "bgcolor=\"#FF8800\"",
+    "align=\"center\"",
+    "href=\"https://example.com/some/page.html\"",
+    "title=\"A short description\"",
+};
+
+// Inline script, heavy on the '<'s that used to be taken
+// for tags.
+static const char* bench_script_lines[] = {
+    "for (var i = 0; i < items.length; i++) {",
+    "    if (items[i].width < 640 && items[i].height > 0)",
+    "        html += '<li class=\"item\">' + items[i].name + '</li>';",
+    "}",
+    "document.getElementById('list').innerHTML = '<ul>' + html + '</ul>';",
+};
+
+static const char* bench_words[] = {
+    "lorem", "ipsum", "dolor", "sit", "amet", "consectetur",
+    "adipiscing", "elit", "sed", "do", "eiusmod", "tempor",
+};
+
+#define BENCH_COUNT(a)  (sizeof(a) / sizeof((a)[0]))
+
+//
+// Bench_GenerateDocument
+// -----
+// Builds a document to the given corpus' specifications.
+// The same corpus always produces the same document.
+//
+static char* Bench_GenerateDocument(const bench_corpus_t* corpus, size_t* out_length)
+{
+    size_t capacity = corpus->size + 4096;
+    char* doc = malloc(capacity);
+    size_t len = 0;
+    unsigned int seed = 1;
+    int depth = 0;
+
+    len += sprintf(&doc[len], "<!DOCTYPE html>\n<html>\n<body>\n");
+
+    while (len + 1024 < corpus->size) {
+        seed = seed * 1103515245 + 12345;
+
+        // Unwind once we're as deep as we're allowed.
+        if (depth >= corpus->depth) {
+            while (depth > 0) {
+                len += sprintf(&doc[len], "%*s</div>\n", depth * 2, "");
+                depth--;
+            }
+        }
+
+        if ((int)((seed >> 16) % 100) < corpus->comment_pct) {
+            len += sprintf(&doc[len], "%*s<!-- generated comment, "
+                "nothing to see here -- keep going -->\n", depth * 2, "");
+            continue;
+        }
+
+        if ((int)((seed >> 8) % 100) < corpus->script_pct) {
+            len += sprintf(&doc[len], "%*s<script type=\"text/javascript\">\n", depth * 2, "");
+            for (int i = 0; i < 4; i++) {
+                for (size_t l = 0; l < BENCH_COUNT(bench_script_lines); l++)
+                    len += sprintf(&doc[len], "%*s%s\n", depth * 2, "", bench_script_lines[l]);
+            }
+            len += sprintf(&doc[len], "%*s</script>\n", depth * 2, "");
+            continue;
+        }
+
+        len += sprintf(&doc[len], "%*s<div", depth * 2, "");
+        for (int i = 0; i < corpus->attributes; i++)
+            len += sprintf(&doc[len], " %s", bench_attributes[(seed + i) % BENCH_COUNT(bench_attributes)]);
+        len += sprintf(&doc[len], ">\n");
+        depth++;
+
+        len += sprintf(&doc[len], "%*s<p>", depth * 2, "");
+        for (int i = 0; i < 40; i++)
+            len += sprintf(&doc[len], "%s ", bench_words[(seed >> (i % 16)) % BENCH_COUNT(bench_words)]);
+        len += sprintf(&doc[len], "<em>emphasis</em> end.</p>\n");
+    }
+
+    while (depth > 0) {
+        len += sprintf(&doc[len], "%*s</div>\n", depth * 2, "");
+        depth--;
+    }
+
+    len += sprintf(&doc[len], "</body>\n</html>\n");
+
+    *out_length = len;
+    return doc;
+}
+
+static double Bench_Seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//
+// Bench_Tokenize
+// -----
+// Runs the tokenizer just like HTML_ParseMarkup does,
+// optionally parsing attributes, but never builds a tree.
+// Returns the number of tags seen.
+//
+static size_t Bench_Tokenize(html_document_t* document, char* data, size_t length, bool attributes)
+{
+    static html_token_t tokens[HTML_TOKEN_BATCH];
+    static attribute_t values[HTML_TOKEN_BATCH];
+    html_tokenstate_t state;
+    size_t tags = 0;
+    size_t count;
+
+    HTML_BeginTokens(&state, document, data, length, 0, length);
+    state.parse_attributes = attributes;
+
+    while ((count = HTML_NextTokens(&state, tokens, values, HTML_TOKEN_BATCH)) > 0) {
+        for (size_t i = 0; i < count; i++)
+            tags += (tokens[i].type == HTML_TOKEN_START || tokens[i].type == HTML_TOKEN_END);
+    }
+
+    return tags;
+}
+
+typedef struct {
+    double          retrieve;
+    double          decode;         // Sniffing the charset and checking the UTF-8.
+    double          clean;
+    double          tokenize;
+    double          attributes;
+    double          tree;
+    double          edit;           // Per edit, not the whole batch.
+    double          cache_load;     // Mapping the parsed tree back in from the cache.
+    size_t          tags;
+    size_t          nodes;
+    size_t          allocations;
+    size_t          arena_bytes;
+} bench_result_t;
+
+#define BENCH_BEST(best, elapsed)   { if ((elapsed) < (best)) (best) = (elapsed); }
+
+//
+// Bench_RunCorpus
+// -----
+// Times each phase of the pipeline on one document. Phases
+// that can't run on their own are measured by difference:
+// attribute parsing is tokenizing with attributes minus
+// tokenizing without, and tree building is the full parse
+// minus tokenizing with attributes.
+//
+static bench_result_t Bench_RunCorpus(const bench_corpus_t* corpus, size_t* out_length)
+{
+    bench_result_t result = {1e9, 1e9, 1e9, 1e9, 1e9, 1e9, 1e9, 1e9, 0, 0, 0, 0};
+    double tokenize_attrs = 1e9;
+    double full = 1e9;
+
+    size_t length;
+    char* source = Bench_GenerateDocument(corpus, &length);
+    char* work = malloc(length + 1);
+    *out_length = length;
+
+    // Retrieval goes through a real file, so write one out.
+    char path[] = "/tmp/pantomime_benchXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0 || write(fd, source, length) != (ssize_t)length) {
+        printf("Bench_RunCorpus: Couldn't write temporary file %s\n", path);
+        exit(1);
+    }
+    close(fd);
+
+    char uri[64];
+    snprintf(uri, sizeof(uri), "file://%s", path);
+
+    char cache_dir[] = "/tmp/pantomime_cacheXXXXXX";
+    if (mkdtemp(cache_dir) == NULL) {
+        printf("Bench_RunCorpus: Couldn't make cache directory %s\n", cache_dir);
+        exit(1);
+    }
+
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        double start = Bench_Seconds();
+        prtcl_document_t* retrieved = PRTCL_RetrieveDocument(uri);
+        BENCH_BEST(result.retrieve, Bench_Seconds() - start);
+
+        html_input_t input;
+        start = Bench_Seconds();
+        HTML_DecodeInput(&input, retrieved->data, retrieved->length);
+        BENCH_BEST(result.decode, Bench_Seconds() - start);
+        HTML_FreeInput(&input);
+        PRTCL_ReleaseDocument(retrieved);
+
+        memcpy(work, source, length + 1);
+        html_cleaner_t cleaner = {0};
+        start = Bench_Seconds();
+        size_t cleaned = HTML_CleanDocument(work, length, &cleaner);
+        BENCH_BEST(result.clean, Bench_Seconds() - start);
+
+        // Everything from here on parses the cleaned copy,
+        // which is what the parser sees for real.
+        html_document_t* document = HTML_CreateDocument();
+        start = Bench_Seconds();
+        result.tags = Bench_Tokenize(document, work, cleaned, false);
+        BENCH_BEST(result.tokenize, Bench_Seconds() - start);
+        HTML_FreeDocument(document);
+
+        document = HTML_CreateDocument();
+        start = Bench_Seconds();
+        Bench_Tokenize(document, work, cleaned, true);
+        BENCH_BEST(tokenize_attrs, Bench_Seconds() - start);
+        HTML_FreeDocument(document);
+
+        document = HTML_CreateDocument();
+        start = Bench_Seconds();
+        HTML_ParseMarkup(document, work, cleaned);
+        BENCH_BEST(full, Bench_Seconds() - start);
+
+        result.nodes = document->node_count;
+        result.allocations = document->arena->allocations;
+        result.arena_bytes = document->arena->bytes;
+        document->source = work;
+        document->source_len = cleaned;
+
+        // A warm start: the same document again, straight
+        // from the parse cache.
+        if (round == 0)
+            HTML_SaveCache(document, cache_dir, 0, length);
+
+        html_document_t* cached = HTML_CreateDocument();
+        start = Bench_Seconds();
+        HTML_LoadCache(cached, cache_dir, 0, length);
+        BENCH_BEST(result.cache_load, Bench_Seconds() - start);
+        HTML_FreeDocument(cached);
+
+        // Typing into the parsed document, a character at a
+        // time at spots spread all through it.
+        start = Bench_Seconds();
+        for (int e = 0; e < BENCH_EDITS; e++) {
+            html_edit_t edit = { (cleaned / BENCH_EDITS) * e + cleaned / (2 * BENCH_EDITS), 0, "x", 1 };
+            HTML_ReparseEdit(document, &edit);
+        }
+        BENCH_BEST(result.edit, (Bench_Seconds() - start) / BENCH_EDITS);
+        HTML_FreeDocument(document);
+    }
+
+    result.attributes = tokenize_attrs > result.tokenize ? tokenize_attrs - result.tokenize : 0;
+    result.tree = full > tokenize_attrs ? full - tokenize_attrs : 0;
+
+    char cache_path[128];
+    snprintf(cache_path, sizeof(cache_path), "%s/%016llx.tree", cache_dir, 0ULL);
+    unlink(cache_path);
+    rmdir(cache_dir);
+
+    unlink(path);
+    free(work);
+    free(source);
+
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    // Printing the parser's diagnostics would drown out the
+    // results and skew the timings, so they're only counted.
+    // The JSON can still go to its own file if asked.
+    Diag_SetSink(NULL, NULL);
+
+    FILE* out = stdout;
+    if (argc > 1) {
+        out = fopen(argv[1], "w");
+        if (out == NULL) {
+            printf("bench_parse: Couldn't open %s for writing\n", argv[1]);
+            return 1;
+        }
+    }
+
+    fprintf(out, "{\n  \"scanner\": \"%s\",\n  \"rounds\": %d,\n  \"results\": [\n",
+        Scan_Implementation(), BENCH_ROUNDS);
+
+    for (size_t i = 0; i < BENCH_COUNT(bench_corpora); i++) {
+        const bench_corpus_t* corpus = &bench_corpora[i];
+        size_t length;
+        bench_result_t r = Bench_RunCorpus(corpus, &length);
+
+        double mb = length / (1024.0 * 1024.0);
+        double parse = r.clean + r.tokenize + r.attributes + r.tree;
+
+        fprintf(out, "    {\"corpus\": \"%s\", \"bytes\": %zu, \"depth\": %d, "
+            "\"attributes\": %d, \"comment_pct\": %d, \"script_pct\": %d,\n", corpus->name, 
+            length, corpus->depth, corpus->attributes, corpus->comment_pct, corpus->script_pct);
+        fprintf(out, "     \"seconds\": {\"retrieve\": %.6f, \"decode\": %.6f, \"clean\": %.6f, "
+            "\"tokenize\": %.6f, \"attributes\": %.6f, \"tree\": %.6f, \"edit\": %.6f, "
+            "\"cache_load\": %.6f},\n",
+            r.retrieve, r.decode, r.clean, r.tokenize, r.attributes, r.tree, r.edit, r.cache_load);
+        fprintf(out, "     \"mb_per_sec\": %.1f, \"tags\": %zu, \"tags_per_sec\": %.0f, "
+            "\"nodes\": %zu, \"allocations\": %zu, \"arena_bytes\": %zu}%s\n",
+            mb / parse, r.tags, r.tags / parse, r.nodes, r.allocations, r.arena_bytes,
+            i + 1 < BENCH_COUNT(bench_corpora) ? "," : "");
+    }
+
+    fprintf(out, "  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+#ifndef _ARENA_H_
+#define _ARENA_H_
+
+#include <stddef.h>
+
+#include "types.h"
+
+// Default size of each block the arena hands memory out of.
+#define ARENA_BLOCK_LEN     65536
+
+// Every allocation is aligned to this.
+#define ARENA_ALIGN         16
+
+typedef struct arena_block_s {
+    struct arena_block_s*   next;       // Previously filled block.
+    size_t                  size;       // Usable bytes in this block.
+    size_t                  used;       // Bytes handed out so far.
+} arena_block_t;
+
+typedef struct {
+    arena_block_t*          head;       // Block currently being allocated from.
+    size_t                  block_size; // Size of newly created blocks.
+    size_t                  allocations;// Number of Arena_Alloc calls.
+    size_t                  bytes;      // Bytes handed out, including padding.
+} arena_t;
+
+extern arena_t* Arena_Create(size_t block_size);
+extern void* Arena_Alloc(arena_t* arena, size_t size);
+extern char* Arena_StringFromChunk(arena_t* arena, const char* str, size_t len);
+extern void Arena_Adopt(arena_t* arena, arena_t* other);
+extern void Arena_Reset(arena_t* arena);
+extern void Arena_Destroy(arena_t* arena);
+
+#endif // _ARENA_H_
@@ -0,0 +1,25 @@
+#ifndef _BATCH_H_
+#define _BATCH_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+// Workers used when the count isn't given.
+#define BATCH_DEFAULT_THREADS   4
+
+// Most workers a batch will start.
+#define BATCH_MAX_THREADS       256
+
+typedef struct {
+    char**                  uris;
+    size_t                  count;
+    size_t                  capacity;
+} batch_list_t;
+
+extern void Batch_InitList(batch_list_t* list);
+extern void Batch_AddURI(batch_list_t* list, const char* uri);
+extern void Batch_ReadList(batch_list_t* list, FILE* file);
+extern void Batch_FreeList(batch_list_t* list);
+extern int Batch_Run(batch_list_t* list, int threads, const char* cache_dir);
+
+#endif // _BATCH_H_
@@ -0,0 +1,55 @@
+#ifndef _DIAG_H_
+#define _DIAG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+// Kinds of diagnostic.
+#define DIAG_UNKNOWN_ELEMENT        0
+#define DIAG_UNKNOWN_ATTRIBUTE      1
+#define DIAG_DUPLICATE_ATTRIBUTE    2
+#define DIAG_BAD_VALUE              3
+#define DIAG_CACHE                  4
+#define DIAG_EDIT                   5
+#define DIAG_CHARSET                6
+#define DIAG_TOO_LARGE              7
+#define DIAG_KINDS                  8
+
+// Longest message kept, longer ones are cut short.
+#define DIAG_MESSAGE_LEN            256
+
+typedef struct {
+    int                     kind;       // DIAG_*
+    const char*             source;     // Function that reported it.
+    char                    message[DIAG_MESSAGE_LEN];
+} diag_t;
+
+// Receives each diagnostic as it's reported.
+typedef void (*diag_sink_t)(void* context, const diag_t* diag);
+
+//
+// Keeps the most recent diagnostics, dropping the oldest
+// once it's full. Safe to report into from many threads.
+//
+typedef struct {
+    diag_t*                 entries;
+    uint32_t                capacity;
+    uint64_t                written;    // Every diagnostic ever added, kept or not.
+    pthread_mutex_t         lock;
+} diag_ring_t;
+
+extern void Diag_SetSink(diag_sink_t sink, void* context);
+extern void Diag_Report(int kind, const char* source, const char* format, ...)
+    __attribute__((format(printf, 3, 4)));
+extern uint64_t Diag_Count(int kind);
+extern const char* Diag_KindName(int kind);
+extern void Diag_PrintSink(void* context, const diag_t* diag);
+
+extern void Diag_InitRing(diag_ring_t* ring, uint32_t capacity);
+extern void Diag_RingSink(void* context, const diag_t* diag);
+extern size_t Diag_ReadRing(diag_ring_t* ring, diag_t* out, size_t max);
+extern void Diag_FreeRing(diag_ring_t* ring);
+
+#endif // _DIAG_H_
@@ -1,267 +1,97 @@
 #ifndef _HTML_ATTRPARSE_H_
 #define _HTML_ATTRPARSE_H_
 
+#include <stddef.h>
+
+#include "util.h"
+#include "diag.h"
+#include "arena.h"
 #include "html_datatype.h"
+#include "html_document.h"
 
-extern void HTML_ParseAttributeContent(char* html_data, char* attribute_name, bool has_value,
-                                        attribute_t* attributes, int* offset);
+extern void HTML_AddAttribute(html_document_t* document, attribute_t* attributes, 
+                                slice_t name, slice_t value);
 
 //
 // Macros for attribute assigning
 //
 
-#define COLOR_FROM_NAME(compare, name, red, green, blue, location, res) { \
-    if (res == 0 && strcasecmp(compare, name) == 0) { \
-        res = 1; \
-        location.r = red; \
-        location.g = green; \
-        location.b = blue; \
-    } \
-} \
-
-#define GEN_FROM_VALUE(compare, value, ret, location, res) { \
-    if (res == 0 && strcasecmp(compare, value) == 0) { \
-        res = 1; \
-        location = ret; \
-    } \
+// Entry in an enumerated attribute's table of values.
+typedef struct {
+    const char*             name;       // Lowercase.
+    byte                    len;
+    int                     value;
+} html_enumvalue_t;
+
+#define ENUM_VALUE(name, value)     { name, sizeof(name) - 1, value }
+#define ENUM_VALUE_COUNT(table)     (sizeof(table) / sizeof((table)[0]))
+
+// Entry in the generated content type table.
+typedef struct {
+    const char*             name;       // Lowercase "major/minor".
+    byte                    len;
+    contenttypes_t          type;
+} html_contenttype_t;
+
+// Entry in the generated named color table.
+typedef struct {
+    const char*             name;       // Lowercase.
+    byte                    len;
+    byte                    r;
+    byte                    g;
+    byte                    b;
+} html_namedcolor_t;
+
+#define ATTR_DUPE_REPORT(attr) { \
+    Diag_Report(DIAG_DUPLICATE_ATTRIBUTE, "HTML_AddAttribute", "Attribute '%.*s'" \
+    " already defined. Ignoring duplicate definition.", \
+    SLICE_ARGS(attr)); \
 } \
 
-#define ATTR_DUPE_PRINT(attr) { \
-    printf("HTML_ParseAttributeContent: Attribute '%s'" \
-    " already defined. Ignoring duplicate definition.\n", \
-    attr); \
-} \
-
-#define ASSIGN_TEXT_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != NULL) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseTextAttribute(content); \
-        } \
-    } \
-}
-
-#define ASSIGN_CSET_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != CS_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseCharsetsAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_CONT_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != CTYPE_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseContentTypesAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_CHAR_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != '\0') { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseContentTypesAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_ALGN_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != ALIGN_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseAlignAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_COLR_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location.used != false) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseColorAttribute(content);\
-            location.used = true;\
-        } \
-    } \
-}
-
-#define ASSIGN_PIXL_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != -1) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParsePixelsAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_LENG_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location.len != -1) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseLengthAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_CLER_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != CLEAR_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseClearAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_NUMB_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != -1) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseNumberAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_CORD_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location.x != -1) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseCoordsAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_TFRM_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != TF_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseTFrameAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_MTHD_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != METHOD_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseMethodAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_TRLE_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != TR_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseTRulesAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_SCOP_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != SCOPE_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseScopeAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_SCRL_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != SCROLL_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseScrollAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_SHPE_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != SHAPE_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseShapeAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_STYL_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != NULL) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseStyleSheetAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_VALN_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != VA_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseVAlignAttribute(content);\
-        } \
-    } \
-}
-
-#define ASSIGN_VALT_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != VT_NONE) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = HTML_ParseValueTypeAttribute(content);\
-        } \
-    } \
-}
+//
+// Attribute name dispatch
+//
 
-#define ASSIGN_BOOL_ATTR(compare, string, location, content, res) { \
-    if (strcasecmp(compare, string) == 0) { \
-        res = 1; \
-        if (location != false) { \
-            ATTR_DUPE_PRINT(compare); \
-        } else { \
-            location = true;\
-        } \
-    } \
+// Parses an attribute value into its slot in the
+// element's attribute storage.
+typedef void (*html_attrassign_t)(html_document_t* document, attrvalue_t* slot, slice_t value);
+
+// Entry in the generated attribute name table.
+typedef struct {
+    const char*             name;
+    byte                    len;
+    byte                    id;         // HTML_ATTR_* ID of the attribute.
+    html_attrassign_t       assign;     // Parser for the attribute's value type.
+} html_attrname_t;
+
+extern const html_attrname_t* HTML_LookupAttributeName(const char* name, size_t len);
+extern const char* HTML_GetAttributeStringFromID(byte id);
+extern void HTML_FindAtomAttributes(uint64_t* atoms);
+extern void HTML_FindTextAttributes(uint64_t* text);
+extern charsets_t HTML_LookupCharset(slice_t label);
+extern charsets_t HTML_ParseCharsetsAttribute(slice_t value);
+extern contenttype_t HTML_ParseContentTypesAttribute(slice_t value);
+extern color_t HTML_ParseColorAttribute(slice_t value);
+
+extern length_t HTML_ParseLengthAttribute(slice_t value);
+extern size_t HTML_ParseMultiLengths(slice_t value, length_t* lengths, size_t max);
+extern int32_t HTML_ResolveLength(html_document_t* document, length_t length,
+                                    const lengthcontext_t* context);
+
+// Defines an html_attrassign_t that stores the result of
+// the value parser in the given member of the slot.
+#define ATTR_ASSIGN_FUNC(func, member, parser) \
+static void func(html_document_t* document, attrvalue_t* slot, slice_t value) \
+{ \
+    slot->member = parser(value); \
+}
+
+// Same as above, for value parsers that need to allocate
+// from the document's arena.
+#define ATTR_ASSIGN_ALLOC_FUNC(func, member, parser) \
+static void func(html_document_t* document, attrvalue_t* slot, slice_t value) \
+{ \
+    slot->member = parser(document->arena, value); \
 }
 
 #endif // _HTML_ATTRPARSE_H_
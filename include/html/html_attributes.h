@@ -0,0 +1,115 @@
+#ifndef _HTMLATTR_H_
+#define _HTMLATTR_H_
+
+//
+// List of all supported attributes, HTML 4.01 plus a few
+// common extensions.
+// https://www.w3.org/TR/html4/index/attributes.html
+//
+#define     HTML_ATTR_ABBR             0
+#define     HTML_ATTR_ACCEPT_CHARSET   1
+#define     HTML_ATTR_ACCEPT           2
+#define     HTML_ATTR_ACCESSKEY        3
+#define     HTML_ATTR_ACTION           4
+#define     HTML_ATTR_ALIGN            5
+#define     HTML_ATTR_ALT              6
+#define     HTML_ATTR_ARCHIVE          7
+#define     HTML_ATTR_AXIS             8
+#define     HTML_ATTR_BACKGROUND       9
+#define     HTML_ATTR_BGCOLOR          10
+#define     HTML_ATTR_BORDER           11
+#define     HTML_ATTR_BOTTOMMARGIN     12
+#define     HTML_ATTR_CELLPADDING      13
+#define     HTML_ATTR_CELLSPACING      14
+#define     HTML_ATTR_CHAR             15
+#define     HTML_ATTR_CHAROFF          16
+#define     HTML_ATTR_CHARSET          17
+#define     HTML_ATTR_CHECKED          18
+#define     HTML_ATTR_CITE             19
+#define     HTML_ATTR_CLASS            20
+#define     HTML_ATTR_CLASSID          21
+#define     HTML_ATTR_CLEAR            22
+#define     HTML_ATTR_CODE             23
+#define     HTML_ATTR_CODEBASE         24
+#define     HTML_ATTR_CODETYPE         25
+#define     HTML_ATTR_COLOR            26
+#define     HTML_ATTR_COLS             27
+#define     HTML_ATTR_COLSPAN          28
+#define     HTML_ATTR_COMPACT          29
+#define     HTML_ATTR_CONTENT          30
+#define     HTML_ATTR_COORDS           31
+#define     HTML_ATTR_DATA             32
+#define     HTML_ATTR_DATETIME         33
+#define     HTML_ATTR_DECLARE          34
+#define     HTML_ATTR_DIR              35
+#define     HTML_ATTR_DISABLED         36
+#define     HTML_ATTR_ENCTYPE          37
+#define     HTML_ATTR_FACE             38
+#define     HTML_ATTR_FOR              39
+#define     HTML_ATTR_FRAME            40
+#define     HTML_ATTR_FRAMEBORDER      41
+#define     HTML_ATTR_HEADERS          42
+#define     HTML_ATTR_HEIGHT           43
+#define     HTML_ATTR_HREF             44
+#define     HTML_ATTR_HREFLANG         45
+#define     HTML_ATTR_HSPACE           46
+#define     HTML_ATTR_HTTP_EQUIV       47
+#define     HTML_ATTR_ID               48
+#define     HTML_ATTR_ISMAP            49
+#define     HTML_ATTR_LABEL            50
+#define     HTML_ATTR_LANG             51
+#define     HTML_ATTR_LANGUAGE         52
+#define     HTML_ATTR_LEFTMARGIN       53
+#define     HTML_ATTR_LINK             54
+#define     HTML_ATTR_LONGDESC         55
+#define     HTML_ATTR_MARGINHEIGHT     56
+#define     HTML_ATTR_MARGINWIDTH      57
+#define     HTML_ATTR_MAXLENGTH        58
+#define     HTML_ATTR_MEDIA            59
+#define     HTML_ATTR_METHOD           60
+#define     HTML_ATTR_MULTIPLE         61
+#define     HTML_ATTR_NAME             62
+#define     HTML_ATTR_NOHREF           63
+#define     HTML_ATTR_NORESIZE         64
+#define     HTML_ATTR_NOSHADE          65
+#define     HTML_ATTR_NOWRAP           66
+#define     HTML_ATTR_OBJECT           67
+#define     HTML_ATTR_PROFILE          68
+#define     HTML_ATTR_PROMPT           69
+#define     HTML_ATTR_READONLY         70
+#define     HTML_ATTR_REL              71
+#define     HTML_ATTR_REQUIRED         72
+#define     HTML_ATTR_RIGHTMARGIN      73
+#define     HTML_ATTR_ROWS             74
+#define     HTML_ATTR_ROWSPAN          75
+#define     HTML_ATTR_RULES            76
+#define     HTML_ATTR_SCHEME           77
+#define     HTML_ATTR_SCOPE            78
+#define     HTML_ATTR_SCROLLING        79
+#define     HTML_ATTR_SELECTED         80
+#define     HTML_ATTR_SHAPE            81
+#define     HTML_ATTR_SIZE             82
+#define     HTML_ATTR_SPAN             83
+#define     HTML_ATTR_SRC              84
+#define     HTML_ATTR_STANDBY          85
+#define     HTML_ATTR_START            86
+#define     HTML_ATTR_STYLE            87
+#define     HTML_ATTR_SUMMARY          88
+#define     HTML_ATTR_TABINDEX         89
+#define     HTML_ATTR_TARGET           90
+#define     HTML_ATTR_TEXT             91
+#define     HTML_ATTR_TITLE            92
+#define     HTML_ATTR_TOPMARGIN        93
+#define     HTML_ATTR_TYPE             94
+#define     HTML_ATTR_USEMAP           95
+#define     HTML_ATTR_VALIGN           96
+#define     HTML_ATTR_VALUE            97
+#define     HTML_ATTR_VALUETYPE        98
+#define     HTML_ATTR_VERSION          99
+#define     HTML_ATTR_VLINK            100
+#define     HTML_ATTR_VSPACE           101
+#define     HTML_ATTR_WIDTH            102
+#define     HTML_ATTR_COUNT            103
+#define     HTML_ATTR_ERROR            255
+
+#endif // _HTMLATTR_H_
@@ -0,0 +1,148 @@
+#ifndef _HTML_ATTRIBUTES_HASH_H_
+#define _HTML_ATTRIBUTES_HASH_H_
+
+// Generated by tools/gen_perfect_hash.py, do not edit by hand.
+#define HTML_ATTRIBUTES_SLOTS 128
+#define HTML_ATTRIBUTES_BUCKETS 64
+
+static const unsigned short html_attributes_displace[HTML_ATTRIBUTES_BUCKETS] = {
+    0, 2, 1, 1, 1, 12, 1, 0, 4, 1, 1, 1,
+    2, 2, 8, 0, 3, 0, 0, 2, 2, 3, 1, 1,
+    1, 0, 1, 2, 2, 3, 2, 6, 1, 1, 1, 0,
+    0, 5, 1, 1, 2, 4, 3, 3, 8, 0, 3, 3,
+    3, 0, 6, 1, 2, 4, 0, 2, 0, 13, 1, 4,
+    0, 13, 4, 1,
+};
+
+static const html_attrname_t html_attributes_table[HTML_ATTRIBUTES_SLOTS] = {
+    { "rules", 5, HTML_ATTR_RULES, HTML_AssignTRulesAttribute },
+    { "href", 4, HTML_ATTR_HREF, HTML_AssignTextAttribute },
+    { "standby", 7, HTML_ATTR_STANDBY, HTML_AssignTextAttribute },
+    { NULL, 0 },
+    { "name", 4, HTML_ATTR_NAME, HTML_AssignAtomAttribute },
+    { "summary", 7, HTML_ATTR_SUMMARY, HTML_AssignTextAttribute },
+    { "dir", 3, HTML_ATTR_DIR, HTML_AssignBoolAttribute },
+    { "frameborder", 11, HTML_ATTR_FRAMEBORDER, HTML_AssignBoolAttribute },
+    { "marginwidth", 11, HTML_ATTR_MARGINWIDTH, HTML_AssignPixelsAttribute },
+    { "accept-charset", 14, HTML_ATTR_ACCEPT_CHARSET, HTML_AssignCharsetsAttribute },
+    { NULL, 0 },
+    { "border", 6, HTML_ATTR_BORDER, HTML_AssignPixelsAttribute },
+    { "lang", 4, HTML_ATTR_LANG, HTML_AssignAtomAttribute },
+    { "version", 7, HTML_ATTR_VERSION, HTML_AssignTextAttribute },
+    { "accept", 6, HTML_ATTR_ACCEPT, HTML_AssignContentTypesAttribute },
+    { NULL, 0 },
+    { "required", 8, HTML_ATTR_REQUIRED, HTML_AssignBoolAttribute },
+    { "archive", 7, HTML_ATTR_ARCHIVE, HTML_AssignTextAttribute },
+    { "background", 10, HTML_ATTR_BACKGROUND, HTML_AssignTextAttribute },
+    { "span", 4, HTML_ATTR_SPAN, HTML_AssignNumberAttribute },
+    { "valuetype", 9, HTML_ATTR_VALUETYPE, HTML_AssignValueTypeAttribute },
+    { "width", 5, HTML_ATTR_WIDTH, HTML_AssignLengthAttribute },
+    { NULL, 0 },
+    { "id", 2, HTML_ATTR_ID, HTML_AssignAtomAttribute },
+    { "http-equiv", 10, HTML_ATTR_HTTP_EQUIV, HTML_AssignAtomAttribute },
+    { "value", 5, HTML_ATTR_VALUE, HTML_AssignTextAttribute },
+    { NULL, 0 },
+    { "noresize", 8, HTML_ATTR_NORESIZE, HTML_AssignBoolAttribute },
+    { "longdesc", 8, HTML_ATTR_LONGDESC, HTML_AssignTextAttribute },
+    { "charset", 7, HTML_ATTR_CHARSET, HTML_AssignCharsetsAttribute },
+    { "compact", 7, HTML_ATTR_COMPACT, HTML_AssignBoolAttribute },
+    { "class", 5, HTML_ATTR_CLASS, HTML_AssignAtomAttribute },
+    { "multiple", 8, HTML_ATTR_MULTIPLE, HTML_AssignBoolAttribute },
+    { "enctype", 7, HTML_ATTR_ENCTYPE, HTML_AssignContentTypesAttribute },
+    { "language", 8, HTML_ATTR_LANGUAGE, HTML_AssignAtomAttribute },
+    { NULL, 0 },
+    { "cite", 4, HTML_ATTR_CITE, HTML_AssignTextAttribute },
+    { "abbr", 4, HTML_ATTR_ABBR, HTML_AssignTextAttribute },
+    { "style", 5, HTML_ATTR_STYLE, HTML_AssignStyleSheetAttribute },
+    { "size", 4, HTML_ATTR_SIZE, HTML_AssignTextAttribute },
+    { "codetype", 8, HTML_ATTR_CODETYPE, HTML_AssignContentTypesAttribute },
+    { "rel", 3, HTML_ATTR_REL, HTML_AssignAtomAttribute },
+    { NULL, 0 },
+    { "declare", 7, HTML_ATTR_DECLARE, HTML_AssignBoolAttribute },
+    { "target", 6, HTML_ATTR_TARGET, HTML_AssignAtomAttribute },
+    { "hreflang", 8, HTML_ATTR_HREFLANG, HTML_AssignAtomAttribute },
+    { "hspace", 6, HTML_ATTR_HSPACE, HTML_AssignPixelsAttribute },
+    { "coords", 6, HTML_ATTR_COORDS, HTML_AssignCoordsAttribute },
+    { "shape", 5, HTML_ATTR_SHAPE, HTML_AssignShapeAttribute },
+    { NULL, 0 },
+    { "object", 6, HTML_ATTR_OBJECT, HTML_AssignTextAttribute },
+    { NULL, 0 },
+    { "datetime", 8, HTML_ATTR_DATETIME, HTML_AssignTextAttribute },
+    { "valign", 6, HTML_ATTR_VALIGN, HTML_AssignVAlignAttribute },
+    { "face", 4, HTML_ATTR_FACE, HTML_AssignTextAttribute },
+    { "leftmargin", 10, HTML_ATTR_LEFTMARGIN, HTML_AssignLengthAttribute },
+    { "cols", 4, HTML_ATTR_COLS, HTML_AssignMultiLengthAttribute },
+    { "action", 6, HTML_ATTR_ACTION, HTML_AssignTextAttribute },
+    { NULL, 0 },
+    { "checked", 7, HTML_ATTR_CHECKED, HTML_AssignBoolAttribute },
+    { "title", 5, HTML_ATTR_TITLE, HTML_AssignTextAttribute },
+    { NULL, 0 },
+    { "cellspacing", 11, HTML_ATTR_CELLSPACING, HTML_AssignLengthAttribute },
+    { "noshade", 7, HTML_ATTR_NOSHADE, HTML_AssignBoolAttribute },
+    { "link", 4, HTML_ATTR_LINK, HTML_AssignColorAttribute },
+    { "media", 5, HTML_ATTR_MEDIA, HTML_AssignAtomAttribute },
+    { "cellpadding", 11, HTML_ATTR_CELLPADDING, HTML_AssignLengthAttribute },
+    { "colspan", 7, HTML_ATTR_COLSPAN, HTML_AssignNumberAttribute },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "clear", 5, HTML_ATTR_CLEAR, HTML_AssignClearAttribute },
+    { "type", 4, HTML_ATTR_TYPE, HTML_AssignAtomAttribute },
+    { "bgcolor", 7, HTML_ATTR_BGCOLOR, HTML_AssignColorAttribute },
+    { "vspace", 6, HTML_ATTR_VSPACE, HTML_AssignPixelsAttribute },
+    { "charoff", 7, HTML_ATTR_CHAROFF, HTML_AssignLengthAttribute },
+    { "rowspan", 7, HTML_ATTR_ROWSPAN, HTML_AssignNumberAttribute },
+    { NULL, 0 },
+    { "char", 4, HTML_ATTR_CHAR, HTML_AssignCharacterAttribute },
+    { NULL, 0 },
+    { "bottommargin", 12, HTML_ATTR_BOTTOMMARGIN, HTML_AssignLengthAttribute },
+    { "for", 3, HTML_ATTR_FOR, HTML_AssignTextAttribute },
+    { "scheme", 6, HTML_ATTR_SCHEME, HTML_AssignAtomAttribute },
+    { "scope", 5, HTML_ATTR_SCOPE, HTML_AssignScopeAttribute },
+    { NULL, 0 },
+    { "content", 7, HTML_ATTR_CONTENT, HTML_AssignTextAttribute },
+    { "code", 4, HTML_ATTR_CODE, HTML_AssignTextAttribute },
+    { "profile", 7, HTML_ATTR_PROFILE, HTML_AssignTextAttribute },
+    { "readonly", 8, HTML_ATTR_READONLY, HTML_AssignBoolAttribute },
+    { "color", 5, HTML_ATTR_COLOR, HTML_AssignColorAttribute },
+    { NULL, 0 },
+    { "rows", 4, HTML_ATTR_ROWS, HTML_AssignMultiLengthAttribute },
+    { "frame", 5, HTML_ATTR_FRAME, HTML_AssignTFrameAttribute },
+    { "ismap", 5, HTML_ATTR_ISMAP, HTML_AssignBoolAttribute },
+    { "data", 4, HTML_ATTR_DATA, HTML_AssignTextAttribute },
+    { "selected", 8, HTML_ATTR_SELECTED, HTML_AssignBoolAttribute },
+    { "marginheight", 12, HTML_ATTR_MARGINHEIGHT, HTML_AssignPixelsAttribute },
+    { NULL, 0 },
+    { "accesskey", 9, HTML_ATTR_ACCESSKEY, HTML_AssignCharacterAttribute },
+    { "maxlength", 9, HTML_ATTR_MAXLENGTH, HTML_AssignNumberAttribute },
+    { "align", 5, HTML_ATTR_ALIGN, HTML_AssignAlignAttribute },
+    { "label", 5, HTML_ATTR_LABEL, HTML_AssignTextAttribute },
+    { "method", 6, HTML_ATTR_METHOD, HTML_AssignMethodAttribute },
+    { "start", 5, HTML_ATTR_START, HTML_AssignNumberAttribute },
+    { "rightmargin", 11, HTML_ATTR_RIGHTMARGIN, HTML_AssignLengthAttribute },
+    { "prompt", 6, HTML_ATTR_PROMPT, HTML_AssignTextAttribute },
+    { "alt", 3, HTML_ATTR_ALT, HTML_AssignTextAttribute },
+    { NULL, 0 },
+    { "axis", 4, HTML_ATTR_AXIS, HTML_AssignTextAttribute },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "nowrap", 6, HTML_ATTR_NOWRAP, HTML_AssignBoolAttribute },
+    { "src", 3, HTML_ATTR_SRC, HTML_AssignTextAttribute },
+    { "height", 6, HTML_ATTR_HEIGHT, HTML_AssignLengthAttribute },
+    { "scrolling", 9, HTML_ATTR_SCROLLING, HTML_AssignScrollAttribute },
+    { "headers", 7, HTML_ATTR_HEADERS, HTML_AssignTextAttribute },
+    { "codebase", 8, HTML_ATTR_CODEBASE, HTML_AssignTextAttribute },
+    { "usemap", 6, HTML_ATTR_USEMAP, HTML_AssignTextAttribute },
+    { "disabled", 8, HTML_ATTR_DISABLED, HTML_AssignBoolAttribute },
+    { "text", 4, HTML_ATTR_TEXT, HTML_AssignColorAttribute },
+    { "tabindex", 8, HTML_ATTR_TABINDEX, HTML_AssignNumberAttribute },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "vlink", 5, HTML_ATTR_VLINK, HTML_AssignColorAttribute },
+    { "topmargin", 9, HTML_ATTR_TOPMARGIN, HTML_AssignLengthAttribute },
+    { NULL, 0 },
+    { "nohref", 6, HTML_ATTR_NOHREF, HTML_AssignBoolAttribute },
+    { "classid", 7, HTML_ATTR_CLASSID, HTML_AssignTextAttribute },
+};
+
+#endif // _HTML_ATTRIBUTES_HASH_H_
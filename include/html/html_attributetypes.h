@@ -1,6 +1,8 @@
 #ifndef _HTMLATTRTYPES_H_
 #define _HTMLATTRTYPES_H_
 
+#include <stdint.h>
+
 #include "types.h"
 
 //
@@ -83,13 +85,19 @@ typedef enum {
     CTYPE_APP_VNDMSEXCEL,
     CTYPE_APP_VNDOPENXMLFORMATSOFFICEDOCUMENTSPREADSHEET,
     CTYPE_APP_VNDMSPOWERPOINT,
-    CTYPE_APP_VNDOPENXMLFORMATS,
     CTYPE_APP_VNDOPENXMLFORMATSOFFICEDOCUMENTPRESENTATIONMLPRESENTATION,
     CTYPE_APP_MSWORD,
     CTYPE_APP_VNDOPENXMLFORMATSOFFICEDOCUMENTWORDPROCESSINGMLDOCUMENT,
     CTYPE_APP_VNDMOZILLAXULXML
 } contenttypes_t;
 
+// A parsed content type, along with the charset if it was
+// given as a parameter ("text/html; charset=utf-8").
+typedef struct {
+    contenttypes_t type;
+    charsets_t charset;
+} contenttype_t;
+
 //==== %Character; ====//
 typedef char character_t;
 
@@ -112,8 +120,13 @@ typedef char cdata_t;
 typedef int pixels_t;
 
 //==== %Length; ====//
+// Lengths are fixed point, with this many bits after the
+// point. So 1.5em is {384, LEN_EM}.
+#define LENGTH_FRAC_BITS    8
+#define LENGTH_ONE          (1 << LENGTH_FRAC_BITS)
+
 typedef struct {
-    int len;
+    int32_t value;
 
     enum {
         LEN_PIXEL,
@@ -125,12 +138,26 @@ typedef struct {
         LEN_VH,
         LEN_VMIN,
         LEN_VMAX,
-        LEN_PERCENT
+        LEN_PERCENT,
+        LEN_RELATIVE        // "2*", a share of whatever space is left.
     } type;
 } length_t;
 
+//
+// What relative lengths are relative to. Everything is
+// a fixed point pixel size, like length_t.
+//
+typedef struct {
+    int32_t containing;     // What percentages are of.
+    int32_t font_size;      // em, and ex and ch at half of it.
+    int32_t root_font_size; // rem
+    int32_t viewport_width;
+    int32_t viewport_height;
+} lengthcontext_t;
+
 //==== %MultiLengths; ====//
-typedef length_t multilengths_t;
+// Kept as text, see HTML_ParseMultiLengths.
+typedef char multilengths_t;
 
 //==== NUMBER ====//
 //(https://www.w3.org/TR/html4/types.html#type-number)
@@ -0,0 +1,67 @@
+#ifndef _HTML_CACHE_H_
+#define _HTML_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "html_document.h"
+
+// Bump whenever anything written to the cache changes shape.
+#define HTML_CACHE_VERSION      6
+
+#define HTML_CACHE_MAGIC        "PNTMTREE"
+
+// Written as-is, so a cache from a machine with the other
+// byte order reads back as something else.
+#define HTML_CACHE_BYTE_ORDER   0x01020304
+
+//
+// A parsed document as saved in the parse cache. The
+// sections after the header are the document's own structs,
+// except that every pointer is stored as an offset from the
+// start of the file. Loading maps the file read-only and
+// leaves the offsets as they are, so there's no parsing and
+// no writing to it; they're turned into pointers when asked
+// for (see HTML_NodeText and HTML_NodeAttributes).
+//
+typedef struct {
+    char                    magic[8];
+    uint32_t                version;
+    uint32_t                byte_order;
+    uint16_t                pointer_size;
+    uint16_t                node_size;          // sizeof(html_node_t) when written.
+    uint16_t                attribute_size;     // sizeof(attribute_t) when written.
+    uint16_t                attribute_count;    // HTML_ATTR_COUNT when written.
+    uint64_t                hash;               // Content hash of the document before parsing.
+    uint64_t                length;             // Its length before parsing.
+    uint32_t                node_count;
+    nodeid_t                current;
+    uint64_t                nodes;              // html_node_t[node_count]
+    uint64_t                attributes;         // attribute_t[attribute_total]
+    uint64_t                attribute_total;
+    uint64_t                pairs;              // attrpair_t[pair_total], overflow storage.
+    uint64_t                pair_total;
+    uint64_t                atoms;              // html_cacheatom_t[atom_total]
+    uint64_t                atom_total;
+    uint64_t                strings;            // The source, then any other text.
+    uint64_t                strings_len;
+    uint64_t                source_len;         // How much of strings is the source.
+    uint32_t                has_source;
+    uint32_t                element_count;      // HTML_ELEM_COUNT when written.
+} html_cacheheader_t;
+
+// An interned string, so the table can be rebuilt.
+typedef struct {
+    uint64_t                offset;
+    uint64_t                len;
+} html_cacheatom_t;
+
+extern bool HTML_SaveCache(html_document_t* document, const char* cache_dir,
+                            uint64_t hash, size_t length);
+extern bool HTML_LoadCache(html_document_t* document, const char* cache_dir,
+                            uint64_t hash, size_t length);
+extern attribute_t* HTML_CachedAttributes(html_document_t* document, uint64_t offset);
+extern void HTML_DetachCache(html_document_t* document);
+
+#endif // _HTML_CACHE_H_
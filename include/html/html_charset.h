@@ -0,0 +1,37 @@
+#ifndef _HTML_CHARSET_H_
+#define _HTML_CHARSET_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "types.h"
+#include "html_attributetypes.h"
+
+// How much of a document is looked through for a
+// <meta> giving its charset.
+#define HTML_PRESCAN_LEN        1024
+
+//
+// A document's bytes turned into the UTF-8 the parser
+// works on. Documents that already are UTF-8 are used
+// where they are, only ones that needed transcoding or
+// repairing get a buffer of their own.
+//
+typedef struct {
+    char*                   data;       // NUL terminated, like the input.
+    size_t                  length;
+    charsets_t              charset;    // What the input turned out to be in.
+    char*                   buffer;     // Heap copy data points into, NULL if none.
+} html_input_t;
+
+// What 0x80 - 0x9F are in Windows-1252, 0 where it has
+// nothing there.
+extern const unsigned short html_windows1252[32];
+
+extern charsets_t HTML_SniffCharset(const char* data, size_t length, size_t* bom_len);
+extern charsets_t HTML_PrescanCharset(const char* data, size_t length);
+extern size_t HTML_FindInvalidUTF8(const char* data, size_t length, size_t start);
+extern void HTML_DecodeInput(html_input_t* input, char* data, size_t length);
+extern void HTML_FreeInput(html_input_t* input);
+
+#endif // _HTML_CHARSET_H_
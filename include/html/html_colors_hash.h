@@ -0,0 +1,281 @@
+#ifndef _HTML_COLORS_HASH_H_
+#define _HTML_COLORS_HASH_H_
+
+// Generated by tools/gen_perfect_hash.py, do not edit by hand.
+#define HTML_COLORS_SLOTS 256
+#define HTML_COLORS_BUCKETS 128
+
+static const unsigned short html_colors_displace[HTML_COLORS_BUCKETS] = {
+    0, 0, 0, 1, 2, 0, 0, 0, 1, 1, 1, 0,
+    1, 2, 1, 1, 1, 1, 0, 2, 1, 1, 1, 7,
+    1, 1, 2, 0, 1, 1, 0, 3, 2, 0, 2, 0,
+    2, 0, 2, 1, 0, 2, 0, 1, 0, 1, 0, 1,
+    2, 1, 0, 0, 9, 0, 1, 1, 0, 4, 1, 1,
+    2, 2, 0, 5, 0, 0, 0, 1, 0, 1, 1, 0,
+    1, 2, 1, 0, 2, 1, 4, 1, 0, 3, 5, 2,
+    0, 3, 0, 1, 0, 5, 1, 0, 1, 1, 4, 3,
+    1, 0, 0, 0, 0, 0, 2, 5, 1, 0, 2, 1,
+    1, 4, 3, 0, 3, 1, 1, 3, 0, 1, 3, 5,
+    0, 0, 0, 1, 2, 6, 3, 1,
+};
+
+static const html_namedcolor_t html_colors_table[HTML_COLORS_SLOTS] = {
+    { NULL, 0 },
+    { "thistle", 7, 216, 191, 216 },
+    { "crimson", 7, 220, 20, 60 },
+    { "chartreuse", 10, 127, 255, 0 },
+    { NULL, 0 },
+    { "lightgoldenrodyellow", 20, 250, 250, 210 },
+    { "black", 5, 0, 0, 0 },
+    { "mistyrose", 9, 255, 228, 225 },
+    { "saddlebrown", 11, 139, 69, 19 },
+    { NULL, 0 },
+    { "cornflowerblue", 14, 100, 149, 237 },
+    { "darkseagreen", 12, 143, 188, 143 },
+    { "white", 5, 255, 255, 255 },
+    { "springgreen", 11, 0, 255, 127 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "lavenderblush", 13, 255, 240, 245 },
+    { NULL, 0 },
+    { "purple", 6, 128, 0, 128 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "aquamarine", 10, 127, 255, 212 },
+    { NULL, 0 },
+    { "rebeccapurple", 13, 102, 51, 153 },
+    { "papayawhip", 10, 255, 239, 213 },
+    { "aliceblue", 9, 240, 248, 255 },
+    { NULL, 0 },
+    { "lightsalmon", 11, 255, 160, 122 },
+    { NULL, 0 },
+    { "darkorchid", 10, 153, 50, 204 },
+    { NULL, 0 },
+    { "lawngreen", 9, 124, 252, 0 },
+    { NULL, 0 },
+    { "deepskyblue", 11, 0, 191, 255 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "darkgray", 8, 169, 169, 169 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "darkgrey", 8, 169, 169, 169 },
+    { "tan", 3, 210, 180, 140 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "greenyellow", 11, 173, 255, 47 },
+    { "cornsilk", 8, 255, 248, 220 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "darkmagenta", 11, 139, 0, 139 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "royalblue", 9, 65, 105, 225 },
+    { "orange", 6, 255, 165, 0 },
+    { "navajowhite", 11, 255, 222, 173 },
+    { NULL, 0 },
+    { "lightslategray", 14, 119, 136, 153 },
+    { "gold", 4, 255, 215, 0 },
+    { NULL, 0 },
+    { "darkgoldenrod", 13, 184, 134, 11 },
+    { NULL, 0 },
+    { "grey", 4, 128, 128, 128 },
+    { "navy", 4, 0, 0, 128 },
+    { "palegreen", 9, 152, 251, 152 },
+    { "sandybrown", 10, 244, 164, 96 },
+    { "lightpink", 9, 255, 182, 193 },
+    { "olive", 5, 128, 128, 0 },
+    { "mediumpurple", 12, 147, 112, 219 },
+    { "darkorange", 10, 255, 140, 0 },
+    { "khaki", 5, 240, 230, 140 },
+    { "peru", 4, 205, 133, 63 },
+    { NULL, 0 },
+    { "darkkhaki", 9, 189, 183, 107 },
+    { NULL, 0 },
+    { "mintcream", 9, 245, 255, 250 },
+    { "seashell", 8, 255, 245, 238 },
+    { "yellowgreen", 11, 154, 205, 50 },
+    { NULL, 0 },
+    { "moccasin", 8, 255, 228, 181 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "lightgray", 9, 211, 211, 211 },
+    { "limegreen", 9, 50, 205, 50 },
+    { NULL, 0 },
+    { "deeppink", 8, 255, 20, 147 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "honeydew", 8, 240, 255, 240 },
+    { "dimgrey", 7, 105, 105, 105 },
+    { "darksalmon", 10, 233, 150, 122 },
+    { "mediumaquamarine", 16, 102, 205, 170 },
+    { "coral", 5, 255, 127, 80 },
+    { NULL, 0 },
+    { "indigo", 6, 75, 0, 130 },
+    { "oldlace", 7, 253, 245, 230 },
+    { NULL, 0 },
+    { "lightcyan", 9, 224, 255, 255 },
+    { "slateblue", 9, 106, 90, 205 },
+    { "lightgrey", 9, 211, 211, 211 },
+    { NULL, 0 },
+    { "silver", 6, 192, 192, 192 },
+    { "darkred", 7, 139, 0, 0 },
+    { "snow", 4, 255, 250, 250 },
+    { NULL, 0 },
+    { "skyblue", 7, 135, 206, 235 },
+    { "darkslateblue", 13, 72, 61, 139 },
+    { "darkslategray", 13, 47, 79, 79 },
+    { "blanchedalmond", 14, 255, 235, 205 },
+    { "lightyellow", 11, 255, 255, 224 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "indianred", 9, 205, 92, 92 },
+    { "rosybrown", 9, 188, 143, 143 },
+    { "lightsteelblue", 14, 176, 196, 222 },
+    { "mediumvioletred", 15, 199, 21, 133 },
+    { "lavender", 8, 230, 230, 250 },
+    { "goldenrod", 9, 218, 165, 32 },
+    { NULL, 0 },
+    { "dodgerblue", 10, 30, 144, 255 },
+    { "mediumorchid", 12, 186, 85, 211 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "azure", 5, 240, 255, 255 },
+    { "darkturquoise", 13, 0, 206, 209 },
+    { "brown", 5, 165, 42, 42 },
+    { "steelblue", 9, 70, 130, 180 },
+    { "red", 3, 255, 0, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "paleturquoise", 13, 175, 238, 238 },
+    { NULL, 0 },
+    { "tomato", 6, 255, 99, 71 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "yellow", 6, 255, 255, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "lightseagreen", 13, 32, 178, 170 },
+    { NULL, 0 },
+    { "cyan", 4, 0, 255, 255 },
+    { NULL, 0 },
+    { "floralwhite", 11, 255, 250, 240 },
+    { NULL, 0 },
+    { "salmon", 6, 250, 128, 114 },
+    { "olivedrab", 9, 107, 142, 35 },
+    { "pink", 4, 255, 192, 203 },
+    { "fuchsia", 7, 255, 0, 255 },
+    { "green", 5, 0, 128, 0 },
+    { "teal", 4, 0, 128, 128 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "firebrick", 9, 178, 34, 34 },
+    { "gray", 4, 128, 128, 128 },
+    { NULL, 0 },
+    { "antiquewhite", 12, 250, 235, 215 },
+    { NULL, 0 },
+    { "powderblue", 10, 176, 224, 230 },
+    { "darkcyan", 8, 0, 139, 139 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "palegoldenrod", 13, 238, 232, 170 },
+    { "burlywood", 9, 222, 184, 135 },
+    { NULL, 0 },
+    { "lemonchiffon", 12, 255, 250, 205 },
+    { "chocolate", 9, 210, 105, 30 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "slategray", 9, 112, 128, 144 },
+    { "maroon", 6, 128, 0, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "gainsboro", 9, 220, 220, 220 },
+    { NULL, 0 },
+    { "lightcoral", 10, 240, 128, 128 },
+    { "hotpink", 7, 255, 105, 180 },
+    { "darkviolet", 10, 148, 0, 211 },
+    { "mediumblue", 10, 0, 0, 205 },
+    { NULL, 0 },
+    { "lightslategrey", 14, 119, 136, 153 },
+    { NULL, 0 },
+    { "lightblue", 9, 173, 216, 230 },
+    { "darkblue", 8, 0, 0, 139 },
+    { "lightskyblue", 12, 135, 206, 250 },
+    { "darkgreen", 9, 0, 100, 0 },
+    { "orangered", 9, 255, 69, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "darkolivegreen", 14, 85, 107, 47 },
+    { "peachpuff", 9, 255, 218, 185 },
+    { "lime", 4, 0, 255, 0 },
+    { "forestgreen", 11, 34, 139, 34 },
+    { NULL, 0 },
+    { "sienna", 6, 160, 82, 45 },
+    { "slategrey", 9, 112, 128, 144 },
+    { NULL, 0 },
+    { "cadetblue", 9, 95, 158, 160 },
+    { NULL, 0 },
+    { "mediumturquoise", 15, 72, 209, 204 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "magenta", 7, 255, 0, 255 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "seagreen", 8, 46, 139, 87 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "mediumspringgreen", 17, 0, 250, 154 },
+    { NULL, 0 },
+    { "midnightblue", 12, 25, 25, 112 },
+    { "mediumseagreen", 14, 60, 179, 113 },
+    { NULL, 0 },
+    { "ghostwhite", 10, 248, 248, 255 },
+    { NULL, 0 },
+    { "plum", 4, 221, 160, 221 },
+    { NULL, 0 },
+    { "wheat", 5, 245, 222, 179 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "linen", 5, 250, 240, 230 },
+    { "palevioletred", 13, 219, 112, 147 },
+    { "aqua", 4, 0, 255, 255 },
+    { "bisque", 6, 255, 228, 196 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "lightgreen", 10, 144, 238, 144 },
+    { "violet", 6, 238, 130, 238 },
+    { "turquoise", 9, 64, 224, 208 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "ivory", 5, 255, 255, 240 },
+    { "whitesmoke", 10, 245, 245, 245 },
+    { NULL, 0 },
+    { "orchid", 6, 218, 112, 214 },
+    { "dimgray", 7, 105, 105, 105 },
+    { "blue", 4, 0, 0, 255 },
+    { NULL, 0 },
+    { "mediumslateblue", 15, 123, 104, 238 },
+    { "darkslategrey", 13, 47, 79, 79 },
+    { "beige", 5, 245, 245, 220 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "blueviolet", 10, 138, 43, 226 },
+};
+
+#endif // _HTML_COLORS_HASH_H_
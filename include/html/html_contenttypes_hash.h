@@ -0,0 +1,81 @@
+#ifndef _HTML_CONTENTTYPES_HASH_H_
+#define _HTML_CONTENTTYPES_HASH_H_
+
+// Generated by tools/gen_perfect_hash.py, do not edit by hand.
+#define HTML_CONTENTTYPES_SLOTS 64
+#define HTML_CONTENTTYPES_BUCKETS 32
+
+static const unsigned short html_contenttypes_displace[HTML_CONTENTTYPES_BUCKETS] = {
+    3, 0, 9, 1, 2, 1, 0, 1, 1, 2, 1, 0,
+    2, 2, 4, 1, 3, 2, 0, 2, 3, 5, 1, 2,
+    4, 1, 17, 7, 1, 1, 4, 1,
+};
+
+static const html_contenttype_t html_contenttypes_table[HTML_CONTENTTYPES_SLOTS] = {
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "image/tiff", 10, CTYPE_IMG_TIFF },
+    { "video/mpeg", 10, CTYPE_VID_MPEG },
+    { "image/jpeg", 10, CTYPE_IMG_JPEG },
+    { "application/vnd.oasis.opendocument.graphics", 43, CTYPE_APP_VNDOASISOPENDOCUMENTGRAPHICS },
+    { NULL, 0 },
+    { "application/ogg", 15, CTYPE_APP_OGG },
+    { "application/ld+json", 19, CTYPE_APP_LDJSON },
+    { "application/vnd.ms-excel", 24, CTYPE_APP_VNDMSEXCEL },
+    { "application/octet-stream", 24, CTYPE_APP_OCTETSTREAM },
+    { "application/x-shockwave-flash", 29, CTYPE_APP_XSHOCKWAVEFLASH },
+    { NULL, 0 },
+    { "image/x-icon", 12, CTYPE_IMG_XICON },
+    { "video/x-ms-wmv", 14, CTYPE_VID_XMSWMV },
+    { "audio/x-ms-wma", 14, CTYPE_AUD_XMASWMA },
+    { "application/xml", 15, CTYPE_APP_XML },
+    { "video/x-msvideo", 15, CTYPE_VID_XMSVIDEO },
+    { "application/vnd.oasis.opendocument.text", 39, CTYPE_APP_VNDOASISOPENDOCUMENTTEXT },
+    { "multipart/mixed", 15, CTYPE_MPA_MIXED },
+    { "audio/x-wav", 11, CTYPE_AUD_XWAV },
+    { "text/xml", 8, CTYPE_TXT_XML },
+    { "video/x-flv", 11, CTYPE_VID_XFLV },
+    { "application/javascript", 22, CTYPE_APP_JS },
+    { "application/vnd.openxmlformats-officedocument.presentationml.presentation", 73, CTYPE_APP_VNDOPENXMLFORMATSOFFICEDOCUMENTPRESENTATIONMLPRESENTATION },
+    { "video/quicktime", 15, CTYPE_VID_QUICKTIME },
+    { "text/csv", 8, CTYPE_TXT_CSV },
+    { "application/edi-x12", 19, CTYPE_APP_EDIX12 },
+    { "audio/mpeg", 10, CTYPE_AUD_MPEG },
+    { NULL, 0 },
+    { "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet", 65, CTYPE_APP_VNDOPENXMLFORMATSOFFICEDOCUMENTSPREADSHEET },
+    { "image/vnd.microsoft.icon", 24, CTYPE_IMG_VNDMICROSOFTICON },
+    { "multipart/related", 17, CTYPE_MPA_RELATED },
+    { "text/html", 9, CTYPE_TXT_HTML },
+    { "multipart/form-data", 19, CTYPE_MPA_FORMDATA },
+    { "application/pdf", 15, CTYPE_APP_PDF },
+    { "image/gif", 9, CTYPE_IMG_GIF },
+    { "application/json", 16, CTYPE_APP_JSON },
+    { "text/css", 8, CTYPE_TXT_CSS },
+    { "application/x-www-form-urlencoded", 33, CTYPE_APP_XWWWFORMURLENCODED },
+    { "audio/vnd.rn-realaudio", 22, CTYPE_AUD_VNDRNREALAUDIO },
+    { "application/vnd.mozilla.xul+xml", 31, CTYPE_APP_VNDMOZILLAXULXML },
+    { "application/vnd.openxmlformats-officedocument.wordprocessingml.document", 71, CTYPE_APP_VNDOPENXMLFORMATSOFFICEDOCUMENTWORDPROCESSINGMLDOCUMENT },
+    { "application/xhtml+xml", 21, CTYPE_APP_XHTMLXML },
+    { "application/zip", 15, CTYPE_APP_ZIP },
+    { NULL, 0 },
+    { "video/mp4", 9, CTYPE_VID_MP4 },
+    { "multipart/alternative", 21, CTYPE_MPA_ALTERNATIVE },
+    { "video/webm", 10, CTYPE_VID_WEBM },
+    { "application/msword", 18, CTYPE_APP_MSWORD },
+    { "text/plain", 10, CTYPE_TXT_PLAIN },
+    { "application/edifact", 19, CTYPE_APP_EDIFACT },
+    { "image/vnd.djvu", 14, CTYPE_IMG_VNDDJVU },
+    { "application/vnd.ms-powerpoint", 29, CTYPE_APP_VNDMSPOWERPOINT },
+    { "text/javascript", 15, CTYPE_TXT_JS },
+    { NULL, 0 },
+    { "application/vnd.oasis.opendocument.presentation", 47, CTYPE_APP_VNDOASISOPENDOCUMENTPRESENTATION },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "application/vnd.oasis.opendocument.spreadsheet", 46, CTYPE_APP_VNDOASISOPENDOCUMENTSPREADSHEET },
+    { "image/png", 9, CTYPE_IMG_PNG },
+    { NULL, 0 },
+    { "image/svg+xml", 13, CTYPE_IMG_SVGXML },
+};
+
+#endif // _HTML_CONTENTTYPES_HASH_H_
@@ -0,0 +1,149 @@
+#ifndef _HTML_DOCUMENT_H_
+#define _HTML_DOCUMENT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdbool.h>
+
+#include "types.h"
+#include "arena.h"
+#include "intern.h"
+#include "html_datatype.h"
+#include "html_token.h"
+
+// Starting size of the node array, it doubles as needed.
+#define HTML_NODES_LEN          256
+
+// Index used for "no node" in parent/child/sibling links.
+#define HTML_NODE_NONE          0xFFFFFFFF
+
+// The root of every document is the first node.
+#define HTML_NODE_ROOT          0
+
+#define HTML_NODE_DOCUMENT      0
+#define HTML_NODE_ELEMENT       1
+#define HTML_NODE_TEXT          2
+
+// Set to 0 to build the parser without its counters.
+#ifndef HTML_STATS
+#define HTML_STATS              1
+#endif
+
+// Slots in a document's cache of resolved lengths.
+#define HTML_LENGTH_CACHE_LEN   256
+
+typedef uint32_t nodeid_t;
+
+// A relative length resolved against one context.
+typedef struct {
+    length_t                length;
+    lengthcontext_t         context;
+    int32_t                 resolved;       // Fixed point pixels.
+    bool                    used;
+} html_resolvedlength_t;
+
+//
+// What went on while parsing a document. Updating these
+// costs an add per tag or attribute, and with HTML_STATS
+// set to 0 they aren't touched at all.
+//
+typedef struct {
+    uint64_t                bytes;              // Markup tokenized.
+    uint64_t                start_tags;
+    uint64_t                end_tags;
+    uint64_t                declarations;       // Comments, DOCTYPEs and the like.
+    uint64_t                raw_text_bytes;     // Script, style, title and textarea content skipped over.
+    uint64_t                attributes[HTML_ATTR_COUNT]; // Times each attribute was given.
+    uint64_t                unknown_elements;
+    uint64_t                unknown_attributes;
+    uint64_t                duplicate_attributes;
+    double                  clean_seconds;
+    double                  parse_seconds;      // Tokenizing and building the tree.
+    double                  load_seconds;       // Loading from the parse cache instead.
+} html_stats_t;
+
+#if HTML_STATS
+#define HTML_COUNT(document, counter, amount)   ((document)->stats.counter += (amount))
+#define HTML_CLOCK()                            HTML_StatsSeconds()
+#else
+#define HTML_COUNT(document, counter, amount)   ((void)(amount))
+#define HTML_CLOCK()                            0.0
+#endif
+
+//
+// The DOM is one flat array of nodes in document order.
+// Links between them are indices into that array rather
+// than pointers, so the whole tree can be walked front to
+// back, copied or freed as a single block. Once a document
+// has been edited, there can be a gap of unused nodes in
+// the middle of the array (see HTML_MoveNodeGap). Nodes
+// still in a parse cache file hold offsets into it in place
+// of their text and attribute pointers, so those are read
+// through HTML_NodeText and HTML_NodeAttributes.
+//
+typedef struct {
+    byte                    type;           // HTML_NODE_*
+    byte                    tag;            // HTML_ELEM_* for elements.
+    nodeid_t                parent;
+    nodeid_t                first_child;
+    nodeid_t                last_child;
+    nodeid_t                next_sibling;
+    uint32_t                text_len;       // Length of text, for text nodes.
+    uint32_t                offset;         // Where the node's token starts in the source.
+    union {
+        const char*         text;           // Slice of the document, for text nodes.
+        attribute_t*        attributes;     // NULL if the element had none.
+    };
+} html_node_t;
+
+typedef struct {
+    arena_t*                arena;          // Owns every allocation made for this document.
+    bool                    owns_arena;     // Whether freeing the document destroys the arena.
+    intern_table_t*         strings;        // Repeated attribute values, stored once.
+    html_node_t*            nodes;          // The tree, in document order.
+    uint32_t                node_count;     // Including the gap.
+    uint32_t                node_capacity;
+    nodeid_t                node_gap;       // Unused nodes new ones go into, see HTML_MoveNodeGap.
+    uint32_t                node_gap_len;
+    uint32_t                offset_shift;   // Still to be added to offsets of nodes past the gap.
+    nodeid_t                current;        // Element new nodes get added to.
+    bool                    copy_text;      // Copy text into the arena instead of slicing.
+    bool                    text_continues; // Next text run extends the last text node.
+    char*                   source;         // Cleaned markup the nodes came from, if known.
+    size_t                  source_len;
+    size_t                  source_capacity;// Nonzero once the document owns its source.
+    size_t                  source_gap;     // Room for edits, see HTML_DocumentSource.
+    size_t                  source_gap_len;
+    void*                   mapping;        // Parse cache file the document was loaded from.
+    size_t                  mapping_size;
+    attribute_t**           cached_attributes; // Ones resolved out of the mapping so far.
+    html_stats_t            stats;
+    html_resolvedlength_t*  lengths;        // Made the first time a length is resolved.
+} html_document_t;
+
+extern html_document_t* HTML_CreateDocument(void);
+extern html_document_t* HTML_CreateDocumentInArena(arena_t* arena);
+extern void HTML_FreeDocument(html_document_t* document);
+
+extern void HTML_ReserveNodes(html_document_t* document, uint32_t count);
+extern html_node_t* HTML_GetNode(html_document_t* document, nodeid_t id);
+extern bool HTML_NodesMapped(html_document_t* document);
+extern const char* HTML_NodeText(html_document_t* document, nodeid_t id);
+extern attribute_t* HTML_NodeAttributes(html_document_t* document, nodeid_t id);
+extern uint32_t HTML_NodeOffset(html_document_t* document, nodeid_t id);
+extern void HTML_MoveNodeGap(html_document_t* document, nodeid_t id);
+extern void HTML_CompactNodes(html_document_t* document);
+extern nodeid_t HTML_AppendElement(html_document_t* document, byte tag, 
+                                    attribute_t* attributes);
+extern void HTML_CloseElement(html_document_t* document, byte tag);
+extern nodeid_t HTML_AppendText(html_document_t* document, const char* text, size_t len, bool raw);
+extern void HTML_AppendToken(html_document_t* document, const html_token_t* token);
+extern bool HTML_IsVoidElement(byte tag);
+extern void HTML_DumpTree(html_document_t* document);
+
+extern double HTML_StatsSeconds(void);
+extern void HTML_AddStats(html_stats_t* stats, const html_stats_t* other);
+extern void HTML_WriteStats(html_document_t* document, FILE* file);
+
+#endif // _HTML_DOCUMENT_H_
@@ -1,6 +1,10 @@
 #ifndef _HTMLELEM_H_
 #define _HTMLELEM_H_
 
+#include <stddef.h>
+
+#include "types.h"
+
 //
 // List of all available HTML 4.01 elements
 // https://www.w3.org/TR/html4/index/elements.html
@@ -96,6 +100,18 @@
 #define     HTML_ELEM_U             88
 #define     HTML_ELEM_UL            89
 #define     HTML_ELEM_VAR           90
+#define     HTML_ELEM_COUNT         91
 #define     HTML_ELEM_ERROR         255
 
+// Entry in the generated element name table.
+typedef struct {
+    const char*     name;
+    byte            len;
+    byte            id;
+} html_elementname_t;
+
+extern byte HTML_GetIDFromTagChunk(const char* tag_name, size_t len);
+extern byte HTML_GetIDFromTagString(char* tag_name);
+extern const char* HTML_GetTagStringFromID(byte id);
+
 #endif // _HTMLELEM_H_
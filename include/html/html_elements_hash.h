@@ -0,0 +1,148 @@
+#ifndef _HTML_ELEMENTS_HASH_H_
+#define _HTML_ELEMENTS_HASH_H_
+
+// Generated by tools/gen_perfect_hash.py, do not edit by hand.
+#define HTML_ELEMENTS_SLOTS 128
+#define HTML_ELEMENTS_BUCKETS 64
+
+static const unsigned short html_elements_displace[HTML_ELEMENTS_BUCKETS] = {
+    0, 1, 1, 2, 1, 2, 5, 2, 1, 2, 1, 0,
+    1, 1, 0, 3, 2, 1, 1, 2, 1, 1, 1, 3,
+    2, 2, 0, 3, 4, 0, 3, 1, 0, 1, 0, 0,
+    1, 1, 5, 0, 0, 1, 1, 1, 1, 2, 0, 9,
+    0, 3, 1, 2, 1, 1, 3, 1, 0, 1, 1, 1,
+    0, 8, 1, 7,
+};
+
+static const html_elementname_t html_elements_table[HTML_ELEMENTS_SLOTS] = {
+    { "abbr", 4, HTML_ELEM_ABBR },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "u", 1, HTML_ELEM_U },
+    { "em", 2, HTML_ELEM_EM },
+    { "q", 1, HTML_ELEM_Q },
+    { "center", 6, HTML_ELEM_CENTER },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "br", 2, HTML_ELEM_BR },
+    { "base", 4, HTML_ELEM_BASE },
+    { "font", 4, HTML_ELEM_FONT },
+    { NULL, 0 },
+    { "body", 4, HTML_ELEM_BODY },
+    { "caption", 7, HTML_ELEM_CAPTION },
+    { "param", 5, HTML_ELEM_PARAM },
+    { "area", 4, HTML_ELEM_AREA },
+    { "meta", 4, HTML_ELEM_META },
+    { "frameset", 8, HTML_ELEM_FRAMESET },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "p", 1, HTML_ELEM_P },
+    { "noframes", 8, HTML_ELEM_NOFRAMES },
+    { "pre", 3, HTML_ELEM_PRE },
+    { "h1", 2, HTML_ELEM_H1 },
+    { "div", 3, HTML_ELEM_DIV },
+    { "span", 4, HTML_ELEM_SPAN },
+    { "li", 2, HTML_ELEM_LI },
+    { "select", 6, HTML_ELEM_SELECT },
+    { NULL, 0 },
+    { "hr", 2, HTML_ELEM_HR },
+    { "td", 2, HTML_ELEM_TD },
+    { "frame", 5, HTML_ELEM_FRAME },
+    { "iframe", 6, HTML_ELEM_IFRAME },
+    { "ins", 3, HTML_ELEM_INS },
+    { NULL, 0 },
+    { "style", 5, HTML_ELEM_STYLE },
+    { "basefont", 8, HTML_ELEM_BASEFONT },
+    { "label", 5, HTML_ELEM_LABEL },
+    { "dt", 2, HTML_ELEM_DT },
+    { "del", 3, HTML_ELEM_DEL },
+    { "var", 3, HTML_ELEM_VAR },
+    { NULL, 0 },
+    { "dl", 2, HTML_ELEM_DL },
+    { "th", 2, HTML_ELEM_TH },
+    { "i", 1, HTML_ELEM_I },
+    { NULL, 0 },
+    { "ol", 2, HTML_ELEM_OL },
+    { "object", 6, HTML_ELEM_OBJECT },
+    { "noscript", 8, HTML_ELEM_NOSCRIPT },
+    { "applet", 6, HTML_ELEM_APPLET },
+    { "small", 5, HTML_ELEM_SMALL },
+    { "sub", 3, HTML_ELEM_SUB },
+    { "strong", 6, HTML_ELEM_STRONG },
+    { "big", 3, HTML_ELEM_BIG },
+    { "ul", 2, HTML_ELEM_UL },
+    { "form", 4, HTML_ELEM_FORM },
+    { "table", 5, HTML_ELEM_TABLE },
+    { "col", 3, HTML_ELEM_COL },
+    { "bdo", 3, HTML_ELEM_BDO },
+    { "s", 1, HTML_ELEM_S },
+    { NULL, 0 },
+    { "html", 4, HTML_ELEM_HTML },
+    { "a", 1, HTML_ELEM_A },
+    { "cite", 4, HTML_ELEM_CITE },
+    { NULL, 0 },
+    { "acronym", 7, HTML_ELEM_ACRONYM },
+    { NULL, 0 },
+    { "code", 4, HTML_ELEM_CODE },
+    { "option", 6, HTML_ELEM_OPTION },
+    { "img", 3, HTML_ELEM_IMG },
+    { "menu", 4, HTML_ELEM_MENU },
+    { "legend", 6, HTML_ELEM_LEGEND },
+    { "h6", 2, HTML_ELEM_H6 },
+    { "title", 5, HTML_ELEM_TITLE },
+    { NULL, 0 },
+    { "fieldset", 8, HTML_ELEM_FIELDSET },
+    { NULL, 0 },
+    { "strike", 6, HTML_ELEM_STRIKE },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "map", 3, HTML_ELEM_MAP },
+    { "script", 6, HTML_ELEM_SCRIPT },
+    { "tbody", 5, HTML_ELEM_TBODY },
+    { NULL, 0 },
+    { "samp", 4, HTML_ELEM_SAMP },
+    { "dd", 2, HTML_ELEM_DD },
+    { "input", 5, HTML_ELEM_INPUT },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "blockquote", 10, HTML_ELEM_BLOCKQUOTE },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "dfn", 3, HTML_ELEM_DFN },
+    { "dir", 3, HTML_ELEM_DIR },
+    { NULL, 0 },
+    { "isindex", 7, HTML_ELEM_ISINDEX },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "thead", 5, HTML_ELEM_THEAD },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "button", 6, HTML_ELEM_BUTTON },
+    { "h4", 2, HTML_ELEM_H4 },
+    { "optgroup", 8, HTML_ELEM_OPTGROUP },
+    { "address", 7, HTML_ELEM_ADDRESS },
+    { "kbd", 3, HTML_ELEM_KBD },
+    { "b", 1, HTML_ELEM_B },
+    { "h3", 2, HTML_ELEM_H3 },
+    { NULL, 0 },
+    { "textarea", 8, HTML_ELEM_TEXTAREA },
+    { "colgroup", 8, HTML_ELEM_COLGROUP },
+    { "h2", 2, HTML_ELEM_H2 },
+    { "tt", 2, HTML_ELEM_TT },
+    { "h5", 2, HTML_ELEM_H5 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "link", 4, HTML_ELEM_LINK },
+    { "head", 4, HTML_ELEM_HEAD },
+    { "tfoot", 5, HTML_ELEM_TFOOT },
+    { NULL, 0 },
+    { "tr", 2, HTML_ELEM_TR },
+    { NULL, 0 },
+    { NULL, 0 },
+    { "sup", 3, HTML_ELEM_SUP },
+};
+
+#endif // _HTML_ELEMENTS_HASH_H_
@@ -0,0 +1,33 @@
+#ifndef _HTML_ENTITIES_H_
+#define _HTML_ENTITIES_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "types.h"
+#include "arena.h"
+
+// Longest reference name there is, not counting the '&'.
+#define HTML_REFERENCE_LONGEST  32
+
+//
+// A node in the named reference trie generated from
+// tools/keys/entities.txt. Besides its first character,
+// a node can stand for a run of characters that always
+// follow it, kept in the tail pool.
+//
+typedef struct {
+    char                    c;
+    byte                    child_count;
+    unsigned short          first_child;    // Children are next to each other, sorted.
+    unsigned short          tail;           // Offset in html_entity_tails.
+    unsigned short          value;          // Offset in html_entity_values, 0 if none.
+} html_entitynode_t;
+
+extern size_t HTML_FindReference(const char* text, size_t len);
+extern slice_t HTML_DecodeReferences(arena_t* arena, char* text, size_t len, size_t from,
+                                        bool attribute);
+extern slice_t HTML_DecodeText(arena_t* arena, const char* text, size_t len, bool copy,
+                                bool attribute);
+
+#endif // _HTML_ENTITIES_H_
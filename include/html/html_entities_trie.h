@@ -0,0 +1,3687 @@
+#ifndef _HTML_ENTITY_TRIE_H_
+#define _HTML_ENTITY_TRIE_H_
+
+// Generated by tools/gen_entity_trie.py, do not edit by hand.
+#define HTML_ENTITY_NODES 3107
+#define HTML_ENTITY_LONGEST 32
+#define HTML_ENTITY_GROWS 2
+
+static const html_entitynode_t html_entity_nodes[HTML_ENTITY_NODES] = {
+    { 0, 52, 1, 0, 0 },
+    { 'A', 16, 53, 0, 0 },
+    { 'B', 8, 69, 0, 0 },
+    { 'C', 14, 77, 0, 0 },
+    { 'D', 11, 91, 0, 0 },
+    { 'E', 16, 102, 0, 0 },
+    { 'F', 5, 118, 0, 0 },
+    { 'G', 12, 123, 0, 0 },
+    { 'H', 8, 135, 0, 0 },
+    { 'I', 14, 143, 0, 0 },
+    { 'J', 5, 157, 0, 0 },
+    { 'K', 7, 162, 0, 0 },
+    { 'L', 11, 169, 0, 0 },
+    { 'M', 8, 180, 0, 0 },
+    { 'N', 9, 188, 0, 0 },
+    { 'O', 14, 197, 0, 0 },
+    { 'P', 9, 211, 0, 0 },
+    { 'Q', 4, 220, 0, 0 },
+    { 'R', 12, 224, 0, 0 },
+    { 'S', 13, 236, 0, 0 },
+    { 'T', 11, 249, 0, 0 },
+    { 'U', 14, 260, 0, 0 },
+    { 'V', 9, 274, 0, 0 },
+    { 'W', 5, 283, 0, 0 },
+    { 'X', 4, 288, 0, 0 },
+    { 'Y', 9, 292, 0, 0 },
+    { 'Z', 8, 301, 0, 0 },
+    { 'a', 16, 309, 0, 0 },
+    { 'b', 16, 325, 0, 0 },
+    { 'c', 15, 341, 0, 0 },
+    { 'd', 19, 356, 0, 0 },
+    { 'e', 18, 375, 0, 0 },
+    { 'f', 12, 393, 0, 0 },
+    { 'g', 17, 405, 0, 0 },
+    { 'h', 10, 422, 0, 0 },
+    { 'i', 15, 432, 0, 0 },
+    { 'j', 6, 447, 0, 0 },
+    { 'k', 8, 453, 0, 0 },
+    { 'l', 23, 461, 0, 0 },
+    { 'm', 14, 484, 0, 0 },
+    { 'n', 24, 498, 0, 0 },
+    { 'o', 18, 522, 0, 0 },
+    { 'p', 12, 540, 0, 0 },
+    { 'q', 6, 552, 0, 0 },
+    { 'r', 21, 558, 0, 0 },
+    { 's', 19, 579, 0, 0 },
+    { 't', 13, 598, 0, 0 },
+    { 'u', 18, 611, 0, 0 },
+    { 'v', 15, 629, 0, 0 },
+    { 'w', 7, 644, 0, 0 },
+    { 'x', 14, 651, 0, 0 },
+    { 'y', 8, 665, 0, 0 },
+    { 'z', 10, 673, 0, 0 },
+    { 'E', 1, 683, 1, 1 },
+    { 'M', 1, 684, 5, 4 },
+    { 'a', 1, 685, 7, 6 },
+    { 'b', 0, 0, 12, 9 },
+    { 'c', 2, 686, 0, 0 },
+    { 'f', 0, 0, 18, 12 },
+    { 'g', 1, 688, 21, 17 },
+    { 'l', 0, 0, 26, 20 },
+    { 'm', 0, 0, 31, 23 },
+    { 'n', 0, 0, 36, 26 },
+    { 'o', 2, 689, 0, 0 },
+    { 'p', 0, 0, 39, 30 },
+    { 'r', 1, 691, 52, 34 },
+    { 's', 2, 692, 0, 0 },
+    { 't', 1, 694, 56, 37 },
+    { 'u', 1, 695, 61, 40 },
+    { 'a', 2, 696, 0, 0 },
+    { 'c', 0, 0, 64, 43 },
+    { 'e', 3, 698, 0, 0 },
+    { 'f', 0, 0, 18, 46 },
+    { 'o', 0, 0, 67, 51 },
+    { 'r', 0, 0, 71, 56 },
+    { 's', 0, 0, 76, 59 },
+    { 'u', 0, 0, 80, 63 },
+    { 'H', 0, 0, 86, 67 },
+    { 'O', 1, 701, 90, 70 },
+    { 'a', 3, 702, 0, 0 },
+    { 'c', 4, 705, 0, 0 },
+    { 'd', 0, 0, 93, 73 },
+    { 'e', 2, 709, 0, 0 },
+    { 'f', 0, 0, 18, 76 },
+    { 'h', 0, 0, 97, 80 },
+    { 'i', 4, 711, 100, 0 },
+    { 'l', 2, 715, 105, 0 },
+    { 'o', 4, 717, 0, 0 },
+    { 'r', 0, 0, 107, 83 },
+    { 's', 0, 0, 76, 87 },
+    { 'u', 2, 721, 112, 0 },
+    { 'D', 2, 723, 0, 0 },
+    { 'J', 0, 0, 86, 92 },
+    { 'S', 0, 0, 86, 95 },
+    { 'Z', 0, 0, 86, 98 },
+    { 'a', 3, 725, 0, 0 },
+    { 'c', 2, 728, 0, 0 },
+    { 'e', 2, 730, 114, 0 },
+    { 'f', 0, 0, 18, 101 },
+    { 'i', 2, 732, 0, 0 },
+    { 'o', 4, 734, 0, 0 },
+    { 's', 2, 738, 0, 0 },
+    { 'N', 0, 0, 116, 106 },
+    { 'T', 1, 740, 119, 109 },
+    { 'a', 1, 741, 7, 112 },
+    { 'c', 3, 742, 0, 0 },
+    { 'd', 0, 0, 93, 115 },
+    { 'f', 0, 0, 18, 118 },
+    { 'g', 1, 745, 21, 123 },
+    { 'l', 0, 0, 121, 126 },
+    { 'm', 2, 746, 0, 0 },
+    { 'o', 2, 748, 0, 0 },
+    { 'p', 0, 0, 128, 130 },
+    { 'q', 2, 750, 135, 0 },
+    { 's', 2, 752, 0, 0 },
+    { 't', 0, 0, 137, 133 },
+    { 'u', 1, 754, 61, 136 },
+    { 'x', 2, 755, 0, 0 },
+    { 'c', 0, 0, 64, 139 },
+    { 'f', 0, 0, 18, 142 },
+    { 'i', 2, 757, 140, 0 },
+    { 'o', 3, 759, 0, 0 },
+    { 's', 0, 0, 76, 147 },
+    { 'J', 0, 0, 86, 151 },
+    { 'T', 1, 762, 0, 154 },
+    { 'a', 2, 763, 145, 0 },
+    { 'b', 0, 0, 12, 156 },
+    { 'c', 3, 765, 0, 0 },
+    { 'd', 0, 0, 93, 159 },
+    { 'f', 0, 0, 18, 162 },
+    { 'g', 0, 0, 149, 167 },
+    { 'o', 0, 0, 67, 171 },
+    { 'r', 6, 768, 151, 0 },
+    { 's', 0, 0, 76, 176 },
+    { 't', 0, 0, 149, 181 },
+    { 'A', 0, 0, 157, 185 },
+    { 'a', 2, 774, 0, 0 },
+    { 'c', 0, 0, 163, 188 },
+    { 'f', 0, 0, 18, 191 },
+    { 'i', 0, 0, 168, 195 },
+    { 'o', 2, 776, 0, 0 },
+    { 's', 2, 778, 0, 0 },
+    { 'u', 2, 780, 180, 0 },
+    { 'E', 0, 0, 86, 199 },
+    { 'J', 0, 0, 183, 202 },
+    { 'O', 0, 0, 86, 205 },
+    { 'a', 1, 782, 7, 208 },
+    { 'c', 2, 783, 0, 0 },
+    { 'd', 0, 0, 93, 211 },
+    { 'f', 0, 0, 18, 214 },
+    { 'g', 1, 785, 21, 218 },
+    { 'm', 3, 786, 0, 0 },
+    { 'n', 2, 789, 0, 0 },
+    { 'o', 3, 791, 0, 0 },
+    { 's', 0, 0, 76, 221 },
+    { 't', 0, 0, 188, 225 },
+    { 'u', 2, 794, 0, 0 },
+    { 'c', 2, 796, 0, 0 },
+    { 'f', 0, 0, 18, 228 },
+    { 'o', 0, 0, 67, 233 },
+    { 's', 2, 798, 0, 0 },
+    { 'u', 0, 0, 194, 238 },
+    { 'H', 0, 0, 86, 241 },
+    { 'J', 0, 0, 86, 244 },
+    { 'a', 0, 0, 199, 247 },
+    { 'c', 2, 800, 0, 0 },
+    { 'f', 0, 0, 18, 250 },
+    { 'o', 0, 0, 67, 255 },
+    { 's', 0, 0, 76, 260 },
+    { 'J', 0, 0, 86, 265 },
+    { 'T', 1, 802, 0, 268 },
+    { 'a', 5, 803, 0, 0 },
+    { 'c', 3, 808, 0, 0 },
+    { 'e', 2, 811, 0, 0 },
+    { 'f', 0, 0, 18, 270 },
+    { 'l', 2, 813, 0, 0 },
+    { 'm', 0, 0, 204, 275 },
+    { 'o', 3, 815, 0, 0 },
+    { 's', 3, 818, 0, 0 },
+    { 't', 0, 0, 149, 278 },
+    { 'a', 0, 0, 210, 282 },
+    { 'c', 0, 0, 64, 286 },
+    { 'e', 2, 821, 0, 0 },
+    { 'f', 0, 0, 18, 289 },
+    { 'i', 0, 0, 213, 294 },
+    { 'o', 0, 0, 67, 298 },
+    { 's', 0, 0, 76, 303 },
+    { 'u', 0, 0, 149, 307 },
+    { 'J', 0, 0, 86, 310 },
+    { 'a', 0, 0, 222, 313 },
+    { 'c', 3, 823, 0, 0 },
+    { 'e', 3, 826, 0, 0 },
+    { 'f', 0, 0, 18, 316 },
+    { 'o', 4, 829, 0, 0 },
+    { 's', 0, 0, 76, 321 },
+    { 't', 1, 833, 56, 326 },
+    { 'u', 0, 0, 149, 329 },
+    { 'E', 0, 0, 183, 332 },
+    { 'a', 1, 834, 7, 335 },
+    { 'c', 2, 835, 0, 0 },
+    { 'd', 0, 0, 228, 338 },
+    { 'f', 0, 0, 18, 341 },
+    { 'g', 1, 837, 21, 346 },
+    { 'm', 3, 838, 0, 0 },
+    { 'o', 0, 0, 67, 349 },
+    { 'p', 2, 841, 234, 0 },
+    { 'r', 0, 0, 149, 354 },
+    { 's', 2, 843, 0, 0 },
+    { 't', 2, 845, 242, 0 },
+    { 'u', 1, 847, 61, 358 },
+    { 'v', 2, 848, 244, 0 },
+    { 'a', 0, 0, 247, 361 },
+    { 'c', 0, 0, 64, 365 },
+    { 'f', 0, 0, 18, 368 },
+    { 'h', 0, 0, 97, 373 },
+    { 'i', 0, 0, 149, 376 },
+    { 'l', 0, 0, 255, 379 },
+    { 'o', 2, 850, 0, 0 },
+    { 'r', 4, 852, 0, 0 },
+    { 's', 2, 856, 0, 0 },
+    { 'U', 1, 858, 264, 382 },
+    { 'f', 0, 0, 18, 384 },
+    { 'o', 0, 0, 67, 389 },
+    { 's', 0, 0, 76, 393 },
+    { 'B', 0, 0, 267, 398 },
+    { 'E', 1, 859, 272, 402 },
+    { 'a', 3, 860, 0, 0 },
+    { 'c', 3, 863, 0, 0 },
+    { 'e', 2, 866, 0, 0 },
+    { 'f', 0, 0, 18, 405 },
+    { 'h', 0, 0, 274, 409 },
+    { 'i', 8, 868, 277, 0 },
+    { 'o', 2, 876, 0, 0 },
+    { 'r', 0, 0, 281, 412 },
+    { 's', 2, 878, 0, 0 },
+    { 'u', 0, 0, 292, 416 },
+    { 'H', 2, 880, 0, 0 },
+    { 'O', 0, 0, 303, 420 },
+    { 'a', 0, 0, 222, 423 },
+    { 'c', 5, 882, 0, 0 },
+    { 'f', 0, 0, 18, 426 },
+    { 'h', 4, 887, 309, 0 },
+    { 'i', 0, 0, 313, 431 },
+    { 'm', 0, 0, 318, 434 },
+    { 'o', 0, 0, 67, 438 },
+    { 'q', 2, 891, 0, 0 },
+    { 's', 0, 0, 76, 443 },
+    { 't', 0, 0, 329, 448 },
+    { 'u', 4, 893, 0, 0 },
+    { 'H', 1, 897, 333, 452 },
+    { 'R', 0, 0, 337, 455 },
+    { 'S', 2, 898, 0, 0 },
+    { 'a', 2, 900, 0, 0 },
+    { 'c', 3, 902, 0, 0 },
+    { 'f', 0, 0, 18, 459 },
+    { 'h', 2, 905, 0, 0 },
+    { 'i', 4, 907, 342, 0 },
+    { 'o', 0, 0, 67, 464 },
+    { 'r', 0, 0, 346, 469 },
+    { 's', 2, 911, 0, 0 },
+    { 'a', 2, 913, 0, 0 },
+    { 'b', 2, 915, 355, 0 },
+    { 'c', 2, 917, 0, 0 },
+    { 'd', 0, 0, 228, 473 },
+    { 'f', 0, 0, 18, 476 },
+    { 'g', 1, 919, 21, 481 },
+    { 'm', 0, 0, 31, 484 },
+    { 'n', 2, 920, 0, 0 },
+    { 'o', 2, 922, 0, 0 },
+    { 'p', 8, 924, 0, 0 },
+    { 'r', 0, 0, 357, 487 },
+    { 's', 0, 0, 76, 490 },
+    { 't', 0, 0, 188, 495 },
+    { 'u', 1, 932, 61, 498 },
+    { 'D', 0, 0, 362, 501 },
+    { 'b', 0, 0, 329, 505 },
+    { 'c', 0, 0, 64, 509 },
+    { 'd', 2, 933, 367, 0 },
+    { 'e', 2, 935, 0, 0 },
+    { 'f', 0, 0, 18, 512 },
+    { 'o', 0, 0, 67, 517 },
+    { 's', 0, 0, 76, 522 },
+    { 'v', 0, 0, 371, 527 },
+    { 'c', 0, 0, 163, 531 },
+    { 'e', 0, 0, 377, 534 },
+    { 'f', 0, 0, 18, 538 },
+    { 'o', 0, 0, 67, 543 },
+    { 's', 0, 0, 76, 548 },
+    { 'f', 0, 0, 18, 553 },
+    { 'i', 0, 0, 149, 558 },
+    { 'o', 0, 0, 67, 561 },
+    { 's', 0, 0, 76, 566 },
+    { 'A', 0, 0, 86, 571 },
+    { 'I', 0, 0, 86, 574 },
+    { 'U', 0, 0, 86, 577 },
+    { 'a', 1, 937, 7, 580 },
+    { 'c', 2, 938, 0, 0 },
+    { 'f', 0, 0, 18, 583 },
+    { 'o', 0, 0, 67, 588 },
+    { 's', 0, 0, 76, 593 },
+    { 'u', 0, 0, 382, 598 },
+    { 'H', 0, 0, 86, 601 },
+    { 'a', 0, 0, 222, 604 },
+    { 'c', 2, 940, 0, 0 },
+    { 'd', 0, 0, 93, 607 },
+    { 'e', 2, 942, 0, 0 },
+    { 'f', 0, 0, 18, 610 },
+    { 'o', 0, 0, 67, 614 },
+    { 's', 0, 0, 76, 618 },
+    { 'a', 1, 944, 7, 623 },
+    { 'b', 0, 0, 12, 626 },
+    { 'c', 6, 945, 0, 0 },
+    { 'e', 1, 951, 1, 629 },
+    { 'f', 2, 952, 0, 0 },
+    { 'g', 1, 954, 21, 632 },
+    { 'l', 2, 955, 0, 0 },
+    { 'm', 2, 957, 0, 0 },
+    { 'n', 2, 959, 0, 0 },
+    { 'o', 2, 961, 0, 0 },
+    { 'p', 7, 963, 0, 0 },
+    { 'r', 1, 970, 52, 635 },
+    { 's', 3, 971, 0, 0 },
+    { 't', 1, 974, 56, 638 },
+    { 'u', 1, 975, 61, 641 },
+    { 'w', 2, 976, 0, 0 },
+    { 'N', 0, 0, 93, 644 },
+    { 'a', 2, 978, 0, 0 },
+    { 'b', 2, 980, 386, 0 },
+    { 'c', 2, 982, 0, 0 },
+    { 'd', 0, 0, 389, 648 },
+    { 'e', 5, 984, 0, 0 },
+    { 'f', 0, 0, 18, 652 },
+    { 'i', 7, 989, 394, 0 },
+    { 'k', 0, 0, 396, 657 },
+    { 'l', 3, 996, 0, 0 },
+    { 'n', 2, 999, 0, 0 },
+    { 'o', 4, 1001, 0, 0 },
+    { 'p', 0, 0, 402, 661 },
+    { 'r', 2, 1005, 0, 0 },
+    { 's', 4, 1007, 0, 0 },
+    { 'u', 2, 1011, 0, 0 },
+    { 'a', 3, 1013, 0, 0 },
+    { 'c', 4, 1016, 0, 0 },
+    { 'd', 0, 0, 93, 665 },
+    { 'e', 3, 1020, 0, 0 },
+    { 'f', 0, 0, 18, 668 },
+    { 'h', 3, 1023, 0, 0 },
+    { 'i', 7, 1026, 355, 0 },
+    { 'l', 2, 1033, 408, 0 },
+    { 'o', 4, 1035, 0, 0 },
+    { 'r', 2, 1039, 0, 0 },
+    { 's', 2, 1041, 0, 0 },
+    { 't', 0, 0, 412, 673 },
+    { 'u', 7, 1043, 0, 0 },
+    { 'w', 2, 1050, 0, 0 },
+    { 'y', 0, 0, 417, 677 },
+    { 'A', 0, 0, 423, 681 },
+    { 'H', 0, 0, 329, 685 },
+    { 'a', 4, 1052, 0, 0 },
+    { 'b', 2, 1056, 0, 0 },
+    { 'c', 2, 1058, 0, 0 },
+    { 'd', 3, 1060, 0, 0 },
+    { 'e', 3, 1063, 0, 0 },
+    { 'f', 2, 1066, 0, 0 },
+    { 'h', 2, 1068, 427, 0 },
+    { 'i', 5, 1070, 0, 0 },
+    { 'j', 0, 0, 86, 689 },
+    { 'l', 2, 1075, 430, 0 },
+    { 'o', 5, 1077, 0, 0 },
+    { 'r', 2, 1082, 0, 0 },
+    { 's', 3, 1084, 0, 0 },
+    { 't', 2, 1087, 0, 0 },
+    { 'u', 2, 1089, 0, 0 },
+    { 'w', 0, 0, 432, 692 },
+    { 'z', 2, 1091, 0, 0 },
+    { 'D', 2, 1093, 0, 0 },
+    { 'a', 2, 1095, 0, 0 },
+    { 'c', 4, 1097, 0, 0 },
+    { 'd', 0, 0, 93, 696 },
+    { 'e', 0, 0, 149, 699 },
+    { 'f', 2, 1101, 0, 0 },
+    { 'g', 3, 1103, 0, 0 },
+    { 'l', 4, 1106, 0, 0 },
+    { 'm', 3, 1110, 0, 0 },
+    { 'n', 2, 1113, 0, 0 },
+    { 'o', 2, 1115, 0, 0 },
+    { 'p', 3, 1117, 0, 0 },
+    { 'q', 4, 1120, 0, 0 },
+    { 'r', 2, 1124, 0, 0 },
+    { 's', 3, 1126, 0, 0 },
+    { 't', 2, 1129, 0, 0 },
+    { 'u', 2, 1131, 0, 0 },
+    { 'x', 3, 1133, 0, 0 },
+    { 'a', 0, 0, 439, 703 },
+    { 'c', 0, 0, 64, 707 },
+    { 'e', 0, 0, 452, 710 },
+    { 'f', 3, 1136, 0, 0 },
+    { 'i', 0, 0, 183, 714 },
+    { 'j', 0, 0, 183, 718 },
+    { 'l', 3, 1139, 0, 0 },
+    { 'n', 0, 0, 458, 721 },
+    { 'o', 2, 1142, 0, 0 },
+    { 'p', 0, 0, 462, 724 },
+    { 'r', 2, 1144, 0, 0 },
+    { 's', 0, 0, 76, 728 },
+    { 'E', 2, 1146, 0, 0 },
+    { 'a', 3, 1148, 0, 0 },
+    { 'b', 0, 0, 12, 733 },
+    { 'c', 2, 1151, 0, 0 },
+    { 'd', 0, 0, 93, 736 },
+    { 'e', 4, 1153, 0, 0 },
+    { 'f', 0, 0, 18, 739 },
+    { 'g', 2, 1157, 0, 0 },
+    { 'i', 0, 0, 470, 744 },
+    { 'j', 0, 0, 86, 748 },
+    { 'l', 4, 1159, 0, 0 },
+    { 'n', 4, 1163, 0, 0 },
+    { 'o', 0, 0, 67, 751 },
+    { 'r', 0, 0, 475, 756 },
+    { 's', 2, 1167, 0, 0 },
+    { 't', 6, 1169, 0, 154 },
+    { 'v', 2, 1175, 0, 0 },
+    { 'A', 0, 0, 423, 758 },
+    { 'a', 4, 1177, 0, 0 },
+    { 'b', 0, 0, 329, 762 },
+    { 'c', 0, 0, 163, 766 },
+    { 'e', 3, 1181, 0, 0 },
+    { 'f', 0, 0, 18, 769 },
+    { 'k', 2, 1184, 480, 0 },
+    { 'o', 5, 1186, 0, 0 },
+    { 's', 3, 1191, 0, 0 },
+    { 'y', 2, 1194, 0, 0 },
+    { 'a', 1, 1196, 7, 774 },
+    { 'c', 3, 1197, 0, 0 },
+    { 'e', 2, 1200, 0, 0 },
+    { 'f', 2, 1202, 0, 0 },
+    { 'g', 1, 1204, 21, 777 },
+    { 'i', 4, 1205, 0, 0 },
+    { 'j', 0, 0, 183, 780 },
+    { 'm', 3, 1209, 0, 0 },
+    { 'n', 5, 1212, 0, 0 },
+    { 'o', 4, 1217, 0, 0 },
+    { 'p', 0, 0, 482, 783 },
+    { 'q', 1, 1221, 487, 787 },
+    { 's', 2, 1222, 0, 0 },
+    { 't', 2, 1224, 0, 0 },
+    { 'u', 2, 1226, 0, 0 },
+    { 'c', 2, 1228, 0, 0 },
+    { 'f', 0, 0, 18, 790 },
+    { 'm', 0, 0, 492, 795 },
+    { 'o', 0, 0, 67, 798 },
+    { 's', 2, 1230, 0, 0 },
+    { 'u', 0, 0, 194, 803 },
+    { 'a', 2, 1232, 497, 0 },
+    { 'c', 2, 1234, 0, 0 },
+    { 'f', 0, 0, 18, 806 },
+    { 'g', 0, 0, 501, 811 },
+    { 'h', 0, 0, 86, 814 },
+    { 'j', 0, 0, 86, 817 },
+    { 'o', 0, 0, 67, 820 },
+    { 's', 0, 0, 76, 825 },
+    { 'A', 3, 1236, 0, 0 },
+    { 'B', 0, 0, 267, 830 },
+    { 'E', 2, 1239, 0, 0 },
+    { 'H', 0, 0, 329, 834 },
+    { 'a', 9, 1241, 0, 0 },
+    { 'b', 3, 1250, 0, 0 },
+    { 'c', 4, 1253, 0, 0 },
+    { 'd', 4, 1257, 0, 0 },
+    { 'e', 5, 1261, 0, 0 },
+    { 'f', 3, 1266, 0, 0 },
+    { 'g', 2, 1269, 0, 0 },
+    { 'h', 2, 1271, 0, 0 },
+    { 'j', 0, 0, 86, 838 },
+    { 'l', 5, 1273, 0, 0 },
+    { 'm', 2, 1278, 0, 0 },
+    { 'n', 4, 1280, 0, 0 },
+    { 'o', 8, 1284, 0, 0 },
+    { 'p', 2, 1292, 427, 0 },
+    { 'r', 5, 1294, 0, 0 },
+    { 's', 6, 1299, 0, 0 },
+    { 't', 8, 1305, 0, 268 },
+    { 'u', 2, 1313, 355, 0 },
+    { 'v', 2, 1315, 0, 0 },
+    { 'D', 0, 0, 507, 841 },
+    { 'a', 4, 1317, 0, 0 },
+    { 'c', 2, 1321, 0, 0 },
+    { 'd', 0, 0, 362, 845 },
+    { 'e', 0, 0, 512, 849 },
+    { 'f', 0, 0, 18, 853 },
+    { 'h', 0, 0, 274, 858 },
+    { 'i', 3, 1323, 0, 0 },
+    { 'l', 2, 1326, 0, 0 },
+    { 'n', 0, 0, 525, 294 },
+    { 'o', 2, 1328, 0, 0 },
+    { 'p', 0, 0, 149, 294 },
+    { 's', 2, 1330, 0, 0 },
+    { 'u', 3, 1332, 0, 0 },
+    { 'G', 2, 1335, 0, 0 },
+    { 'L', 3, 1337, 0, 0 },
+    { 'R', 0, 0, 281, 862 },
+    { 'V', 2, 1340, 0, 0 },
+    { 'a', 5, 1342, 0, 0 },
+    { 'b', 2, 1347, 0, 0 },
+    { 'c', 5, 1349, 0, 0 },
+    { 'd', 0, 0, 362, 866 },
+    { 'e', 7, 1354, 0, 0 },
+    { 'f', 0, 0, 18, 870 },
+    { 'g', 4, 1361, 0, 0 },
+    { 'h', 3, 1365, 0, 0 },
+    { 'i', 3, 1368, 0, 0 },
+    { 'j', 0, 0, 86, 875 },
+    { 'l', 7, 1371, 0, 0 },
+    { 'm', 0, 0, 531, 878 },
+    { 'o', 2, 1378, 0, 0 },
+    { 'p', 3, 1380, 0, 0 },
+    { 'r', 4, 1383, 0, 0 },
+    { 's', 7, 1387, 0, 0 },
+    { 't', 4, 1394, 0, 0 },
+    { 'u', 2, 1398, 0, 0 },
+    { 'v', 9, 1400, 0, 0 },
+    { 'w', 3, 1409, 0, 0 },
+    { 'S', 0, 0, 149, 882 },
+    { 'a', 2, 1412, 0, 0 },
+    { 'c', 2, 1414, 0, 0 },
+    { 'd', 5, 1416, 0, 0 },
+    { 'e', 0, 0, 183, 886 },
+    { 'f', 2, 1421, 0, 0 },
+    { 'g', 3, 1423, 0, 0 },
+    { 'h', 2, 1426, 0, 0 },
+    { 'i', 0, 0, 535, 889 },
+    { 'l', 4, 1428, 0, 0 },
+    { 'm', 3, 1432, 0, 0 },
+    { 'o', 0, 0, 67, 893 },
+    { 'p', 3, 1435, 0, 0 },
+    { 'r', 7, 1438, 0, 0 },
+    { 's', 3, 1445, 0, 0 },
+    { 't', 2, 1448, 242, 0 },
+    { 'u', 1, 1450, 61, 898 },
+    { 'v', 0, 0, 539, 901 },
+    { 'a', 4, 1451, 355, 0 },
+    { 'c', 0, 0, 64, 905 },
+    { 'e', 5, 1455, 355, 0 },
+    { 'f', 0, 0, 18, 908 },
+    { 'h', 3, 1460, 0, 0 },
+    { 'i', 3, 1463, 0, 0 },
+    { 'l', 2, 1466, 0, 0 },
+    { 'm', 0, 0, 149, 379 },
+    { 'o', 3, 1468, 0, 0 },
+    { 'r', 10, 1471, 0, 0 },
+    { 's', 2, 1481, 0, 0 },
+    { 'u', 0, 0, 544, 913 },
+    { 'f', 0, 0, 18, 917 },
+    { 'i', 0, 0, 535, 922 },
+    { 'o', 0, 0, 67, 926 },
+    { 'p', 0, 0, 402, 931 },
+    { 's', 0, 0, 76, 935 },
+    { 'u', 3, 1483, 0, 0 },
+    { 'A', 3, 1486, 0, 0 },
+    { 'B', 0, 0, 267, 940 },
+    { 'H', 0, 0, 329, 944 },
+    { 'a', 7, 1489, 0, 0 },
+    { 'b', 3, 1496, 0, 0 },
+    { 'c', 4, 1499, 0, 0 },
+    { 'd', 4, 1503, 0, 0 },
+    { 'e', 3, 1507, 0, 0 },
+    { 'f', 3, 1510, 0, 0 },
+    { 'h', 2, 1513, 0, 0 },
+    { 'i', 3, 1515, 0, 0 },
+    { 'l', 3, 1518, 0, 0 },
+    { 'm', 2, 1521, 550, 0 },
+    { 'n', 0, 0, 555, 948 },
+    { 'o', 4, 1523, 0, 0 },
+    { 'p', 2, 1527, 0, 0 },
+    { 'r', 0, 0, 267, 952 },
+    { 's', 4, 1529, 0, 0 },
+    { 't', 3, 1533, 0, 0 },
+    { 'u', 0, 0, 560, 956 },
+    { 'x', 0, 0, 149, 960 },
+    { 'a', 0, 0, 222, 964 },
+    { 'b', 0, 0, 389, 967 },
+    { 'c', 10, 1536, 0, 0 },
+    { 'd', 3, 1546, 567, 0 },
+    { 'e', 7, 1549, 0, 0 },
+    { 'f', 2, 1556, 355, 0 },
+    { 'h', 4, 1558, 0, 0 },
+    { 'i', 2, 1562, 0, 0 },
+    { 'l', 0, 0, 267, 971 },
+    { 'm', 4, 1564, 0, 0 },
+    { 'o', 3, 1568, 0, 0 },
+    { 'p', 2, 1571, 570, 0 },
+    { 'q', 3, 1573, 0, 0 },
+    { 'r', 0, 0, 267, 975 },
+    { 's', 4, 1576, 0, 0 },
+    { 't', 2, 1580, 0, 0 },
+    { 'u', 5, 1582, 0, 0 },
+    { 'w', 3, 1587, 0, 0 },
+    { 'z', 1, 1590, 1, 979 },
+    { 'a', 2, 1591, 0, 0 },
+    { 'b', 0, 0, 572, 982 },
+    { 'c', 3, 1593, 0, 0 },
+    { 'd', 0, 0, 93, 469 },
+    { 'e', 0, 0, 576, 986 },
+    { 'f', 0, 0, 18, 990 },
+    { 'h', 4, 1596, 0, 0 },
+    { 'i', 3, 1600, 0, 0 },
+    { 'o', 3, 1603, 0, 0 },
+    { 'p', 0, 0, 402, 995 },
+    { 'r', 3, 1606, 0, 0 },
+    { 's', 3, 1609, 0, 0 },
+    { 'w', 2, 1612, 0, 0 },
+    { 'A', 0, 0, 423, 999 },
+    { 'H', 0, 0, 329, 1003 },
+    { 'a', 2, 1614, 0, 0 },
+    { 'b', 2, 1616, 355, 0 },
+    { 'c', 2, 1618, 0, 0 },
+    { 'd', 3, 1620, 0, 0 },
+    { 'f', 2, 1623, 0, 0 },
+    { 'g', 1, 1625, 21, 1007 },
+    { 'h', 2, 1626, 0, 0 },
+    { 'l', 2, 1628, 0, 0 },
+    { 'm', 2, 1630, 0, 0 },
+    { 'o', 2, 1632, 0, 0 },
+    { 'p', 6, 1634, 0, 0 },
+    { 'r', 3, 1640, 0, 0 },
+    { 's', 0, 0, 76, 1010 },
+    { 't', 3, 1643, 0, 0 },
+    { 'u', 2, 1646, 0, 0 },
+    { 'w', 0, 0, 432, 1015 },
+    { 'A', 0, 0, 423, 1019 },
+    { 'B', 2, 1648, 427, 0 },
+    { 'D', 0, 0, 362, 1023 },
+    { 'a', 2, 1650, 0, 0 },
+    { 'c', 0, 0, 64, 1027 },
+    { 'd', 0, 0, 362, 1030 },
+    { 'e', 3, 1652, 0, 0 },
+    { 'f', 0, 0, 18, 1034 },
+    { 'l', 0, 0, 582, 1039 },
+    { 'n', 2, 1655, 587, 0 },
+    { 'o', 0, 0, 67, 1043 },
+    { 'p', 0, 0, 590, 1048 },
+    { 'r', 0, 0, 582, 1052 },
+    { 's', 2, 1657, 0, 0 },
+    { 'z', 0, 0, 595, 1056 },
+    { 'c', 0, 0, 163, 1060 },
+    { 'e', 2, 1659, 0, 0 },
+    { 'f', 0, 0, 18, 1063 },
+    { 'o', 0, 0, 67, 1068 },
+    { 'p', 0, 0, 149, 1073 },
+    { 'r', 2, 1661, 0, 0 },
+    { 's', 0, 0, 76, 1077 },
+    { 'c', 3, 1663, 0, 0 },
+    { 'd', 0, 0, 582, 1082 },
+    { 'f', 0, 0, 18, 1086 },
+    { 'h', 2, 1666, 0, 0 },
+    { 'i', 0, 0, 149, 1091 },
+    { 'l', 2, 1668, 0, 0 },
+    { 'm', 0, 0, 602, 1094 },
+    { 'n', 0, 0, 606, 1098 },
+    { 'o', 3, 1670, 0, 0 },
+    { 'r', 2, 1673, 0, 0 },
+    { 's', 2, 1675, 0, 0 },
+    { 'u', 2, 1677, 0, 0 },
+    { 'v', 0, 0, 610, 1102 },
+    { 'w', 0, 0, 614, 534 },
+    { 'a', 2, 1679, 430, 0 },
+    { 'c', 2, 1681, 0, 0 },
+    { 'e', 1, 1683, 620, 1106 },
+    { 'f', 0, 0, 18, 1109 },
+    { 'i', 0, 0, 86, 1114 },
+    { 'o', 0, 0, 67, 1117 },
+    { 's', 0, 0, 76, 1122 },
+    { 'u', 2, 1684, 0, 0 },
+    { 'a', 0, 0, 222, 1127 },
+    { 'c', 2, 1686, 0, 0 },
+    { 'd', 0, 0, 93, 1130 },
+    { 'e', 2, 1688, 0, 0 },
+    { 'f', 0, 0, 18, 1133 },
+    { 'h', 0, 0, 86, 1138 },
+    { 'i', 0, 0, 622, 1141 },
+    { 'o', 0, 0, 67, 1145 },
+    { 's', 0, 0, 76, 1150 },
+    { 'w', 2, 1690, 0, 0 },
+    { ';', 0, 0, 0, 1 },
+    { ';', 0, 0, 0, 4 },
+    { ';', 0, 0, 0, 6 },
+    { 'i', 1, 1692, 629, 1155 },
+    { 'y', 0, 0, 149, 1158 },
+    { ';', 0, 0, 0, 17 },
+    { 'g', 0, 0, 632, 1161 },
+    { 'p', 0, 0, 636, 1164 },
+    { ';', 0, 0, 0, 34 },
+    { 'c', 0, 0, 18, 1169 },
+    { 's', 0, 0, 639, 1174 },
+    { ';', 0, 0, 0, 37 },
+    { ';', 0, 0, 0, 40 },
+    { 'c', 0, 0, 644, 1178 },
+    { 'r', 2, 1693, 0, 0 },
+    { 'c', 0, 0, 652, 1182 },
+    { 'r', 0, 0, 658, 59 },
+    { 't', 0, 0, 137, 1186 },
+    { ';', 0, 0, 0, 70 },
+    { 'c', 0, 0, 667, 1189 },
+    { 'p', 2, 1695, 0, 0 },
+    { 'y', 0, 0, 672, 76 },
+    { 'a', 0, 0, 678, 1192 },
+    { 'e', 1, 1697, 683, 1195 },
+    { 'i', 0, 0, 687, 1198 },
+    { 'o', 0, 0, 691, 1201 },
+    { 'd', 0, 0, 697, 1205 },
+    { 'n', 0, 0, 703, 1208 },
+    { 'D', 0, 0, 93, 1211 },
+    { 'M', 0, 0, 711, 1215 },
+    { 'P', 0, 0, 717, 1219 },
+    { 'T', 0, 0, 722, 1223 },
+    { 'c', 0, 0, 728, 1227 },
+    { 's', 2, 1698, 750, 0 },
+    { 'l', 2, 1700, 757, 0 },
+    { 'n', 3, 1702, 0, 0 },
+    { 'p', 2, 1705, 0, 0 },
+    { 'u', 0, 0, 760, 1231 },
+    { ';', 0, 0, 0, 1235 },
+    { 'C', 0, 0, 602, 1239 },
+    { ';', 0, 0, 0, 1243 },
+    { 'o', 0, 0, 790, 1247 },
+    { 'g', 0, 0, 797, 1251 },
+    { 'r', 0, 0, 18, 1255 },
+    { 's', 0, 0, 802, 1259 },
+    { 'a', 0, 0, 678, 1263 },
+    { 'y', 0, 0, 149, 1266 },
+    { ';', 0, 0, 0, 1269 },
+    { 't', 0, 0, 137, 1273 },
+    { 'a', 2, 1707, 0, 0 },
+    { 'f', 0, 0, 806, 1276 },
+    { 'p', 0, 0, 636, 1280 },
+    { 't', 3, 1709, 0, 0 },
+    { 'u', 6, 1712, 818, 0 },
+    { 'w', 6, 1718, 620, 0 },
+    { 'c', 0, 0, 18, 1285 },
+    { 't', 0, 0, 822, 1290 },
+    { ';', 0, 0, 0, 109 },
+    { ';', 0, 0, 0, 112 },
+    { 'a', 0, 0, 678, 1293 },
+    { 'i', 1, 1724, 629, 1296 },
+    { 'y', 0, 0, 149, 1299 },
+    { ';', 0, 0, 0, 123 },
+    { 'a', 0, 0, 76, 1302 },
+    { 'p', 2, 1725, 827, 0 },
+    { 'g', 0, 0, 632, 1305 },
+    { 'p', 0, 0, 636, 1308 },
+    { 'a', 2, 1727, 114, 0 },
+    { 'i', 0, 0, 830, 1313 },
+    { 'c', 0, 0, 18, 1317 },
+    { 'i', 0, 0, 839, 1321 },
+    { ';', 0, 0, 0, 136 },
+    { 'i', 0, 0, 842, 1325 },
+    { 'p', 0, 0, 847, 699 },
+    { 'S', 0, 0, 858, 1329 },
+    { 'V', 0, 0, 870, 1333 },
+    { 'p', 0, 0, 636, 1337 },
+    { 'r', 0, 0, 886, 1342 },
+    { 'u', 0, 0, 891, 147 },
+    { ';', 0, 0, 0, 154 },
+    { ';', 0, 0, 0, 1346 },
+    { 'd', 0, 0, 149, 1349 },
+    { 'e', 0, 0, 900, 1352 },
+    { 'i', 0, 0, 687, 1355 },
+    { 'y', 0, 0, 149, 1358 },
+    { 'E', 2, 1729, 905, 0 },
+    { 'F', 0, 0, 910, 1361 },
+    { 'G', 0, 0, 920, 1365 },
+    { 'L', 0, 0, 928, 1369 },
+    { 'S', 0, 0, 933, 1373 },
+    { 'T', 0, 0, 188, 1377 },
+    { 'c', 0, 0, 944, 1381 },
+    { 't', 0, 0, 149, 1384 },
+    { 'p', 0, 0, 636, 1386 },
+    { 'r', 0, 0, 948, 1390 },
+    { 'c', 0, 0, 18, 195 },
+    { 't', 0, 0, 822, 1394 },
+    { 'D', 0, 0, 961, 63 },
+    { 'E', 0, 0, 970, 1397 },
+    { ';', 0, 0, 0, 208 },
+    { 'i', 1, 1731, 629, 1401 },
+    { 'y', 0, 0, 149, 1404 },
+    { ';', 0, 0, 0, 218 },
+    { ';', 0, 0, 0, 214 },
+    { 'a', 2, 1732, 0, 0 },
+    { 'p', 0, 0, 976, 1407 },
+    { 't', 2, 1734, 0, 0 },
+    { 'v', 2, 1736, 982, 0 },
+    { 'g', 0, 0, 632, 1411 },
+    { 'p', 0, 0, 636, 1414 },
+    { 't', 0, 0, 137, 1419 },
+    { 'k', 0, 0, 86, 1422 },
+    { 'm', 1, 1738, 114, 1425 },
+    { 'i', 0, 0, 687, 1428 },
+    { 'y', 0, 0, 149, 1431 },
+    { 'c', 0, 0, 18, 1434 },
+    { 'e', 0, 0, 989, 1439 },
+    { 'e', 0, 0, 900, 1442 },
+    { 'y', 0, 0, 149, 1445 },
+    { ';', 0, 0, 0, 268 },
+    { 'c', 0, 0, 667, 1448 },
+    { 'm', 0, 0, 994, 1451 },
+    { 'n', 0, 0, 999, 1454 },
+    { 'p', 0, 0, 1002, 1458 },
+    { 'r', 0, 0, 18, 1462 },
+    { 'a', 0, 0, 678, 1466 },
+    { 'e', 0, 0, 900, 1469 },
+    { 'y', 0, 0, 149, 1472 },
+    { 'f', 10, 1739, 1011, 0 },
+    { 's', 6, 1749, 480, 0 },
+    { ';', 0, 0, 0, 1475 },
+    { 'e', 0, 0, 1013, 1479 },
+    { 'n', 4, 1755, 394, 0 },
+    { 'p', 0, 0, 636, 1483 },
+    { 'w', 2, 1759, 244, 0 },
+    { 'c', 0, 0, 18, 1458 },
+    { 'h', 0, 0, 149, 1488 },
+    { 't', 0, 0, 822, 1492 },
+    { 'd', 0, 0, 1022, 1495 },
+    { 'l', 0, 0, 1032, 303 },
+    { 'a', 0, 0, 678, 1499 },
+    { 'e', 0, 0, 900, 1502 },
+    { 'y', 0, 0, 149, 1505 },
+    { 'g', 3, 1761, 1040, 0 },
+    { 's', 2, 1764, 1046, 0 },
+    { 'w', 0, 0, 1050, 1508 },
+    { 'B', 0, 0, 1056, 1510 },
+    { 'n', 0, 0, 1062, 1514 },
+    { 'p', 0, 0, 636, 1517 },
+    { 't', 13, 1766, 0, 0 },
+    { ';', 0, 0, 0, 326 },
+    { ';', 0, 0, 0, 335 },
+    { 'i', 1, 1779, 629, 1521 },
+    { 'y', 0, 0, 149, 1524 },
+    { ';', 0, 0, 0, 346 },
+    { 'a', 0, 0, 76, 1527 },
+    { 'e', 0, 0, 1077, 1530 },
+    { 'i', 0, 0, 1081, 1533 },
+    { 'D', 0, 0, 1087, 1536 },
+    { 'Q', 0, 0, 1099, 1540 },
+    { 'c', 0, 0, 18, 1544 },
+    { 'l', 1, 1780, 367, 1549 },
+    { 'l', 1, 1781, 1105, 1552 },
+    { 'm', 0, 0, 1108, 1555 },
+    { ';', 0, 0, 0, 358 },
+    { 'B', 2, 1782, 0, 0 },
+    { 'P', 0, 0, 1112, 1559 },
+    { 'i', 0, 0, 1124, 191 },
+    { 'p', 0, 0, 636, 1563 },
+    { ';', 0, 0, 0, 1567 },
+    { 'e', 4, 1784, 1136, 0 },
+    { 'i', 0, 0, 1142, 1571 },
+    { 'o', 2, 1788, 0, 0 },
+    { 'c', 0, 0, 18, 1575 },
+    { 'i', 0, 0, 149, 1580 },
+    { ';', 0, 0, 0, 382 },
+    { ';', 0, 0, 0, 402 },
+    { 'c', 0, 0, 667, 1583 },
+    { 'n', 0, 0, 999, 1586 },
+    { 'r', 2, 1790, 355, 0 },
+    { 'a', 0, 0, 678, 1590 },
+    { 'e', 0, 0, 900, 1593 },
+    { 'y', 0, 0, 149, 1596 },
+    { ';', 0, 0, 0, 405 },
+    { 'v', 2, 1792, 1146, 0 },
+    { 'A', 2, 1794, 0, 0 },
+    { 'C', 0, 0, 1151, 1599 },
+    { 'D', 2, 1796, 105, 0 },
+    { 'F', 0, 0, 1159, 1603 },
+    { 'T', 2, 1798, 0, 0 },
+    { 'U', 3, 1800, 112, 0 },
+    { 'V', 2, 1803, 1165, 0 },
+    { 'a', 0, 0, 1171, 1407 },
+    { 'p', 0, 0, 636, 1607 },
+    { 'u', 0, 0, 1177, 1611 },
+    { 'c', 0, 0, 18, 1615 },
+    { 'h', 0, 0, 149, 1619 },
+    { 'C', 0, 0, 1188, 1623 },
+    { 'c', 0, 0, 64, 1626 },
+    { ';', 0, 0, 0, 1629 },
+    { 'a', 0, 0, 678, 1633 },
+    { 'e', 0, 0, 900, 1636 },
+    { 'i', 0, 0, 687, 1639 },
+    { 'y', 0, 0, 149, 1642 },
+    { 'D', 0, 0, 1193, 1645 },
+    { 'L', 0, 0, 1203, 971 },
+    { 'R', 0, 0, 1213, 975 },
+    { 'U', 0, 0, 1224, 1649 },
+    { 'r', 0, 0, 1232, 1653 },
+    { 'u', 4, 1805, 1235, 0 },
+    { 'b', 2, 1809, 0, 0 },
+    { 'c', 2, 1811, 0, 0 },
+    { 'm', 0, 0, 149, 1657 },
+    { 'p', 3, 1813, 0, 0 },
+    { ';', 0, 0, 0, 452 },
+    { 'H', 0, 0, 86, 1661 },
+    { 'c', 0, 0, 64, 1664 },
+    { 'b', 0, 0, 149, 1667 },
+    { 'u', 0, 0, 149, 1669 },
+    { 'a', 0, 0, 678, 1672 },
+    { 'e', 0, 0, 900, 1675 },
+    { 'y', 0, 0, 149, 1678 },
+    { 'e', 2, 1816, 0, 0 },
+    { 'i', 2, 1818, 0, 0 },
+    { ';', 0, 0, 0, 1681 },
+    { 'E', 0, 0, 970, 1685 },
+    { 'F', 0, 0, 910, 1689 },
+    { 'T', 0, 0, 188, 1693 },
+    { 'c', 0, 0, 18, 1697 },
+    { 't', 0, 0, 822, 1702 },
+    { 'c', 1, 1820, 1239, 1705 },
+    { 'r', 2, 1821, 355, 0 },
+    { 'c', 0, 0, 64, 1708 },
+    { 'e', 0, 0, 1243, 1711 },
+    { 'i', 1, 1823, 629, 1714 },
+    { 'y', 0, 0, 149, 1717 },
+    { ';', 0, 0, 0, 481 },
+    { 'd', 2, 1824, 244, 0 },
+    { 'i', 2, 1826, 757, 0 },
+    { 'g', 0, 0, 632, 1720 },
+    { 'p', 0, 0, 636, 1723 },
+    { 'A', 3, 1828, 1247, 0 },
+    { 'D', 0, 0, 1193, 1728 },
+    { 'E', 0, 0, 1252, 1732 },
+    { 'T', 2, 1831, 1264, 0 },
+    { 'a', 0, 0, 1171, 999 },
+    { 'd', 0, 0, 1267, 1019 },
+    { 'p', 2, 1833, 244, 0 },
+    { 's', 2, 1835, 242, 0 },
+    { ';', 0, 0, 0, 498 },
+    { ';', 0, 0, 0, 1736 },
+    { 'l', 0, 0, 149, 1740 },
+    { 'e', 0, 0, 149, 1102 },
+    { 'r', 3, 1837, 0, 0 },
+    { ';', 0, 0, 0, 580 },
+    { 'i', 0, 0, 687, 1744 },
+    { 'y', 0, 0, 149, 1747 },
+    { 'a', 0, 0, 678, 1750 },
+    { 'y', 0, 0, 149, 1753 },
+    { 'r', 0, 0, 1277, 1756 },
+    { 't', 0, 0, 137, 1760 },
+    { ';', 0, 0, 0, 623 },
+    { ';', 0, 0, 0, 1763 },
+    { 'E', 0, 0, 149, 1767 },
+    { 'd', 0, 0, 149, 1773 },
+    { 'i', 1, 1840, 629, 1777 },
+    { 'u', 1, 1841, 1290, 1780 },
+    { 'y', 0, 0, 149, 1783 },
+    { ';', 0, 0, 0, 629 },
+    { ';', 0, 0, 0, 30 },
+    { 'r', 0, 0, 149, 1786 },
+    { ';', 0, 0, 0, 632 },
+    { 'e', 2, 1842, 0, 0 },
+    { 'p', 0, 0, 1293, 1791 },
+    { 'a', 2, 1844, 0, 0 },
+    { 'p', 1, 1846, 0, 4 },
+    { 'd', 5, 1847, 0, 0 },
+    { 'g', 7, 1852, 0, 0 },
+    { 'g', 0, 0, 632, 1794 },
+    { 'p', 0, 0, 636, 1797 },
+    { ';', 0, 0, 0, 1693 },
+    { 'E', 0, 0, 149, 1802 },
+    { 'a', 0, 0, 1297, 1806 },
+    { 'e', 0, 0, 149, 1810 },
+    { 'i', 0, 0, 36, 1814 },
+    { 'o', 0, 0, 1302, 1818 },
+    { 'p', 2, 1859, 1305, 0 },
+    { ';', 0, 0, 0, 635 },
+    { 'c', 0, 0, 18, 1820 },
+    { 't', 0, 0, 149, 1825 },
+    { 'y', 2, 1861, 180, 0 },
+    { ';', 0, 0, 0, 638 },
+    { ';', 0, 0, 0, 641 },
+    { 'c', 0, 0, 1309, 1231 },
+    { 'i', 0, 0, 535, 1827 },
+    { 'c', 4, 1863, 1316, 0 },
+    { 'r', 2, 1867, 0, 0 },
+    { ';', 0, 0, 0, 1831 },
+    { 't', 0, 0, 1318, 1835 },
+    { 'o', 0, 0, 1323, 1839 },
+    { 'y', 0, 0, 149, 1843 },
+    { 'c', 2, 1869, 1327, 0 },
+    { 'm', 0, 0, 1331, 1846 },
+    { 'p', 0, 0, 1337, 1850 },
+    { 'r', 0, 0, 1341, 59 },
+    { 't', 3, 1871, 0, 0 },
+    { 'c', 3, 1874, 0, 0 },
+    { 'o', 3, 1877, 0, 0 },
+    { 's', 2, 1880, 0, 0 },
+    { 't', 2, 1882, 1346, 0 },
+    { 'u', 0, 0, 525, 1853 },
+    { 'v', 0, 0, 610, 1102 },
+    { 'w', 0, 0, 614, 534 },
+    { 'a', 2, 1884, 0, 0 },
+    { 'k', 2, 1886, 0, 0 },
+    { 'o', 0, 0, 1354, 1857 },
+    { 'e', 2, 1888, 0, 0 },
+    { 'o', 0, 0, 1232, 1861 },
+    { 'p', 0, 0, 636, 1865 },
+    { 't', 2, 1890, 0, 0 },
+    { 'w', 0, 0, 1358, 1870 },
+    { 'x', 12, 1892, 0, 0 },
+    { 'e', 0, 0, 1243, 56 },
+    { 'v', 1, 1904, 1363, 1874 },
+    { 'c', 0, 0, 18, 1877 },
+    { 'e', 0, 0, 1367, 1882 },
+    { 'i', 2, 1905, 1371, 0 },
+    { 'o', 3, 1907, 114, 0 },
+    { 'l', 2, 1910, 114, 0 },
+    { 'm', 3, 1912, 112, 0 },
+    { 'c', 0, 0, 667, 1886 },
+    { 'p', 6, 1915, 0, 0 },
+    { 'r', 2, 1921, 0, 0 },
+    { 'a', 2, 1923, 0, 0 },
+    { 'e', 1, 1925, 683, 1889 },
+    { 'i', 0, 0, 687, 1892 },
+    { 'u', 2, 1926, 1373, 0 },
+    { 'd', 1, 1928, 1376, 1205 },
+    { 'm', 0, 0, 1331, 1895 },
+    { 'n', 2, 1929, 1011, 1899 },
+    { 'c', 0, 0, 64, 1902 },
+    { 'e', 2, 1931, 1379, 0 },
+    { 'i', 0, 0, 149, 1905 },
+    { ';', 0, 0, 0, 1908 },
+    { 'E', 0, 0, 149, 1912 },
+    { 'c', 3, 1933, 0, 0 },
+    { 'e', 0, 0, 149, 1916 },
+    { 'f', 0, 0, 691, 1920 },
+    { 'm', 0, 0, 531, 1924 },
+    { 's', 0, 0, 1297, 1928 },
+    { ';', 0, 0, 0, 1932 },
+    { 'u', 0, 0, 1382, 1932 },
+    { 'l', 2, 1936, 757, 0 },
+    { 'm', 2, 1938, 0, 0 },
+    { 'n', 2, 1940, 0, 0 },
+    { 'p', 3, 1942, 0, 0 },
+    { 'a', 0, 0, 423, 1936 },
+    { 'o', 0, 0, 1386, 1940 },
+    { 'c', 0, 0, 18, 1944 },
+    { 'u', 2, 1945, 0, 0 },
+    { 'd', 2, 1947, 1390, 0 },
+    { 'e', 2, 1949, 0, 0 },
+    { 'l', 2, 1951, 1390, 0 },
+    { 'p', 6, 1953, 0, 0 },
+    { 'r', 4, 1959, 0, 0 },
+    { 'v', 0, 0, 610, 1949 },
+    { 'w', 0, 0, 1394, 1953 },
+    { 'c', 0, 0, 1309, 1227 },
+    { 'i', 0, 0, 535, 1957 },
+    { 'g', 0, 0, 797, 1961 },
+    { 'l', 0, 0, 1398, 1965 },
+    { 'r', 0, 0, 18, 1645 },
+    { 's', 2, 1963, 1403, 0 },
+    { 'k', 0, 0, 396, 940 },
+    { 'l', 0, 0, 1405, 1969 },
+    { 'a', 0, 0, 678, 1972 },
+    { 'y', 0, 0, 149, 1975 },
+    { ';', 0, 0, 0, 1276 },
+    { 'a', 2, 1965, 0, 0 },
+    { 'o', 0, 0, 1409, 1978 },
+    { 'g', 1, 1967, 0, 1982 },
+    { 'l', 0, 0, 1415, 1985 },
+    { 'm', 0, 0, 1331, 1988 },
+    { 'i', 0, 0, 1419, 1992 },
+    { 'r', 0, 0, 149, 1996 },
+    { 'l', 0, 0, 149, 2001 },
+    { 'r', 0, 0, 149, 2005 },
+    { 'a', 3, 1968, 1371, 0 },
+    { 'e', 0, 0, 149, 2009 },
+    { 'g', 0, 0, 1424, 2012 },
+    { 's', 0, 0, 1430, 2015 },
+    { 'v', 3, 1971, 0, 0 },
+    { 'o', 0, 0, 1434, 2019 },
+    { 'r', 0, 0, 1438, 2023 },
+    { 'l', 0, 0, 1442, 2027 },
+    { 'p', 0, 0, 636, 2029 },
+    { 't', 5, 1974, 0, 0 },
+    { 'u', 0, 0, 1447, 2034 },
+    { 'w', 3, 1979, 620, 0 },
+    { 'b', 0, 0, 1460, 398 },
+    { 'c', 2, 1982, 0, 0 },
+    { 'c', 2, 1984, 0, 0 },
+    { 'o', 0, 0, 1467, 2038 },
+    { 't', 0, 0, 822, 2042 },
+    { 'd', 0, 0, 93, 2045 },
+    { 'r', 2, 1986, 242, 0 },
+    { 'a', 0, 0, 423, 2049 },
+    { 'h', 0, 0, 329, 2053 },
+    { 'c', 0, 0, 64, 2057 },
+    { 'i', 0, 0, 622, 2060 },
+    { 'D', 0, 0, 93, 1978 },
+    { 'o', 0, 0, 1232, 2064 },
+    { 'c', 1, 1988, 1239, 2068 },
+    { 's', 0, 0, 1470, 2071 },
+    { 'a', 0, 0, 678, 2075 },
+    { 'i', 2, 1989, 355, 0 },
+    { 'o', 0, 0, 1475, 2078 },
+    { 'y', 0, 0, 149, 2082 },
+    { 'D', 0, 0, 93, 703 },
+    { 'r', 0, 0, 149, 2085 },
+    { ';', 0, 0, 0, 2090 },
+    { 'r', 1, 1991, 1480, 2094 },
+    { 's', 2, 1992, 0, 0 },
+    { ';', 0, 0, 0, 2097 },
+    { 'i', 0, 0, 1484, 2101 },
+    { 'l', 0, 0, 149, 2105 },
+    { 's', 2, 1994, 0, 0 },
+    { 'a', 0, 0, 76, 2109 },
+    { 'p', 3, 1996, 827, 0 },
+    { 's', 2, 1999, 112, 0 },
+    { 'g', 0, 0, 149, 2112 },
+    { 's', 0, 0, 210, 2115 },
+    { 'g', 0, 0, 632, 2119 },
+    { 'p', 0, 0, 636, 2122 },
+    { 'a', 2, 2001, 355, 0 },
+    { 'l', 0, 0, 1491, 2127 },
+    { 's', 3, 2003, 242, 0 },
+    { 'c', 2, 2006, 0, 0 },
+    { 's', 2, 2008, 0, 0 },
+    { 'u', 3, 2010, 0, 0 },
+    { 'v', 0, 0, 1495, 2131 },
+    { 'D', 0, 0, 93, 2135 },
+    { 'a', 0, 0, 423, 2139 },
+    { 'c', 0, 0, 18, 2143 },
+    { 'd', 0, 0, 93, 2147 },
+    { 'i', 0, 0, 839, 2151 },
+    { 'a', 0, 0, 149, 2155 },
+    { 'h', 1, 2013, 0, 2158 },
+    { 'm', 1, 2014, 114, 2161 },
+    { 'r', 0, 0, 274, 2164 },
+    { 'c', 0, 0, 1467, 2168 },
+    { 'i', 0, 0, 1502, 1325 },
+    { 'p', 2, 2015, 0, 0 },
+    { 'i', 0, 0, 183, 2170 },
+    { 'l', 2, 2017, 0, 0 },
+    { 'r', 0, 0, 149, 2174 },
+    { 'a', 0, 0, 1232, 2179 },
+    { 'l', 0, 0, 1506, 2183 },
+    { 't', 0, 0, 1510, 2187 },
+    { 'p', 0, 0, 636, 2191 },
+    { 'r', 2, 2019, 0, 0 },
+    { 'a', 2, 2021, 0, 0 },
+    { 'o', 0, 0, 1514, 2196 },
+    { ';', 0, 0, 0, 1361 },
+    { 'l', 0, 0, 149, 2200 },
+    { 'c', 0, 0, 667, 2204 },
+    { 'm', 2, 2023, 1518, 0 },
+    { 'p', 0, 0, 149, 2207 },
+    { 'i', 0, 0, 687, 2211 },
+    { 'y', 0, 0, 149, 2214 },
+    { ';', 0, 0, 0, 2217 },
+    { 'l', 0, 0, 149, 2221 },
+    { 'q', 3, 2025, 0, 0 },
+    { 's', 4, 2028, 0, 0 },
+    { ';', 0, 0, 0, 181 },
+    { 'g', 0, 0, 149, 167 },
+    { ';', 0, 0, 0, 1369 },
+    { 'E', 0, 0, 149, 2225 },
+    { 'a', 0, 0, 149, 2229 },
+    { 'j', 0, 0, 149, 2233 },
+    { 'E', 0, 0, 149, 2237 },
+    { 'a', 2, 2032, 112, 0 },
+    { 'e', 2, 2034, 0, 0 },
+    { 's', 0, 0, 1521, 2241 },
+    { 'c', 0, 0, 18, 2245 },
+    { 'i', 3, 2036, 1371, 0 },
+    { ';', 0, 0, 0, 154 },
+    { 'c', 2, 2039, 0, 0 },
+    { 'd', 0, 0, 93, 2249 },
+    { 'l', 0, 0, 1525, 2253 },
+    { 'q', 0, 0, 1530, 2257 },
+    { 'r', 5, 2041, 0, 0 },
+    { 'e', 0, 0, 1536, 2261 },
+    { 'n', 0, 0, 1544, 2261 },
+    { 'i', 0, 0, 1547, 2268 },
+    { 'l', 0, 0, 636, 2272 },
+    { 'm', 0, 0, 1552, 195 },
+    { 'r', 2, 2046, 0, 0 },
+    { 'a', 2, 2048, 1557, 0 },
+    { 'l', 0, 0, 1561, 2275 },
+    { 'r', 0, 0, 1566, 2279 },
+    { 'e', 0, 0, 396, 2283 },
+    { 'w', 0, 0, 396, 2287 },
+    { 'a', 0, 0, 423, 2291 },
+    { 'm', 0, 0, 1571, 2295 },
+    { 'o', 2, 2050, 1316, 0 },
+    { 'p', 0, 0, 636, 2299 },
+    { 'r', 0, 0, 539, 2304 },
+    { 'c', 0, 0, 18, 2308 },
+    { 'l', 0, 0, 362, 762 },
+    { 't', 0, 0, 822, 2313 },
+    { 'b', 0, 0, 1576, 2316 },
+    { 'p', 0, 0, 1581, 2320 },
+    { ';', 0, 0, 0, 774 },
+    { ';', 0, 0, 0, 2324 },
+    { 'i', 1, 2052, 629, 2328 },
+    { 'y', 0, 0, 149, 2331 },
+    { 'c', 0, 0, 64, 2334 },
+    { 'x', 1, 2053, 1586, 2337 },
+    { 'f', 0, 0, 149, 758 },
+    { 'r', 0, 0, 149, 2340 },
+    { ';', 0, 0, 0, 777 },
+    { ';', 0, 0, 0, 2345 },
+    { 'i', 2, 2054, 0, 0 },
+    { 'n', 0, 0, 1589, 2349 },
+    { 'o', 0, 0, 1415, 2353 },
+    { 'a', 3, 2056, 0, 0 },
+    { 'o', 0, 0, 636, 2357 },
+    { 'p', 0, 0, 1394, 2361 },
+    { ';', 0, 0, 0, 126 },
+    { 'c', 0, 0, 1594, 2364 },
+    { 'f', 2, 2059, 1599, 0 },
+    { 'o', 0, 0, 412, 2368 },
+    { 't', 5, 2061, 0, 0 },
+    { 'c', 0, 0, 64, 2371 },
+    { 'g', 0, 0, 632, 2374 },
+    { 'p', 0, 0, 636, 2377 },
+    { 't', 0, 0, 137, 2382 },
+    { ';', 0, 0, 0, 787 },
+    { 'c', 0, 0, 18, 2385 },
+    { 'i', 5, 2066, 620, 0 },
+    { ';', 0, 0, 0, 2390 },
+    { 'i', 0, 0, 1602, 2394 },
+    { 'k', 0, 0, 86, 2397 },
+    { 'm', 1, 2071, 114, 2400 },
+    { 'i', 0, 0, 687, 2403 },
+    { 'y', 0, 0, 149, 2406 },
+    { 'c', 0, 0, 18, 2409 },
+    { 'e', 0, 0, 989, 2414 },
+    { ';', 0, 0, 0, 2417 },
+    { 'v', 0, 0, 149, 2420 },
+    { 'e', 0, 0, 900, 2423 },
+    { 'y', 0, 0, 149, 2426 },
+    { 'a', 0, 0, 423, 1479 },
+    { 'r', 0, 0, 18, 2429 },
+    { 't', 0, 0, 1607, 2433 },
+    { ';', 0, 0, 0, 2437 },
+    { 'g', 0, 0, 149, 2441 },
+    { 'c', 0, 0, 667, 2445 },
+    { 'e', 0, 0, 1612, 2448 },
+    { 'g', 0, 0, 1619, 1458 },
+    { 'm', 0, 0, 994, 2452 },
+    { 'n', 3, 2072, 394, 0 },
+    { 'p', 0, 0, 149, 2455 },
+    { 'q', 1, 2075, 1624, 2459 },
+    { 'r', 8, 2076, 355, 0 },
+    { 't', 3, 2084, 0, 0 },
+    { 'a', 0, 0, 423, 2462 },
+    { 'b', 0, 0, 572, 2466 },
+    { 'r', 2, 2087, 0, 0 },
+    { 'a', 0, 0, 678, 2470 },
+    { 'e', 2, 2089, 0, 0 },
+    { 'u', 0, 0, 1627, 2473 },
+    { 'y', 0, 0, 149, 2475 },
+    { 'c', 0, 0, 137, 2478 },
+    { 'q', 2, 2091, 1624, 0 },
+    { 'r', 2, 2093, 0, 0 },
+    { 's', 0, 0, 1630, 2482 },
+    { ';', 0, 0, 0, 2486 },
+    { 'f', 5, 2095, 1011, 0 },
+    { 'g', 0, 0, 149, 2490 },
+    { 'q', 3, 2100, 0, 0 },
+    { 's', 5, 2103, 0, 0 },
+    { 'i', 0, 0, 1419, 2494 },
+    { 'l', 0, 0, 1633, 2498 },
+    { 'r', 0, 0, 149, 2502 },
+    { ';', 0, 0, 0, 2507 },
+    { 'E', 0, 0, 149, 2511 },
+    { 'a', 2, 2108, 355, 0 },
+    { 'b', 0, 0, 1638, 2515 },
+    { ';', 0, 0, 0, 278 },
+    { 'a', 0, 0, 423, 2519 },
+    { 'c', 0, 0, 1642, 2019 },
+    { 'h', 0, 0, 1649, 2523 },
+    { 't', 0, 0, 1654, 2527 },
+    { 'i', 0, 0, 412, 2531 },
+    { 'o', 2, 2110, 1658, 0 },
+    { 'E', 0, 0, 149, 2534 },
+    { 'a', 2, 2112, 112, 0 },
+    { 'e', 2, 2114, 0, 0 },
+    { 's', 0, 0, 1521, 2538 },
+    { 'a', 2, 2116, 0, 0 },
+    { 'b', 0, 0, 572, 2542 },
+    { 'n', 3, 2118, 394, 0 },
+    { 'o', 2, 2121, 1662, 0 },
+    { 'p', 3, 2123, 0, 0 },
+    { 't', 0, 0, 722, 2546 },
+    { 'w', 2, 2126, 0, 0 },
+    { 'z', 3, 2128, 0, 0 },
+    { ';', 0, 0, 0, 2550 },
+    { 'l', 0, 0, 1232, 2552 },
+    { 'a', 0, 0, 423, 2556 },
+    { 'c', 0, 0, 1642, 2560 },
+    { 'h', 2, 2131, 427, 0 },
+    { 'm', 0, 0, 149, 2564 },
+    { 't', 0, 0, 1654, 2568 },
+    { 'a', 0, 0, 389, 2572 },
+    { 'c', 0, 0, 18, 2576 },
+    { 'h', 0, 0, 149, 1488 },
+    { 'i', 3, 2133, 1371, 0 },
+    { 'q', 2, 2136, 0, 0 },
+    { 't', 0, 0, 822, 2581 },
+    { ';', 0, 0, 0, 268 },
+    { 'c', 2, 2138, 0, 0 },
+    { 'd', 0, 0, 93, 2584 },
+    { 'h', 0, 0, 1669, 2588 },
+    { 'i', 0, 0, 1674, 2592 },
+    { 'l', 0, 0, 267, 2596 },
+    { 'q', 0, 0, 1530, 2600 },
+    { 'r', 2, 2140, 0, 0 },
+    { 'd', 0, 0, 1679, 2604 },
+    { 'u', 0, 0, 1685, 2608 },
+    { 'e', 0, 0, 1536, 2612 },
+    { 'n', 0, 0, 1544, 2612 },
+    { 'c', 1, 2142, 355, 2619 },
+    { 'l', 2, 2143, 0, 0 },
+    { 'p', 2, 2145, 0, 0 },
+    { 'r', 0, 0, 1690, 2622 },
+    { 'o', 0, 0, 1695, 2626 },
+    { 'y', 0, 0, 149, 2630 },
+    { 'c', 1, 2147, 1700, 2633 },
+    { 'd', 4, 2148, 0, 0 },
+    { 'n', 3, 2152, 1703, 0 },
+    { 'c', 0, 0, 210, 2636 },
+    { 'd', 0, 0, 18, 2275 },
+    { 'd', 0, 0, 1706, 2640 },
+    { 'p', 0, 0, 636, 2644 },
+    { 'c', 0, 0, 18, 2649 },
+    { 't', 0, 0, 1711, 1763 },
+    { ';', 0, 0, 0, 2654 },
+    { 'l', 0, 0, 1716, 2657 },
+    { 'm', 0, 0, 602, 2657 },
+    { 'g', 0, 0, 149, 2661 },
+    { 't', 2, 2155, 0, 0 },
+    { 'e', 2, 2157, 1723, 0 },
+    { 'l', 0, 0, 149, 2667 },
+    { 't', 2, 2159, 0, 0 },
+    { 'D', 0, 0, 362, 2673 },
+    { 'd', 0, 0, 362, 2677 },
+    { 'b', 0, 0, 1726, 1269 },
+    { 'c', 0, 0, 667, 2681 },
+    { 'n', 0, 0, 999, 2684 },
+    { 'p', 5, 2161, 0, 0 },
+    { 't', 2, 2166, 1730, 0 },
+    { 's', 1, 2168, 112, 1514 },
+    { 'u', 2, 2169, 180, 0 },
+    { 'a', 2, 2171, 0, 0 },
+    { 'e', 0, 0, 900, 2691 },
+    { 'o', 2, 2173, 1733, 0 },
+    { 'u', 0, 0, 210, 2694 },
+    { 'y', 0, 0, 149, 2698 },
+    { ';', 0, 0, 0, 2701 },
+    { 'A', 0, 0, 423, 2705 },
+    { 'a', 2, 2175, 355, 0 },
+    { 'd', 0, 0, 93, 2709 },
+    { 'q', 0, 0, 1736, 2715 },
+    { 's', 2, 2177, 0, 0 },
+    { 'x', 2, 2179, 1741, 0 },
+    { 'E', 0, 0, 149, 2719 },
+    { 'e', 3, 2181, 0, 0 },
+    { 's', 0, 0, 1521, 2725 },
+    { 't', 2, 2184, 0, 0 },
+    { 'A', 0, 0, 423, 2729 },
+    { 'a', 0, 0, 423, 2733 },
+    { 'p', 0, 0, 329, 2737 },
+    { ';', 0, 0, 0, 2741 },
+    { 's', 2, 2186, 0, 0 },
+    { 'v', 0, 0, 149, 2741 },
+    { 'A', 0, 0, 423, 2745 },
+    { 'E', 0, 0, 149, 2749 },
+    { 'a', 0, 0, 423, 2755 },
+    { 'd', 0, 0, 18, 2759 },
+    { 'e', 4, 2188, 0, 0 },
+    { 's', 0, 0, 1521, 2763 },
+    { 't', 2, 2192, 0, 0 },
+    { 'p', 0, 0, 636, 2767 },
+    { 't', 3, 2194, 0, 2772 },
+    { 'a', 4, 2197, 355, 0 },
+    { 'o', 0, 0, 1745, 2775 },
+    { 'r', 3, 2201, 0, 0 },
+    { 'A', 0, 0, 423, 862 },
+    { 'a', 3, 2204, 1751, 0 },
+    { 'i', 0, 0, 1754, 2779 },
+    { 't', 2, 2207, 1764, 0 },
+    { 'c', 4, 2209, 0, 0 },
+    { 'h', 2, 2213, 309, 0 },
+    { 'i', 2, 2215, 1371, 0 },
+    { 'm', 0, 0, 531, 878 },
+    { 'p', 0, 0, 329, 2783 },
+    { 'q', 2, 2217, 587, 0 },
+    { 'u', 3, 2219, 0, 0 },
+    { 'g', 0, 0, 1467, 2787 },
+    { 'i', 1, 2222, 342, 2791 },
+    { 'l', 0, 0, 999, 2794 },
+    { 'r', 2, 2223, 1767, 0 },
+    { ';', 0, 0, 0, 2798 },
+    { 'm', 3, 2225, 0, 0 },
+    { 'D', 0, 0, 362, 2801 },
+    { 'H', 0, 0, 267, 2805 },
+    { 'a', 0, 0, 210, 2809 },
+    { 'd', 0, 0, 362, 2816 },
+    { 'g', 2, 2228, 0, 0 },
+    { 'i', 0, 0, 1774, 2820 },
+    { 'l', 3, 2230, 0, 0 },
+    { 'r', 2, 2233, 0, 0 },
+    { 's', 0, 0, 1521, 2824 },
+    { 'A', 0, 0, 423, 2831 },
+    { 'a', 2, 2235, 355, 0 },
+    { 'n', 0, 0, 1780, 2835 },
+    { 'c', 1, 2237, 1239, 2839 },
+    { 's', 0, 0, 1232, 2842 },
+    { 'i', 2, 2238, 355, 0 },
+    { 'y', 0, 0, 149, 2846 },
+    { 'a', 0, 0, 1785, 2849 },
+    { 'b', 0, 0, 1789, 2853 },
+    { 'i', 0, 0, 1794, 2856 },
+    { 'o', 0, 0, 1232, 1211 },
+    { 's', 0, 0, 1797, 2860 },
+    { 'c', 0, 0, 1802, 2864 },
+    { 'r', 0, 0, 149, 2868 },
+    { 'o', 0, 0, 1806, 2873 },
+    { 'r', 1, 2240, 1480, 2876 },
+    { 't', 0, 0, 149, 2879 },
+    { 'b', 0, 0, 329, 2883 },
+    { 'm', 0, 0, 149, 1530 },
+    { 'a', 0, 0, 423, 2887 },
+    { 'c', 2, 2241, 0, 0 },
+    { 'i', 0, 0, 1809, 2891 },
+    { 't', 0, 0, 149, 2895 },
+    { 'a', 0, 0, 76, 2899 },
+    { 'e', 0, 0, 1077, 2902 },
+    { 'i', 3, 2243, 0, 0 },
+    { 'a', 0, 0, 18, 2905 },
+    { 'e', 0, 0, 1813, 2909 },
+    { 'l', 0, 0, 1491, 1219 },
+    { ';', 0, 0, 0, 2913 },
+    { 'a', 0, 0, 423, 2917 },
+    { 'd', 4, 2246, 0, 0 },
+    { 'i', 0, 0, 1817, 2921 },
+    { 'o', 0, 0, 18, 2925 },
+    { 's', 0, 0, 1822, 2929 },
+    { 'v', 0, 0, 149, 2933 },
+    { 'c', 0, 0, 18, 2937 },
+    { 'l', 1, 2250, 367, 2941 },
+    { 'o', 0, 0, 1467, 2944 },
+    { 'l', 1, 2251, 1105, 2948 },
+    { 'm', 2, 2252, 1828, 0 },
+    { ';', 0, 0, 0, 898 },
+    { ';', 0, 0, 0, 2951 },
+    { 'a', 2, 2254, 0, 2955 },
+    { 's', 2, 2256, 0, 0 },
+    { 't', 0, 0, 149, 361 },
+    { 'c', 0, 0, 535, 2958 },
+    { 'i', 0, 0, 1831, 2960 },
+    { 'm', 0, 0, 1835, 2962 },
+    { 'p', 0, 0, 149, 2966 },
+    { 't', 0, 0, 1839, 2970 },
+    { 'i', 2, 2258, 0, 0 },
+    { 'm', 0, 0, 1844, 303 },
+    { 'o', 0, 0, 1809, 2974 },
+    { ';', 0, 0, 0, 2978 },
+    { 't', 0, 0, 1849, 2981 },
+    { 'v', 0, 0, 149, 2985 },
+    { 'a', 2, 2260, 620, 0 },
+    { 'u', 9, 2262, 480, 0 },
+    { 'i', 0, 0, 1857, 2988 },
+    { 'p', 0, 0, 636, 2992 },
+    { 'u', 1, 2271, 1864, 2997 },
+    { ';', 0, 0, 0, 3000 },
+    { 'E', 0, 0, 149, 3004 },
+    { 'a', 0, 0, 210, 3008 },
+    { 'c', 0, 0, 1867, 3012 },
+    { 'e', 2, 2272, 0, 0 },
+    { 'i', 2, 2274, 1871, 0 },
+    { 'n', 3, 2276, 0, 0 },
+    { 'o', 3, 2279, 0, 0 },
+    { 's', 0, 0, 1521, 3016 },
+    { 'u', 0, 0, 1874, 3020 },
+    { 'c', 0, 0, 18, 3024 },
+    { 'i', 0, 0, 149, 3029 },
+    { 'a', 2, 2282, 1011, 0 },
+    { 'e', 2, 2284, 1879, 0 },
+    { 'o', 1, 2286, 1011, 382 },
+    { 'a', 0, 0, 423, 412 },
+    { 'r', 0, 0, 18, 1407 },
+    { 't', 0, 0, 1607, 3032 },
+    { 'c', 2, 2287, 0, 0 },
+    { 'd', 0, 0, 1882, 1653 },
+    { 'e', 0, 0, 1612, 3036 },
+    { 'n', 4, 2289, 394, 0 },
+    { 'q', 1, 2293, 1624, 3040 },
+    { 'r', 11, 2294, 355, 0 },
+    { 't', 2, 2305, 0, 0 },
+    { 'a', 0, 0, 423, 657 },
+    { 'b', 0, 0, 572, 3043 },
+    { 'r', 2, 2307, 0, 0 },
+    { 'a', 0, 0, 678, 3047 },
+    { 'e', 2, 2309, 0, 0 },
+    { 'u', 0, 0, 1627, 3050 },
+    { 'y', 0, 0, 149, 3052 },
+    { 'c', 0, 0, 137, 3055 },
+    { 'l', 0, 0, 1886, 3059 },
+    { 'q', 2, 2311, 1624, 0 },
+    { 's', 0, 0, 1630, 3063 },
+    { 'a', 4, 2313, 114, 0 },
+    { 'c', 0, 0, 1232, 3067 },
+    { 'g', 1, 2317, 0, 402 },
+    { 'i', 0, 0, 1419, 3071 },
+    { 'l', 0, 0, 1633, 1603 },
+    { 'r', 0, 0, 149, 3075 },
+    { 'a', 2, 2318, 355, 0 },
+    { 'o', 2, 2320, 0, 0 },
+    { 'g', 6, 2322, 1892, 0 },
+    { 'n', 0, 0, 999, 3080 },
+    { 's', 0, 0, 1895, 2135 },
+    { 'a', 0, 0, 423, 3083 },
+    { 'h', 0, 0, 329, 1313 },
+    { 'm', 0, 0, 149, 3087 },
+    { ';', 0, 0, 0, 3091 },
+    { 'a', 0, 0, 1906, 3091 },
+    { 'a', 2, 2328, 0, 0 },
+    { 'b', 0, 0, 572, 3095 },
+    { 'p', 3, 2330, 0, 0 },
+    { 't', 0, 0, 722, 3099 },
+    { 'a', 2, 2333, 355, 0 },
+    { 'p', 0, 0, 1911, 3103 },
+    { 'a', 0, 0, 389, 3107 },
+    { 'c', 0, 0, 18, 3111 },
+    { 'h', 0, 0, 149, 1619 },
+    { 'q', 2, 2335, 0, 0 },
+    { 'h', 0, 0, 1669, 3116 },
+    { 'i', 0, 0, 1674, 3120 },
+    { 'r', 4, 2337, 242, 0 },
+    { ';', 0, 0, 0, 3124 },
+    { 'E', 0, 0, 149, 3128 },
+    { 'a', 2, 2341, 0, 0 },
+    { 'c', 0, 0, 1867, 3132 },
+    { 'e', 2, 2343, 0, 0 },
+    { 'i', 0, 0, 687, 3136 },
+    { 'n', 3, 2345, 0, 0 },
+    { 'p', 0, 0, 1911, 3139 },
+    { 's', 0, 0, 1521, 3143 },
+    { 'y', 0, 0, 149, 3147 },
+    { ';', 0, 0, 0, 3150 },
+    { 'b', 0, 0, 149, 3154 },
+    { 'e', 0, 0, 149, 3158 },
+    { 'A', 0, 0, 423, 3162 },
+    { 'a', 2, 2348, 355, 0 },
+    { 'c', 1, 2350, 1011, 3166 },
+    { 'm', 0, 0, 97, 3169 },
+    { 's', 0, 0, 1918, 3171 },
+    { 't', 2, 2351, 1371, 0 },
+    { 'x', 0, 0, 1232, 3175 },
+    { ';', 0, 0, 0, 3179 },
+    { 'o', 0, 0, 1514, 2196 },
+    { 'a', 0, 0, 1813, 3184 },
+    { 'c', 2, 2353, 0, 0 },
+    { 'o', 2, 2355, 1923, 0 },
+    { 'y', 1, 2357, 0, 3188 },
+    { 'g', 3, 2358, 1518, 0 },
+    { 'm', 8, 2361, 0, 0 },
+    { 'a', 2, 2369, 0, 0 },
+    { 'e', 0, 0, 1495, 3191 },
+    { 'i', 2, 2371, 0, 0 },
+    { 't', 2, 2373, 0, 0 },
+    { 'f', 0, 0, 1926, 3195 },
+    { 'l', 2, 2375, 0, 0 },
+    { 'p', 0, 0, 636, 3198 },
+    { 'd', 2, 2377, 1828, 0 },
+    { 'r', 0, 0, 149, 2951 },
+    { 'c', 2, 2379, 0, 0 },
+    { 's', 2, 2381, 135, 0 },
+    { 'u', 3, 2383, 0, 0 },
+    { 'c', 0, 0, 18, 3203 },
+    { 'e', 0, 0, 1931, 1178 },
+    { 'm', 0, 0, 1936, 3208 },
+    { 't', 0, 0, 1941, 448 },
+    { 'a', 2, 2386, 355, 0 },
+    { 'r', 2, 2388, 0, 0 },
+    { 'b', 9, 2390, 0, 0 },
+    { 'c', 6, 2399, 430, 0 },
+    { 'm', 0, 0, 149, 1657 },
+    { 'n', 0, 0, 999, 3212 },
+    { 'p', 13, 2405, 0, 0 },
+    { 'A', 0, 0, 423, 3216 },
+    { 'a', 2, 2418, 355, 0 },
+    { 'n', 0, 0, 1918, 3220 },
+    { ';', 0, 0, 0, 979 },
+    { 'r', 0, 0, 1946, 3224 },
+    { 'u', 0, 0, 149, 3228 },
+    { 'a', 0, 0, 678, 3231 },
+    { 'e', 0, 0, 900, 3234 },
+    { 'y', 0, 0, 149, 3237 },
+    { 'e', 2, 2420, 0, 0 },
+    { 'i', 2, 2422, 0, 0 },
+    { 'k', 2, 2424, 0, 0 },
+    { 'o', 1, 2426, 1951, 3240 },
+    { 'l', 0, 0, 1954, 3243 },
+    { 'm', 3, 2427, 1828, 3246 },
+    { 'n', 0, 0, 1232, 3249 },
+    { 'e', 0, 0, 137, 3253 },
+    { 'p', 4, 2430, 0, 0 },
+    { 's', 0, 0, 137, 3171 },
+    { 'a', 0, 0, 1954, 455 },
+    { 'i', 7, 2434, 0, 0 },
+    { 'p', 0, 0, 1958, 3257 },
+    { 'c', 2, 2441, 0, 0 },
+    { 'h', 0, 0, 86, 3261 },
+    { 't', 0, 0, 822, 3264 },
+    { 'i', 0, 0, 1965, 3267 },
+    { 'o', 2, 2443, 1969, 0 },
+    { 'c', 1, 2445, 1239, 3271 },
+    { 'r', 0, 0, 18, 1649 },
+    { 'c', 0, 0, 64, 3274 },
+    { 'e', 0, 0, 1243, 3277 },
+    { 'i', 1, 2446, 629, 3280 },
+    { 'y', 0, 0, 149, 3283 },
+    { 'a', 0, 0, 423, 3286 },
+    { 'b', 0, 0, 1789, 3290 },
+    { 'h', 0, 0, 329, 1732 },
+    { 'i', 0, 0, 1419, 3293 },
+    { 'r', 0, 0, 149, 3297 },
+    { ';', 0, 0, 0, 1007 },
+    { 'a', 2, 2447, 355, 0 },
+    { 'b', 0, 0, 1638, 3302 },
+    { 'c', 2, 2449, 0, 0 },
+    { 't', 0, 0, 1654, 3306 },
+    { 'a', 0, 0, 76, 3310 },
+    { 'l', 1, 2451, 0, 2009 },
+    { 'g', 0, 0, 632, 3313 },
+    { 'p', 0, 0, 636, 3316 },
+    { 'a', 0, 0, 1171, 1649 },
+    { 'd', 0, 0, 1267, 1728 },
+    { 'h', 2, 2452, 1974, 0 },
+    { 'l', 0, 0, 1491, 3321 },
+    { 's', 3, 2454, 242, 0 },
+    { 'u', 0, 0, 1981, 3325 },
+    { 'c', 2, 2457, 0, 0 },
+    { 'i', 0, 0, 1323, 3329 },
+    { 't', 0, 0, 1654, 3332 },
+    { 'd', 0, 0, 93, 3336 },
+    { 'i', 0, 0, 1602, 3340 },
+    { 'r', 2, 2459, 242, 0 },
+    { 'a', 0, 0, 423, 3325 },
+    { 'm', 1, 2461, 114, 3343 },
+    { ';', 0, 0, 0, 3346 },
+    { 'v', 0, 0, 149, 3350 },
+    { 'n', 0, 0, 1990, 3354 },
+    { 'r', 7, 2462, 0, 0 },
+    { 'e', 3, 2469, 0, 0 },
+    { 'l', 0, 0, 1561, 3358 },
+    { 'r', 2, 2472, 0, 0 },
+    { 'b', 0, 0, 149, 3362 },
+    { 'p', 0, 0, 149, 3369 },
+    { 'c', 0, 0, 18, 3376 },
+    { 'u', 2, 2474, 0, 0 },
+    { 'd', 2, 2476, 0, 0 },
+    { 'i', 0, 0, 1995, 1073 },
+    { ';', 0, 0, 0, 3381 },
+    { 'e', 0, 0, 492, 3381 },
+    { 'a', 0, 0, 210, 3385 },
+    { 'i', 0, 0, 687, 3389 },
+    { 'u', 0, 0, 210, 3393 },
+    { 'A', 0, 0, 423, 3397 },
+    { 'a', 0, 0, 423, 3401 },
+    { 'A', 0, 0, 423, 3405 },
+    { 'a', 0, 0, 423, 3409 },
+    { 'd', 0, 0, 93, 3413 },
+    { 'p', 2, 2478, 0, 0 },
+    { 't', 0, 0, 2000, 3417 },
+    { 'A', 0, 0, 423, 3421 },
+    { 'a', 0, 0, 423, 3425 },
+    { 'c', 0, 0, 18, 3429 },
+    { 'q', 0, 0, 2005, 3434 },
+    { 'p', 0, 0, 717, 1853 },
+    { 't', 0, 0, 1654, 3438 },
+    { 'u', 1, 2480, 1290, 3442 },
+    { 'y', 0, 0, 149, 3445 },
+    { 'i', 0, 0, 687, 3448 },
+    { 'y', 0, 0, 149, 3451 },
+    { ';', 0, 0, 0, 1106 },
+    { 'c', 0, 0, 64, 3454 },
+    { 'm', 1, 2481, 114, 3457 },
+    { 'a', 0, 0, 678, 3460 },
+    { 'y', 0, 0, 149, 3463 },
+    { 'e', 0, 0, 2010, 610 },
+    { 't', 0, 0, 137, 3466 },
+    { 'j', 0, 0, 149, 3469 },
+    { 'n', 0, 0, 2015, 3473 },
+    { ';', 0, 0, 0, 1155 },
+    { 'v', 0, 0, 149, 3477 },
+    { 'w', 0, 0, 1394, 2034 },
+    { ';', 0, 0, 0, 3481 },
+    { 'i', 0, 0, 2018, 1243 },
+    { ';', 0, 0, 0, 1195 },
+    { 'D', 0, 0, 1087, 3485 },
+    { 'Q', 0, 0, 1099, 3489 },
+    { ';', 0, 0, 0, 3493 },
+    { 'e', 0, 0, 149, 3497 },
+    { 'g', 0, 0, 2036, 3501 },
+    { 'i', 0, 0, 535, 3505 },
+    { 't', 0, 0, 2043, 889 },
+    { 'f', 0, 0, 149, 3509 },
+    { 'r', 0, 0, 2056, 3513 },
+    { 'c', 4, 2482, 2063, 0 },
+    { 'm', 0, 0, 2071, 3517 },
+    { ';', 0, 0, 0, 2009 },
+    { 'D', 0, 0, 93, 3521 },
+    { 'E', 0, 0, 970, 2147 },
+    { 'C', 0, 0, 2076, 3505 },
+    { 'D', 2, 2486, 105, 0 },
+    { 'L', 2, 2488, 0, 0 },
+    { 'R', 2, 2490, 2092, 0 },
+    { 'U', 2, 2492, 112, 0 },
+    { 'V', 0, 0, 2097, 2951 },
+    { 'A', 3, 2494, 1247, 0 },
+    { 'B', 0, 0, 12, 3525 },
+    { 'L', 3, 2497, 2109, 0 },
+    { 'R', 2, 2500, 2092, 0 },
+    { 'T', 2, 2502, 1264, 0 },
+    { 'a', 0, 0, 1171, 681 },
+    { ';', 0, 0, 0, 1296 },
+    { 'S', 0, 0, 858, 3528 },
+    { 'V', 0, 0, 870, 3532 },
+    { ';', 0, 0, 0, 3536 },
+    { 'T', 0, 0, 188, 2151 },
+    { ';', 0, 0, 0, 2217 },
+    { 'L', 0, 0, 928, 2221 },
+    { ';', 0, 0, 0, 1401 },
+    { 'c', 0, 0, 18, 3540 },
+    { 'g', 0, 0, 2113, 2345 },
+    { ';', 0, 0, 0, 3543 },
+    { 'e', 2, 2504, 0, 0 },
+    { 'C', 0, 0, 2121, 2324 },
+    { 'T', 0, 0, 722, 2390 },
+    { ';', 0, 0, 0, 1425 },
+    { 'A', 2, 2506, 0, 0 },
+    { 'C', 0, 0, 1151, 3547 },
+    { 'D', 2, 2508, 105, 0 },
+    { 'F', 0, 0, 1159, 2498 },
+    { 'R', 2, 2510, 2092, 0 },
+    { 'T', 2, 2512, 0, 0 },
+    { 'U', 3, 2514, 112, 0 },
+    { 'V', 2, 2517, 1165, 0 },
+    { 'a', 0, 0, 1171, 2429 },
+    { 'r', 0, 0, 281, 758 },
+    { 'E', 0, 0, 2127, 2490 },
+    { 'F', 0, 0, 910, 2437 },
+    { 'G', 0, 0, 920, 2507 },
+    { 'L', 0, 0, 928, 3551 },
+    { 'S', 0, 0, 933, 3555 },
+    { 'T', 0, 0, 188, 3559 },
+    { 'L', 2, 2519, 2109, 0 },
+    { 'R', 0, 0, 1213, 3425 },
+    { 'l', 2, 2521, 2109, 0 },
+    { 'r', 0, 0, 281, 3421 },
+    { 'L', 0, 0, 1203, 3563 },
+    { 'R', 0, 0, 1213, 3567 },
+    { 'M', 0, 0, 2140, 1756 },
+    { 'T', 2, 2523, 2152, 0 },
+    { 'V', 0, 0, 2155, 1756 },
+    { 'G', 0, 0, 2169, 181 },
+    { 'L', 0, 0, 2184, 278 },
+    { ';', 0, 0, 0, 3571 },
+    { 'C', 2, 2525, 0, 0 },
+    { 'D', 0, 0, 2193, 2783 },
+    { 'E', 3, 2527, 0, 0 },
+    { 'G', 7, 2530, 2211, 0 },
+    { 'H', 2, 2537, 2218, 0 },
+    { 'L', 2, 2539, 2222, 0 },
+    { 'N', 2, 2541, 2224, 0 },
+    { 'P', 3, 2543, 2230, 0 },
+    { 'R', 2, 2546, 0, 0 },
+    { 'S', 2, 2548, 0, 0 },
+    { 'T', 4, 2550, 56, 0 },
+    { 'V', 0, 0, 2097, 878 },
+    { ';', 0, 0, 0, 1521 },
+    { ';', 0, 0, 0, 1549 },
+    { ';', 0, 0, 0, 1552 },
+    { 'a', 0, 0, 18, 2891 },
+    { 'r', 2, 2554, 2238, 0 },
+    { ';', 0, 0, 0, 3000 },
+    { 'E', 0, 0, 970, 3575 },
+    { 'S', 0, 0, 933, 3012 },
+    { 'T', 0, 0, 188, 3016 },
+    { 'd', 0, 0, 2241, 3579 },
+    { 'p', 2, 2556, 2246, 0 },
+    { ';', 0, 0, 0, 3583 },
+    { 't', 0, 0, 1467, 3587 },
+    { 'E', 2, 2558, 0, 0 },
+    { 'U', 0, 0, 2253, 2053 },
+    { 'n', 0, 0, 2267, 3591 },
+    { 'r', 3, 2560, 2279, 0 },
+    { 'u', 0, 0, 2283, 3095 },
+    { 'w', 2, 2563, 620, 0 },
+    { 'e', 3, 2565, 2222, 0 },
+    { 'r', 3, 2568, 1767, 0 },
+    { 'D', 0, 0, 2295, 3595 },
+    { 'T', 0, 0, 2306, 3599 },
+    { 'V', 2, 2571, 1165, 0 },
+    { ';', 0, 0, 0, 3603 },
+    { 'B', 0, 0, 329, 3607 },
+    { ';', 0, 0, 0, 3611 },
+    { 'I', 0, 0, 2316, 3615 },
+    { 'S', 2, 2573, 135, 0 },
+    { 'U', 0, 0, 2329, 3619 },
+    { ';', 0, 0, 0, 3623 },
+    { 's', 2, 2575, 2335, 0 },
+    { 'c', 4, 2577, 2338, 0 },
+    { 'h', 0, 0, 2343, 2741 },
+    { ';', 0, 0, 0, 3627 },
+    { 'e', 2, 2581, 2349, 0 },
+    { 's', 0, 0, 2354, 3627 },
+    { 'r', 0, 0, 2358, 3631 },
+    { 't', 0, 0, 137, 3635 },
+    { 'c', 0, 0, 2365, 3638 },
+    { 'n', 0, 0, 2373, 3645 },
+    { ';', 0, 0, 0, 1705 },
+    { ';', 0, 0, 0, 3649 },
+    { 'o', 0, 0, 1297, 3653 },
+    { ';', 0, 0, 0, 1714 },
+    { 'B', 2, 2583, 0, 0 },
+    { 'P', 0, 0, 1112, 3657 },
+    { ';', 0, 0, 0, 3393 },
+    { 'P', 0, 0, 717, 3321 },
+    { ';', 0, 0, 0, 1649 },
+    { 'B', 0, 0, 329, 3661 },
+    { 'D', 0, 0, 1193, 3286 },
+    { ';', 0, 0, 0, 2966 },
+    { 'A', 0, 0, 1171, 3665 },
+    { 'L', 0, 0, 1203, 3669 },
+    { 'R', 0, 0, 1213, 3673 },
+    { ';', 0, 0, 0, 3677 },
+    { 'l', 0, 0, 632, 3680 },
+    { 'b', 0, 0, 329, 3683 },
+    { 't', 2, 2585, 0, 0 },
+    { 'y', 0, 0, 2380, 2268 },
+    { ';', 0, 0, 0, 1777 },
+    { ';', 0, 0, 0, 1780 },
+    { 'f', 0, 0, 2391, 3687 },
+    { 'p', 0, 0, 1630, 3687 },
+    { 'c', 0, 0, 18, 3691 },
+    { 'l', 0, 0, 999, 3694 },
+    { ';', 0, 0, 0, 4 },
+    { ';', 0, 0, 0, 3698 },
+    { 'a', 0, 0, 2396, 3702 },
+    { 'd', 0, 0, 149, 3706 },
+    { 's', 0, 0, 1822, 3710 },
+    { 'v', 0, 0, 149, 3714 },
+    { ';', 0, 0, 0, 3718 },
+    { 'e', 0, 0, 149, 3722 },
+    { 'l', 0, 0, 2400, 3718 },
+    { 'm', 2, 2587, 2403, 0 },
+    { 'r', 2, 2589, 1011, 0 },
+    { 's', 2, 2591, 0, 0 },
+    { 'z', 0, 0, 267, 3726 },
+    { ';', 0, 0, 0, 1693 },
+    { 'e', 0, 0, 2406, 1810 },
+    { ';', 0, 0, 0, 1693 },
+    { 'e', 0, 0, 2406, 1239 },
+    { 'c', 0, 0, 2409, 1839 },
+    { 'e', 0, 0, 2414, 1850 },
+    { 'p', 0, 0, 402, 661 },
+    { 's', 2, 2593, 2422, 0 },
+    { 'v', 0, 0, 610, 3730 },
+    { 'w', 2, 2595, 2425, 0 },
+    { ';', 0, 0, 0, 1182 },
+    { 'e', 0, 0, 149, 1182 },
+    { 'a', 0, 0, 149, 3734 },
+    { 'h', 0, 0, 149, 3737 },
+    { 'w', 0, 0, 2428, 3267 },
+    { 'a', 0, 0, 210, 3385 },
+    { 'i', 0, 0, 687, 3389 },
+    { 'u', 0, 0, 210, 3393 },
+    { 'd', 0, 0, 93, 3413 },
+    { 'p', 0, 0, 717, 3741 },
+    { 't', 0, 0, 722, 3417 },
+    { 'q', 0, 0, 2005, 3434 },
+    { 't', 0, 0, 329, 3745 },
+    { 'd', 0, 0, 2433, 1082 },
+    { 'u', 0, 0, 210, 3438 },
+    { 'c', 3, 2597, 1316, 0 },
+    { 'n', 0, 0, 2438, 3749 },
+    { '1', 2, 2600, 0, 0 },
+    { '3', 0, 0, 2441, 3753 },
+    { ';', 0, 0, 0, 3757 },
+    { 'q', 0, 0, 1736, 3762 },
+    { ';', 0, 0, 0, 2966 },
+    { 't', 0, 0, 2444, 2966 },
+    { 'D', 4, 2602, 0, 0 },
+    { 'H', 5, 2606, 0, 0 },
+    { 'U', 4, 2611, 0, 0 },
+    { 'V', 7, 2615, 0, 0 },
+    { 'b', 0, 0, 2448, 3769 },
+    { 'd', 4, 2622, 0, 0 },
+    { 'h', 5, 2626, 0, 0 },
+    { 'm', 0, 0, 711, 3773 },
+    { 'p', 0, 0, 717, 3777 },
+    { 't', 0, 0, 722, 3781 },
+    { 'u', 4, 2631, 0, 0 },
+    { 'v', 7, 2635, 0, 0 },
+    { ';', 0, 0, 0, 1874 },
+    { ';', 0, 0, 0, 3785 },
+    { 'e', 0, 0, 149, 3789 },
+    { ';', 0, 0, 0, 3793 },
+    { 'b', 0, 0, 149, 3795 },
+    { 'h', 0, 0, 2452, 3799 },
+    { ';', 0, 0, 0, 3803 },
+    { 'e', 0, 0, 1232, 3803 },
+    { ';', 0, 0, 0, 63 },
+    { 'E', 0, 0, 149, 3807 },
+    { 'e', 2, 2642, 0, 0 },
+    { ';', 0, 0, 0, 3811 },
+    { 'a', 0, 0, 2396, 3815 },
+    { 'b', 0, 0, 2457, 3819 },
+    { 'c', 2, 2644, 0, 0 },
+    { 'd', 0, 0, 93, 3823 },
+    { 's', 0, 0, 149, 3827 },
+    { 'e', 0, 0, 1232, 3834 },
+    { 'o', 0, 0, 1806, 1381 },
+    { 'p', 0, 0, 1302, 3838 },
+    { 'r', 0, 0, 632, 3842 },
+    { ';', 0, 0, 0, 1889 },
+    { ';', 0, 0, 0, 3845 },
+    { 's', 0, 0, 839, 3849 },
+    { ';', 0, 0, 0, 1205 },
+    { ';', 0, 0, 0, 1899 },
+    { 'e', 0, 0, 2463, 1208 },
+    { ';', 0, 0, 0, 3853 },
+    { 'm', 0, 0, 2469, 3853 },
+    { ';', 0, 0, 0, 3857 },
+    { 'e', 0, 0, 2406, 1916 },
+    { 'l', 2, 2646, 2222, 0 },
+    { ';', 0, 0, 0, 3860 },
+    { 'e', 2, 2648, 0, 0 },
+    { 'm', 2, 2650, 570, 0 },
+    { 'p', 3, 2652, 0, 0 },
+    { 'g', 2, 2655, 0, 0 },
+    { 'i', 0, 0, 535, 889 },
+    { 'f', 0, 0, 149, 3862 },
+    { 'r', 0, 0, 1831, 3513 },
+    { 'y', 2, 2657, 0, 70 },
+    { 'b', 2, 2659, 0, 0 },
+    { 'p', 2, 2661, 0, 0 },
+    { 'l', 0, 0, 149, 3867 },
+    { 'r', 0, 0, 149, 3871 },
+    { 'p', 0, 0, 18, 3875 },
+    { 's', 0, 0, 2474, 3879 },
+    { ';', 0, 0, 0, 3883 },
+    { 'p', 0, 0, 149, 3887 },
+    { ';', 0, 0, 0, 3891 },
+    { 'b', 0, 0, 2477, 3895 },
+    { 'c', 2, 2663, 0, 0 },
+    { 'd', 0, 0, 93, 3899 },
+    { 'o', 0, 0, 18, 3903 },
+    { 's', 0, 0, 149, 3907 },
+    { 'a', 2, 2665, 1751, 0 },
+    { 'l', 3, 2667, 2483, 0 },
+    { 'r', 1, 2670, 2485, 3914 },
+    { 'v', 2, 2671, 2488, 0 },
+    { ';', 0, 0, 0, 2320 },
+    { 'v', 0, 0, 149, 3917 },
+    { 'g', 0, 0, 797, 1251 },
+    { 'r', 0, 0, 18, 3921 },
+    { ';', 0, 0, 0, 1982 },
+    { ';', 0, 0, 0, 3517 },
+    { 'o', 2, 2673, 1864, 0 },
+    { 's', 0, 0, 149, 3925 },
+    { ';', 0, 0, 0, 3929 },
+    { 'i', 2, 2675, 1105, 3929 },
+    { 'o', 0, 0, 2495, 3932 },
+    { ';', 0, 0, 0, 3936 },
+    { 'e', 2, 2677, 2499, 0 },
+    { 'm', 0, 0, 711, 3939 },
+    { 'p', 0, 0, 717, 3943 },
+    { 's', 0, 0, 2501, 3154 },
+    { 'a', 0, 0, 1171, 1645 },
+    { 'd', 0, 0, 2508, 3921 },
+    { 'h', 2, 2679, 1974, 0 },
+    { 'o', 0, 0, 1434, 2560 },
+    { 'r', 0, 0, 1438, 3947 },
+    { 'r', 0, 0, 149, 3951 },
+    { 'y', 0, 0, 149, 3956 },
+    { ';', 0, 0, 0, 3959 },
+    { 'f', 0, 0, 149, 3963 },
+    { ';', 0, 0, 0, 2068 },
+    { ';', 0, 0, 0, 3967 },
+    { 'c', 1, 2681, 0, 3971 },
+    { ';', 0, 0, 0, 2094 },
+    { ';', 0, 0, 0, 3974 },
+    { 'd', 0, 0, 93, 3978 },
+    { ';', 0, 0, 0, 3982 },
+    { 'd', 0, 0, 93, 3986 },
+    { ';', 0, 0, 0, 3990 },
+    { 's', 0, 0, 2354, 3990 },
+    { 'v', 0, 0, 149, 3990 },
+    { '1', 2, 2682, 0, 0 },
+    { ';', 0, 0, 0, 3994 },
+    { ';', 0, 0, 0, 3998 },
+    { 's', 0, 0, 1467, 4002 },
+    { ';', 0, 0, 0, 4006 },
+    { 'l', 0, 0, 632, 4006 },
+    { 'v', 0, 0, 149, 4009 },
+    { 'i', 0, 0, 687, 3967 },
+    { 'o', 0, 0, 1475, 2078 },
+    { 'i', 0, 0, 839, 2151 },
+    { 'l', 2, 2684, 2519, 0 },
+    { 'a', 0, 0, 2523, 4012 },
+    { 'e', 0, 0, 1502, 4014 },
+    { 'i', 2, 2686, 2527, 0 },
+    { ';', 0, 0, 0, 2158 },
+    { ';', 0, 0, 0, 2161 },
+    { 'e', 0, 0, 2529, 1317 },
+    { 'o', 0, 0, 2538, 699 },
+    { 'i', 0, 0, 999, 4018 },
+    { 'l', 0, 0, 1506, 4022 },
+    { 'a', 0, 0, 2548, 1342 },
+    { 'k', 2, 2688, 0, 0 },
+    { 'c', 6, 2690, 0, 0 },
+    { 's', 0, 0, 1467, 4026 },
+    { ';', 0, 0, 0, 4030 },
+    { 'd', 0, 0, 149, 2012 },
+    { ';', 0, 0, 0, 2217 },
+    { 'q', 0, 0, 149, 1361 },
+    { 's', 0, 0, 2552, 1373 },
+    { ';', 0, 0, 0, 1373 },
+    { 'c', 0, 0, 2474, 4033 },
+    { 'd', 2, 2696, 567, 0 },
+    { 'l', 2, 2698, 0, 0 },
+    { ';', 0, 0, 0, 4037 },
+    { 'p', 0, 0, 2558, 4037 },
+    { ';', 0, 0, 0, 4041 },
+    { 'q', 2, 2700, 0, 0 },
+    { ';', 0, 0, 0, 1377 },
+    { 'e', 0, 0, 149, 4045 },
+    { 'l', 0, 0, 149, 4049 },
+    { 'c', 0, 0, 149, 4053 },
+    { 'i', 0, 0, 18, 4057 },
+    { 'a', 2, 2702, 0, 0 },
+    { 'd', 0, 0, 93, 2249 },
+    { 'e', 2, 2704, 2499, 0 },
+    { 'l', 0, 0, 928, 1369 },
+    { 's', 0, 0, 1521, 1377 },
+    { 'd', 0, 0, 86, 4061 },
+    { 'r', 3, 2706, 0, 0 },
+    { ';', 0, 0, 0, 4064 },
+    { 'u', 0, 0, 1382, 4064 },
+    { 'l', 0, 0, 2563, 4068 },
+    { 'r', 0, 0, 281, 4072 },
+    { ';', 0, 0, 0, 2328 },
+    { ';', 0, 0, 0, 2337 },
+    { 'i', 0, 0, 535, 922 },
+    { 'n', 0, 0, 1232, 3249 },
+    { 'c', 0, 0, 18, 4076 },
+    { 'g', 3, 2709, 0, 0 },
+    { 't', 0, 0, 1630, 2368 },
+    { ';', 0, 0, 0, 4079 },
+    { 't', 0, 0, 2573, 4083 },
+    { ';', 0, 0, 0, 4087 },
+    { 'c', 0, 0, 2577, 4091 },
+    { 'e', 2, 2712, 0, 0 },
+    { 'l', 0, 0, 2581, 4095 },
+    { 'p', 0, 0, 482, 783 },
+    { ';', 0, 0, 0, 126 },
+    { 'E', 0, 0, 149, 4099 },
+    { 'd', 0, 0, 93, 4103 },
+    { 's', 2, 2714, 0, 0 },
+    { 'v', 0, 0, 149, 126 },
+    { ';', 0, 0, 0, 2400 },
+    { ';', 0, 0, 0, 4107 },
+    { 'd', 0, 0, 149, 4111 },
+    { 'l', 0, 0, 2400, 4107 },
+    { ';', 0, 0, 0, 2459 },
+    { ';', 0, 0, 0, 971 },
+    { 'b', 2, 2716, 0, 0 },
+    { 'f', 0, 0, 1302, 4115 },
+    { 'h', 0, 0, 2438, 4068 },
+    { 'l', 0, 0, 210, 4119 },
+    { 'p', 0, 0, 1467, 4123 },
+    { 's', 0, 0, 1521, 4127 },
+    { 't', 0, 0, 1467, 4131 },
+    { ';', 0, 0, 0, 4135 },
+    { 'a', 0, 0, 1835, 4139 },
+    { 'e', 2, 2718, 0, 0 },
+    { 'a', 2, 2720, 430, 0 },
+    { 'k', 2, 2722, 0, 0 },
+    { 'd', 0, 0, 1835, 4143 },
+    { 'i', 0, 0, 1467, 3547 },
+    { ';', 0, 0, 0, 1536 },
+    { 'r', 0, 0, 149, 648 },
+    { 'd', 0, 0, 1685, 4146 },
+    { 'u', 0, 0, 1679, 4150 },
+    { 'a', 2, 2724, 1247, 0 },
+    { 'h', 2, 2726, 1974, 0 },
+    { 'l', 0, 0, 2587, 2519 },
+    { 'r', 3, 2728, 2092, 0 },
+    { 't', 0, 0, 2598, 2588 },
+    { ';', 0, 0, 0, 2486 },
+    { 'q', 0, 0, 149, 2437 },
+    { 's', 0, 0, 2552, 3555 },
+    { ';', 0, 0, 0, 3555 },
+    { 'c', 0, 0, 2474, 4154 },
+    { 'd', 2, 2731, 567, 0 },
+    { 'g', 2, 2733, 0, 0 },
+    { 's', 5, 2735, 0, 0 },
+    { 'd', 0, 0, 149, 4158 },
+    { 'u', 2, 2740, 0, 0 },
+    { ';', 0, 0, 0, 4162 },
+    { 'a', 0, 0, 1906, 4162 },
+    { ';', 0, 0, 0, 4166 },
+    { 'p', 0, 0, 2558, 4166 },
+    { ';', 0, 0, 0, 4170 },
+    { 'q', 2, 2742, 0, 0 },
+    { 'n', 0, 0, 999, 4174 },
+    { 'r', 0, 0, 18, 4178 },
+    { 'l', 2, 2744, 2109, 0 },
+    { 'm', 0, 0, 2609, 1094 },
+    { 'r', 0, 0, 281, 3425 },
+    { 'l', 0, 0, 2616, 4119 },
+    { 'r', 0, 0, 2621, 4182 },
+    { 'a', 0, 0, 18, 4186 },
+    { 'f', 0, 0, 149, 4190 },
+    { 'l', 0, 0, 1491, 4195 },
+    { 'a', 0, 0, 1502, 4199 },
+    { 'b', 0, 0, 329, 4203 },
+    { ';', 0, 0, 0, 4205 },
+    { 'e', 0, 0, 2627, 4205 },
+    { 'f', 0, 0, 149, 4209 },
+    { ';', 0, 0, 0, 4213 },
+    { 'd', 0, 0, 149, 4217 },
+    { ';', 0, 0, 0, 3559 },
+    { 'e', 0, 0, 149, 4221 },
+    { 'g', 0, 0, 149, 4225 },
+    { 'b', 0, 0, 149, 4229 },
+    { 'u', 2, 2746, 105, 0 },
+    { 'c', 0, 0, 149, 4231 },
+    { 'i', 0, 0, 18, 4235 },
+    { 'P', 0, 0, 329, 4239 },
+    { 'i', 3, 2748, 0, 0 },
+    { ';', 0, 0, 0, 2619 },
+    { 'e', 0, 0, 149, 4243 },
+    { 't', 2, 2751, 0, 0 },
+    { ';', 0, 0, 0, 4247 },
+    { 's', 4, 2753, 2632, 0 },
+    { ';', 0, 0, 0, 2633 },
+    { ';', 0, 0, 0, 4251 },
+    { 'a', 0, 0, 1502, 1825 },
+    { 'c', 0, 0, 1802, 4255 },
+    { 'd', 1, 2757, 567, 1208 },
+    { ';', 0, 0, 0, 4259 },
+    { 'b', 0, 0, 149, 3773 },
+    { 'd', 2, 2758, 0, 0 },
+    { ';', 0, 0, 0, 4263 },
+    { 'v', 0, 0, 149, 4270 },
+    { 'a', 0, 0, 1171, 2745 },
+    { 'r', 0, 0, 281, 2729 },
+    { ';', 0, 0, 0, 4276 },
+    { 'v', 0, 0, 149, 4283 },
+    { ';', 0, 0, 0, 4289 },
+    { 'E', 0, 0, 149, 4293 },
+    { 'i', 0, 0, 36, 4299 },
+    { 'o', 0, 0, 1302, 4305 },
+    { 'p', 0, 0, 2558, 4289 },
+    { ';', 0, 0, 0, 4308 },
+    { 'a', 2, 2760, 114, 0 },
+    { ';', 0, 0, 0, 1514 },
+    { ';', 0, 0, 0, 4312 },
+    { 'e', 0, 0, 149, 4318 },
+    { 'p', 0, 0, 149, 4324 },
+    { 'r', 0, 0, 632, 4328 },
+    { ';', 0, 0, 0, 4331 },
+    { 'd', 0, 0, 93, 4335 },
+    { 'h', 0, 0, 2438, 4341 },
+    { 'r', 2, 2762, 0, 0 },
+    { 'e', 0, 0, 329, 3253 },
+    { 'i', 0, 0, 839, 4345 },
+    { ';', 0, 0, 0, 4351 },
+    { 's', 0, 0, 149, 4351 },
+    { ';', 0, 0, 0, 4355 },
+    { 'q', 3, 2764, 0, 0 },
+    { 's', 0, 0, 149, 4359 },
+    { ';', 0, 0, 0, 4365 },
+    { 'r', 0, 0, 149, 4365 },
+    { ';', 0, 0, 0, 4369 },
+    { 'd', 0, 0, 149, 4373 },
+    { ';', 0, 0, 0, 4377 },
+    { 'f', 2, 2767, 1011, 0 },
+    { 'q', 3, 2769, 0, 0 },
+    { 's', 2, 2772, 0, 0 },
+    { ';', 0, 0, 0, 4381 },
+    { 'r', 2, 2774, 242, 0 },
+    { ';', 0, 0, 0, 2772 },
+    { 'i', 4, 2776, 620, 0 },
+    { 'n', 2, 2780, 242, 0 },
+    { ';', 0, 0, 0, 2783 },
+    { 'a', 0, 0, 2635, 2783 },
+    { 's', 0, 0, 1467, 4385 },
+    { 't', 0, 0, 149, 4392 },
+    { ';', 0, 0, 0, 4398 },
+    { 'c', 0, 0, 1867, 4402 },
+    { 'e', 2, 2782, 0, 0 },
+    { ';', 0, 0, 0, 2779 },
+    { 'c', 0, 0, 149, 4406 },
+    { 'w', 0, 0, 149, 4412 },
+    { ';', 0, 0, 0, 4418 },
+    { 'e', 0, 0, 149, 4422 },
+    { ';', 0, 0, 0, 4426 },
+    { 'c', 0, 0, 1867, 4430 },
+    { 'e', 0, 0, 149, 4434 },
+    { 'r', 0, 0, 149, 4440 },
+    { 'm', 0, 0, 531, 878 },
+    { 'p', 0, 0, 2641, 2783 },
+    { ';', 0, 0, 0, 4445 },
+    { 'e', 2, 2784, 0, 0 },
+    { 'b', 0, 0, 2400, 4449 },
+    { 'p', 0, 0, 2400, 4453 },
+    { 'b', 4, 2786, 0, 0 },
+    { 'c', 2, 2790, 430, 0 },
+    { 'p', 4, 2792, 0, 0 },
+    { ';', 0, 0, 0, 2791 },
+    { 'l', 2, 2796, 2109, 0 },
+    { 'r', 2, 2798, 2092, 0 },
+    { ';', 0, 0, 0, 4457 },
+    { 'e', 0, 0, 2650, 4459 },
+    { 's', 0, 0, 210, 4463 },
+    { 'e', 0, 0, 149, 4467 },
+    { 't', 0, 0, 149, 4474 },
+    { 'A', 0, 0, 423, 4479 },
+    { 'e', 0, 0, 149, 4483 },
+    { 't', 2, 2800, 0, 0 },
+    { 'A', 0, 0, 423, 4490 },
+    { 't', 0, 0, 2654, 4494 },
+    { 'h', 0, 0, 2438, 4501 },
+    { 'r', 2, 2802, 0, 0 },
+    { ';', 0, 0, 0, 2839 },
+    { ';', 0, 0, 0, 4505 },
+    { 'c', 1, 2804, 0, 4509 },
+    { ';', 0, 0, 0, 2876 },
+    { 'i', 0, 0, 18, 4512 },
+    { 'r', 0, 0, 107, 4516 },
+    { 'c', 0, 0, 678, 4520 },
+    { 'd', 0, 0, 149, 4523 },
+    { 'n', 0, 0, 1491, 1215 },
+    { ';', 0, 0, 0, 4527 },
+    { 'e', 2, 2805, 355, 0 },
+    { 'f', 1, 2807, 0, 4531 },
+    { 'm', 1, 2808, 0, 4534 },
+    { ';', 0, 0, 0, 2941 },
+    { ';', 0, 0, 0, 2948 },
+    { ';', 0, 0, 0, 1223 },
+    { 'a', 0, 0, 1302, 4537 },
+    { ';', 0, 0, 0, 2955 },
+    { 'l', 0, 0, 2659, 2951 },
+    { 'i', 0, 0, 839, 4541 },
+    { 'l', 0, 0, 149, 4545 },
+    { ';', 0, 0, 0, 4549 },
+    { 'v', 0, 0, 149, 4552 },
+    { 'c', 2, 2809, 1316, 0 },
+    { 'k', 0, 0, 1794, 762 },
+    { ';', 0, 0, 0, 4555 },
+    { 'a', 0, 0, 1297, 4557 },
+    { 'b', 0, 0, 149, 3777 },
+    { 'c', 0, 0, 1802, 4561 },
+    { 'd', 2, 2811, 0, 0 },
+    { 'e', 0, 0, 149, 4565 },
+    { 'm', 1, 2813, 620, 379 },
+    { 's', 0, 0, 1521, 4569 },
+    { 't', 0, 0, 2664, 4573 },
+    { ';', 0, 0, 0, 2997 },
+    { ';', 0, 0, 0, 3575 },
+    { 'c', 6, 2814, 0, 0 },
+    { ';', 0, 0, 0, 4577 },
+    { 's', 0, 0, 149, 1563 },
+    { 'E', 0, 0, 149, 4581 },
+    { 'a', 0, 0, 210, 4585 },
+    { 's', 0, 0, 1521, 4589 },
+    { 'd', 0, 0, 149, 3579 },
+    { 'f', 3, 2820, 0, 0 },
+    { 'p', 2, 2823, 0, 0 },
+    { 'e', 0, 0, 2668, 1386 },
+    { 'i', 0, 0, 535, 4593 },
+    { ';', 0, 0, 0, 4597 },
+    { 'e', 0, 0, 2406, 4014 },
+    { ';', 0, 0, 0, 382 },
+    { 'e', 0, 0, 149, 4599 },
+    { 'u', 0, 0, 2676, 4605 },
+    { ';', 0, 0, 0, 3591 },
+    { 'd', 0, 0, 149, 4608 },
+    { 'e', 0, 0, 149, 4612 },
+    { 'l', 0, 0, 2400, 3591 },
+    { ';', 0, 0, 0, 3040 },
+    { ';', 0, 0, 0, 975 },
+    { 'a', 0, 0, 210, 4616 },
+    { 'b', 2, 2825, 0, 0 },
+    { 'c', 0, 0, 149, 4620 },
+    { 'f', 0, 0, 1302, 4624 },
+    { 'h', 0, 0, 2438, 4072 },
+    { 'l', 0, 0, 210, 4182 },
+    { 'p', 0, 0, 1467, 4628 },
+    { 's', 0, 0, 1521, 4632 },
+    { 't', 0, 0, 1467, 4636 },
+    { 'w', 0, 0, 149, 4640 },
+    { 'a', 0, 0, 1835, 4644 },
+    { 'i', 2, 2827, 105, 0 },
+    { 'a', 2, 2829, 430, 0 },
+    { 'k', 2, 2831, 0, 0 },
+    { 'd', 0, 0, 1835, 4648 },
+    { 'i', 0, 0, 1467, 1599 },
+    { ';', 0, 0, 0, 3485 },
+    { 'r', 0, 0, 149, 3485 },
+    { ';', 0, 0, 0, 405 },
+    { 'i', 0, 0, 1809, 1615 },
+    { 'p', 0, 0, 2680, 405 },
+    { 's', 0, 0, 149, 1607 },
+    { ';', 0, 0, 0, 402 },
+    { 'd', 0, 0, 149, 4651 },
+    { 'u', 2, 2833, 0, 0 },
+    { ';', 0, 0, 0, 4655 },
+    { 'v', 0, 0, 149, 4658 },
+    { 'a', 2, 2835, 1247, 0 },
+    { 'h', 2, 2837, 1974, 0 },
+    { 'l', 2, 2839, 2109, 0 },
+    { 'r', 0, 0, 2685, 952 },
+    { 's', 0, 0, 2697, 4640 },
+    { 't', 0, 0, 2598, 3116 },
+    { 'n', 0, 0, 999, 4661 },
+    { 'r', 0, 0, 18, 4665 },
+    { 'a', 0, 0, 18, 4669 },
+    { 'f', 0, 0, 149, 4673 },
+    { 'l', 0, 0, 1491, 4678 },
+    { ';', 0, 0, 0, 4682 },
+    { 'g', 0, 0, 1232, 4684 },
+    { 'b', 0, 0, 149, 4688 },
+    { 'u', 2, 2841, 105, 0 },
+    { ';', 0, 0, 0, 4690 },
+    { 'e', 0, 0, 149, 4694 },
+    { 'f', 0, 0, 149, 4698 },
+    { 'l', 0, 0, 582, 4702 },
+    { 'p', 0, 0, 149, 4706 },
+    { 'r', 0, 0, 632, 4710 },
+    { ';', 0, 0, 0, 4713 },
+    { 'd', 0, 0, 1835, 4717 },
+    { 'E', 0, 0, 149, 4720 },
+    { 'a', 0, 0, 210, 4724 },
+    { 's', 0, 0, 1521, 4728 },
+    { 'h', 0, 0, 2438, 2283 },
+    { 'r', 2, 2843, 0, 0 },
+    { ';', 0, 0, 0, 3166 },
+    { 'i', 0, 0, 2708, 1178 },
+    { 'n', 0, 0, 149, 1178 },
+    { 'h', 0, 0, 86, 4732 },
+    { 'y', 0, 0, 149, 4735 },
+    { 'm', 0, 0, 531, 4251 },
+    { 'p', 0, 0, 2641, 2951 },
+    { ';', 0, 0, 0, 3188 },
+    { ';', 0, 0, 0, 4738 },
+    { 'f', 0, 0, 149, 4741 },
+    { 'v', 0, 0, 149, 4741 },
+    { ';', 0, 0, 0, 1681 },
+    { 'd', 0, 0, 93, 4744 },
+    { 'e', 2, 2845, 0, 0 },
+    { 'g', 2, 2847, 0, 0 },
+    { 'l', 2, 2849, 0, 0 },
+    { 'n', 0, 0, 2400, 4748 },
+    { 'p', 0, 0, 717, 4752 },
+    { 'r', 0, 0, 267, 4756 },
+    { 'l', 0, 0, 2713, 1178 },
+    { 's', 0, 0, 2724, 4760 },
+    { 'd', 0, 0, 149, 4251 },
+    { 'l', 0, 0, 2400, 3208 },
+    { ';', 0, 0, 0, 4764 },
+    { 'e', 2, 2851, 0, 0 },
+    { ';', 0, 0, 0, 4768 },
+    { 'b', 2, 2853, 0, 0 },
+    { ';', 0, 0, 0, 4770 },
+    { 'u', 0, 0, 1382, 4770 },
+    { 'a', 2, 2855, 112, 0 },
+    { 'u', 2, 2857, 112, 0 },
+    { 'b', 3, 2859, 0, 0 },
+    { 'p', 3, 2862, 0, 0 },
+    { ';', 0, 0, 0, 3611 },
+    { 'a', 2, 2865, 355, 0 },
+    { 'f', 0, 0, 149, 1333 },
+    { ';', 0, 0, 0, 4774 },
+    { 'f', 0, 0, 149, 3745 },
+    { 'a', 2, 2867, 2092, 0 },
+    { 'n', 0, 0, 1302, 2619 },
+    { ';', 0, 0, 0, 4778 },
+    { 'E', 0, 0, 149, 4782 },
+    { 'd', 0, 0, 93, 4786 },
+    { 'e', 2, 2869, 0, 0 },
+    { 'm', 0, 0, 2728, 4790 },
+    { 'n', 2, 2871, 0, 0 },
+    { 'p', 0, 0, 717, 4794 },
+    { 'r', 0, 0, 267, 4798 },
+    { 's', 3, 2873, 0, 0 },
+    { ';', 0, 0, 0, 3124 },
+    { 'a', 0, 0, 2733, 4706 },
+    { 'c', 0, 0, 2740, 3132 },
+    { 'e', 0, 0, 2406, 4713 },
+    { 'n', 3, 2876, 0, 0 },
+    { 's', 0, 0, 1521, 3143 },
+    { '1', 1, 2879, 0, 4802 },
+    { '2', 1, 2880, 0, 4805 },
+    { '3', 1, 2881, 0, 4808 },
+    { ';', 0, 0, 0, 4811 },
+    { 'E', 0, 0, 149, 4815 },
+    { 'd', 2, 2882, 0, 0 },
+    { 'e', 2, 2884, 0, 0 },
+    { 'h', 2, 2886, 480, 0 },
+    { 'l', 0, 0, 267, 4819 },
+    { 'm', 0, 0, 2728, 4823 },
+    { 'n', 2, 2888, 0, 0 },
+    { 'p', 0, 0, 717, 4827 },
+    { 's', 3, 2890, 0, 0 },
+    { 'h', 0, 0, 2438, 2287 },
+    { 'r', 2, 2893, 0, 0 },
+    { 'r', 2, 2895, 2222, 0 },
+    { 't', 3, 2897, 570, 0 },
+    { 'c', 2, 2900, 1316, 0 },
+    { 'n', 0, 0, 2748, 3645 },
+    { 'a', 0, 0, 210, 1693 },
+    { 's', 0, 0, 1521, 1681 },
+    { ';', 0, 0, 0, 3240 },
+    { ';', 0, 0, 0, 3246 },
+    { 'b', 2, 2902, 0, 0 },
+    { 'd', 0, 0, 149, 4831 },
+    { ';', 0, 0, 0, 4835 },
+    { 'b', 0, 0, 93, 4839 },
+    { 'c', 0, 0, 1802, 4843 },
+    { 'f', 2, 2904, 0, 0 },
+    { 'a', 5, 2906, 2752, 0 },
+    { 'd', 0, 0, 93, 4847 },
+    { 'e', 0, 0, 149, 4851 },
+    { 'm', 0, 0, 711, 4855 },
+    { 'p', 0, 0, 717, 4859 },
+    { 's', 0, 0, 1627, 4863 },
+    { 't', 0, 0, 2000, 4867 },
+    { 'r', 0, 0, 149, 4871 },
+    { 'y', 0, 0, 149, 4876 },
+    { 'l', 0, 0, 2563, 1462 },
+    { 'r', 0, 0, 281, 3583 },
+    { ';', 0, 0, 0, 3271 },
+    { ';', 0, 0, 0, 3280 },
+    { 'l', 0, 0, 149, 4879 },
+    { 'r', 0, 0, 149, 4883 },
+    { 'o', 2, 2911, 1951, 0 },
+    { 'r', 0, 0, 1438, 4887 },
+    { ';', 0, 0, 0, 2009 },
+    { 'l', 0, 0, 2616, 4879 },
+    { 'r', 0, 0, 2621, 4883 },
+    { ';', 0, 0, 0, 4891 },
+    { 'h', 0, 0, 149, 3677 },
+    { 'l', 0, 0, 632, 4891 },
+    { 'o', 2, 2913, 1951, 0 },
+    { 'r', 0, 0, 1438, 4894 },
+    { ';', 0, 0, 0, 4898 },
+    { 'f', 0, 0, 149, 4902 },
+    { ';', 0, 0, 0, 3343 },
+    { 'e', 0, 0, 2414, 4009 },
+    { 'k', 0, 0, 2757, 2420 },
+    { 'n', 0, 0, 2763, 3990 },
+    { 'p', 3, 2915, 0, 0 },
+    { 'r', 2, 2918, 0, 0 },
+    { 's', 2, 2920, 0, 0 },
+    { 't', 2, 2922, 0, 0 },
+    { ';', 0, 0, 0, 2913 },
+    { 'b', 0, 0, 329, 4906 },
+    { 'e', 0, 0, 2406, 4910 },
+    { 'b', 0, 0, 329, 4914 },
+    { 't', 0, 0, 149, 4914 },
+    { 'b', 2, 2924, 620, 0 },
+    { 'p', 2, 2926, 620, 0 },
+    { 'b', 0, 0, 329, 4916 },
+    { 'g', 2, 2928, 2222, 0 },
+    { 'f', 0, 0, 149, 4920 },
+    { 'l', 0, 0, 1491, 3741 },
+    { ';', 0, 0, 0, 3442 },
+    { ';', 0, 0, 0, 3457 },
+    { 'A', 0, 0, 222, 1780 },
+    { 'D', 2, 2930, 105, 0 },
+    { 'G', 0, 0, 2771, 756 },
+    { 'T', 0, 0, 188, 3243 },
+    { 't', 0, 0, 149, 2009 },
+    { 'w', 0, 0, 2777, 681 },
+    { 'e', 3, 2932, 1723, 0 },
+    { 'o', 2, 2935, 1733, 0 },
+    { 'A', 0, 0, 1171, 1407 },
+    { 'T', 0, 0, 610, 1023 },
+    { 'A', 0, 0, 1171, 999 },
+    { 'D', 0, 0, 1193, 1019 },
+    { ';', 0, 0, 0, 1645 },
+    { 'B', 0, 0, 329, 4925 },
+    { 'U', 0, 0, 1224, 2049 },
+    { 'R', 0, 0, 2785, 4929 },
+    { 'T', 0, 0, 2306, 4933 },
+    { 'V', 2, 2937, 1165, 0 },
+    { 'T', 0, 0, 2306, 4937 },
+    { 'V', 2, 2939, 1165, 0 },
+    { ';', 0, 0, 0, 4835 },
+    { 'A', 0, 0, 1171, 4941 },
+    { 'g', 0, 0, 2797, 4087 },
+    { 'r', 0, 0, 2802, 3385 },
+    { 'n', 0, 0, 2267, 4107 },
+    { 'r', 3, 2941, 2279, 0 },
+    { 'u', 0, 0, 2283, 2542 },
+    { 'w', 2, 2944, 620, 0 },
+    { 'A', 0, 0, 1171, 4945 },
+    { 'V', 0, 0, 2811, 4949 },
+    { 'e', 3, 2946, 2222, 0 },
+    { 'r', 3, 2949, 1767, 0 },
+    { 'D', 0, 0, 2295, 4953 },
+    { 'T', 0, 0, 2306, 4957 },
+    { 'V', 2, 2952, 1165, 0 },
+    { ';', 0, 0, 0, 4961 },
+    { 'B', 0, 0, 329, 4965 },
+    { 'A', 0, 0, 1171, 3409 },
+    { 'R', 0, 0, 1213, 3401 },
+    { 'a', 0, 0, 1171, 3405 },
+    { 'r', 0, 0, 281, 3397 },
+    { 'c', 0, 0, 2365, 1756 },
+    { 'n', 0, 0, 2373, 1756 },
+    { 'o', 0, 0, 2818, 2715 },
+    { 'u', 0, 0, 2827, 4969 },
+    { 'l', 0, 0, 121, 4973 },
+    { 'q', 2, 2954, 2833, 0 },
+    { 'x', 0, 0, 2837, 4351 },
+    { ';', 0, 0, 0, 4365 },
+    { 'E', 0, 0, 970, 4355 },
+    { 'F', 0, 0, 910, 2719 },
+    { 'G', 0, 0, 920, 4270 },
+    { 'L', 0, 0, 928, 2787 },
+    { 'S', 0, 0, 933, 4359 },
+    { 'T', 0, 0, 188, 2725 },
+    { 'D', 0, 0, 961, 4312 },
+    { 'E', 0, 0, 970, 4318 },
+    { 'f', 3, 2956, 2843, 0 },
+    { 's', 6, 2959, 480, 0 },
+    { 'G', 0, 0, 2169, 4977 },
+    { 'L', 0, 0, 2184, 4983 },
+    { ';', 0, 0, 0, 4398 },
+    { 'E', 0, 0, 970, 4989 },
+    { 'S', 0, 0, 933, 4402 },
+    { 'e', 0, 0, 2853, 4995 },
+    { 'i', 3, 2965, 2867, 0 },
+    { 'q', 2, 2968, 2879, 0 },
+    { 'u', 3, 2970, 0, 0 },
+    { ';', 0, 0, 0, 4445 },
+    { 'E', 0, 0, 970, 4999 },
+    { 'F', 0, 0, 910, 4331 },
+    { 'T', 0, 0, 188, 4289 },
+    { 'e', 0, 0, 149, 5003 },
+    { 'k', 0, 0, 2354, 982 },
+    { ';', 0, 0, 0, 3493 },
+    { 'a', 0, 0, 1467, 1048 },
+    { 'l', 0, 0, 121, 2741 },
+    { 'q', 0, 0, 2886, 4213 },
+    { ';', 0, 0, 0, 975 },
+    { 'B', 0, 0, 329, 5007 },
+    { 'L', 0, 0, 1203, 3083 },
+    { 'T', 0, 0, 2306, 5011 },
+    { 'V', 2, 2973, 1165, 0 },
+    { ';', 0, 0, 0, 1030 },
+    { 'A', 0, 0, 1171, 4247 },
+    { 'V', 0, 0, 2811, 5015 },
+    { ';', 0, 0, 0, 1052 },
+    { 'B', 0, 0, 329, 5019 },
+    { 'E', 0, 0, 970, 4694 },
+    { ';', 0, 0, 0, 4883 },
+    { 'B', 0, 0, 329, 5023 },
+    { 'b', 2, 2975, 2897, 0 },
+    { 'p', 2, 2977, 2901, 0 },
+    { ';', 0, 0, 0, 3623 },
+    { 'E', 0, 0, 970, 5027 },
+    { ';', 0, 0, 0, 3124 },
+    { 'E', 0, 0, 970, 4713 },
+    { 'S', 0, 0, 933, 3132 },
+    { 'T', 0, 0, 188, 3143 },
+    { ';', 0, 0, 0, 4811 },
+    { 'E', 0, 0, 970, 5031 },
+    { 'a', 0, 0, 18, 4203 },
+    { 'r', 2, 2979, 2238, 0 },
+    { ';', 0, 0, 0, 3683 },
+    { 'i', 4, 2981, 2907, 0 },
+    { ';', 0, 0, 0, 849 },
+    { 'a', 8, 2985, 0, 0 },
+    { ';', 0, 0, 0, 5035 },
+    { 'v', 2, 2993, 2911, 0 },
+    { 'p', 0, 0, 1630, 5039 },
+    { 't', 0, 0, 149, 34 },
+    { ';', 0, 0, 0, 3785 },
+    { 'e', 0, 0, 2406, 3789 },
+    { ';', 0, 0, 0, 5043 },
+    { 'g', 0, 0, 2400, 5043 },
+    { 'l', 0, 0, 2913, 4209 },
+    { 's', 0, 0, 2501, 1333 },
+    { 't', 4, 2995, 1346, 0 },
+    { '2', 0, 0, 149, 5047 },
+    { '4', 0, 0, 149, 5051 },
+    { 'L', 0, 0, 149, 5055 },
+    { 'R', 0, 0, 149, 5059 },
+    { 'l', 0, 0, 149, 5063 },
+    { 'r', 0, 0, 149, 5067 },
+    { ';', 0, 0, 0, 5071 },
+    { 'D', 0, 0, 149, 5075 },
+    { 'U', 0, 0, 149, 5079 },
+    { 'd', 0, 0, 149, 5083 },
+    { 'u', 0, 0, 149, 5087 },
+    { 'L', 0, 0, 149, 5091 },
+    { 'R', 0, 0, 149, 5095 },
+    { 'l', 0, 0, 149, 5099 },
+    { 'r', 0, 0, 149, 5103 },
+    { ';', 0, 0, 0, 5107 },
+    { 'H', 0, 0, 149, 5111 },
+    { 'L', 0, 0, 149, 5115 },
+    { 'R', 0, 0, 149, 5119 },
+    { 'h', 0, 0, 149, 5123 },
+    { 'l', 0, 0, 149, 5127 },
+    { 'r', 0, 0, 149, 5131 },
+    { 'L', 0, 0, 149, 5135 },
+    { 'R', 0, 0, 149, 5139 },
+    { 'l', 0, 0, 149, 5143 },
+    { 'r', 0, 0, 149, 5147 },
+    { ';', 0, 0, 0, 1390 },
+    { 'D', 0, 0, 149, 5151 },
+    { 'U', 0, 0, 149, 5155 },
+    { 'd', 0, 0, 149, 5159 },
+    { 'u', 0, 0, 149, 5163 },
+    { 'L', 0, 0, 149, 5167 },
+    { 'R', 0, 0, 149, 5171 },
+    { 'l', 0, 0, 149, 5175 },
+    { 'r', 0, 0, 149, 5179 },
+    { ';', 0, 0, 0, 5183 },
+    { 'H', 0, 0, 149, 5187 },
+    { 'L', 0, 0, 149, 5191 },
+    { 'R', 0, 0, 149, 5195 },
+    { 'h', 0, 0, 149, 5199 },
+    { 'l', 0, 0, 149, 5203 },
+    { 'r', 0, 0, 149, 5207 },
+    { ';', 0, 0, 0, 1397 },
+    { 'q', 0, 0, 149, 1397 },
+    { 'a', 0, 0, 210, 5211 },
+    { 'u', 0, 0, 210, 5215 },
+    { 'a', 2, 2999, 1247, 0 },
+    { 'd', 5, 3001, 0, 0 },
+    { ';', 0, 0, 0, 1174 },
+    { 'q', 0, 0, 149, 1174 },
+    { ';', 0, 0, 0, 5219 },
+    { 't', 0, 0, 149, 5221 },
+    { ';', 0, 0, 0, 5223 },
+    { 'f', 0, 0, 1806, 434 },
+    { 'l', 2, 3006, 2222, 0 },
+    { ';', 0, 0, 0, 1689 },
+    { 'd', 0, 0, 93, 5227 },
+    { ';', 0, 0, 0, 70 },
+    { 's', 0, 0, 18, 5231 },
+    { ';', 0, 0, 0, 5235 },
+    { 'e', 0, 0, 149, 5239 },
+    { ';', 0, 0, 0, 5243 },
+    { 'e', 0, 0, 149, 5247 },
+    { 'a', 0, 0, 210, 5251 },
+    { 'u', 0, 0, 210, 5255 },
+    { ';', 0, 0, 0, 5259 },
+    { 'm', 0, 0, 149, 5263 },
+    { 'e', 2, 3008, 2499, 0 },
+    { 'v', 0, 0, 610, 1949 },
+    { 'w', 0, 0, 614, 1953 },
+    { ';', 0, 0, 0, 3914 },
+    { 'l', 0, 0, 2616, 3883 },
+    { 'r', 0, 0, 2621, 5259 },
+    { ';', 0, 0, 0, 3517 },
+    { 's', 0, 0, 2921, 3925 },
+    { ';', 0, 0, 0, 3929 },
+    { 'o', 0, 0, 2926, 3932 },
+    { ';', 0, 0, 0, 2147 },
+    { 'd', 0, 0, 93, 2064 },
+    { 'l', 0, 0, 2616, 2001 },
+    { 'r', 0, 0, 2621, 2005 },
+    { ';', 0, 0, 0, 3971 },
+    { '3', 0, 0, 149, 5267 },
+    { '4', 0, 0, 149, 5271 },
+    { 'g', 0, 0, 2934, 3974 },
+    { 'l', 0, 0, 928, 3982 },
+    { ';', 0, 0, 0, 3501 },
+    { 'D', 0, 0, 2938, 5275 },
+    { ';', 0, 0, 0, 2981 },
+    { 'v', 0, 0, 149, 5279 },
+    { '1', 6, 3010, 0, 0 },
+    { '2', 2, 3016, 0, 0 },
+    { '3', 3, 3018, 0, 0 },
+    { '4', 0, 0, 2941, 5283 },
+    { '5', 2, 3021, 0, 0 },
+    { '7', 0, 0, 2944, 5287 },
+    { ';', 0, 0, 0, 5291 },
+    { 'o', 2, 3023, 0, 0 },
+    { ';', 0, 0, 0, 5295 },
+    { 'e', 0, 0, 1302, 5302 },
+    { ';', 0, 0, 0, 4041 },
+    { 'q', 0, 0, 149, 2237 },
+    { 'p', 0, 0, 2947, 2207 },
+    { 'r', 0, 0, 18, 5306 },
+    { 'l', 0, 0, 928, 2221 },
+    { 'q', 0, 0, 2953, 2200 },
+    { ';', 0, 0, 0, 4945 },
+    { 'c', 0, 0, 1802, 5310 },
+    { 'w', 0, 0, 149, 5314 },
+    { 'e', 0, 0, 149, 214 },
+    { 'l', 0, 0, 2959, 221 },
+    { 'p', 0, 0, 2680, 214 },
+    { 'g', 0, 0, 2964, 614 },
+    { 'r', 0, 0, 2969, 4091 },
+    { ';', 0, 0, 0, 5318 },
+    { 'v', 0, 0, 149, 5322 },
+    { ';', 0, 0, 0, 5326 },
+    { 'f', 0, 0, 1302, 5330 },
+    { ';', 0, 0, 0, 5334 },
+    { 's', 0, 0, 149, 5338 },
+    { 'e', 0, 0, 149, 2473 },
+    { 'k', 0, 0, 149, 4229 },
+    { 'e', 0, 0, 149, 5345 },
+    { 's', 2, 3025, 114, 0 },
+    { ';', 0, 0, 0, 971 },
+    { 't', 0, 0, 1607, 4131 },
+    { 'd', 0, 0, 2433, 4158 },
+    { 'u', 0, 0, 210, 4961 },
+    { 'a', 2, 3027, 1247, 0 },
+    { 'h', 0, 0, 2974, 4213 },
+    { 's', 0, 0, 2697, 5314 },
+    { ';', 0, 0, 0, 5349 },
+    { 'o', 2, 3029, 0, 0 },
+    { ';', 0, 0, 0, 5353 },
+    { 'e', 0, 0, 1302, 5360 },
+    { 'a', 0, 0, 2733, 2455 },
+    { 'd', 0, 0, 93, 2584 },
+    { 'e', 2, 3031, 2499, 0 },
+    { 'g', 0, 0, 2934, 2507 },
+    { 's', 0, 0, 1521, 3559 },
+    { ';', 0, 0, 0, 4961 },
+    { 'l', 0, 0, 149, 5364 },
+    { ';', 0, 0, 0, 4170 },
+    { 'q', 0, 0, 149, 2534 },
+    { 'a', 0, 0, 1171, 3409 },
+    { 'r', 0, 0, 281, 3401 },
+    { ';', 0, 0, 0, 1540 },
+    { 'r', 0, 0, 149, 967 },
+    { ';', 0, 0, 0, 5368 },
+    { 'e', 0, 0, 149, 5372 },
+    { 'f', 0, 0, 149, 5376 },
+    { ';', 0, 0, 0, 5380 },
+    { 'e', 0, 0, 2983, 5380 },
+    { ';', 0, 0, 0, 4247 },
+    { 'd', 0, 0, 2433, 4941 },
+    { 'l', 0, 0, 2616, 5384 },
+    { 'u', 0, 0, 210, 3665 },
+    { ';', 0, 0, 0, 1208 },
+    { ';', 0, 0, 0, 3939 },
+    { 'u', 0, 0, 149, 5388 },
+    { ';', 0, 0, 0, 4308 },
+    { 's', 0, 0, 149, 1517 },
+    { ';', 0, 0, 0, 3673 },
+    { 'o', 0, 0, 2987, 3673 },
+    { ';', 0, 0, 0, 4355 },
+    { 'q', 0, 0, 149, 2719 },
+    { 's', 0, 0, 2552, 4359 },
+    { 'a', 0, 0, 1171, 2755 },
+    { 'r', 0, 0, 281, 2733 },
+    { ';', 0, 0, 0, 4377 },
+    { 'q', 0, 0, 149, 2749 },
+    { 's', 0, 0, 2552, 5392 },
+    { ';', 0, 0, 0, 5392 },
+    { 's', 0, 0, 149, 4381 },
+    { ';', 0, 0, 0, 5398 },
+    { 'e', 0, 0, 149, 5402 },
+    { ';', 0, 0, 0, 4973 },
+    { 'E', 0, 0, 149, 5406 },
+    { 'd', 0, 0, 93, 5412 },
+    { 'v', 3, 3033, 0, 0 },
+    { ';', 0, 0, 0, 4995 },
+    { 'v', 3, 3036, 0, 0 },
+    { ';', 0, 0, 0, 4989 },
+    { 'c', 2, 3039, 0, 0 },
+    { ';', 0, 0, 0, 4999 },
+    { 'q', 0, 0, 149, 4999 },
+    { ';', 0, 0, 0, 5418 },
+    { 'E', 0, 0, 149, 5422 },
+    { 'e', 0, 0, 149, 5428 },
+    { 's', 2, 3041, 2335, 0 },
+    { ';', 0, 0, 0, 4426 },
+    { 'e', 0, 0, 2406, 4434 },
+    { ';', 0, 0, 0, 5432 },
+    { 'E', 0, 0, 149, 5436 },
+    { 'e', 0, 0, 149, 5442 },
+    { 's', 2, 3043, 2335, 0 },
+    { ';', 0, 0, 0, 5398 },
+    { 'e', 0, 0, 2406, 5402 },
+    { ';', 0, 0, 0, 4418 },
+    { 'e', 0, 0, 2406, 4422 },
+    { ';', 0, 0, 0, 5446 },
+    { 'r', 0, 0, 2573, 5451 },
+    { ';', 0, 0, 0, 3669 },
+    { 'o', 0, 0, 2987, 3669 },
+    { ';', 0, 0, 0, 4509 },
+    { ';', 0, 0, 0, 2937 },
+    { 'o', 0, 0, 636, 2937 },
+    { ';', 0, 0, 0, 4531 },
+    { ';', 0, 0, 0, 4534 },
+    { ';', 0, 0, 0, 762 },
+    { 'h', 0, 0, 149, 5458 },
+    { 'o', 0, 0, 149, 3943 },
+    { 'u', 0, 0, 149, 5462 },
+    { ';', 0, 0, 0, 379 },
+    { ';', 0, 0, 0, 3000 },
+    { 'a', 0, 0, 2733, 3008 },
+    { 'c', 0, 0, 2740, 3012 },
+    { 'e', 0, 0, 2406, 3575 },
+    { 'n', 3, 3045, 0, 0 },
+    { 's', 0, 0, 1521, 3016 },
+    { 'a', 0, 0, 1442, 5466 },
+    { 'l', 0, 0, 2959, 5470 },
+    { 's', 0, 0, 2990, 5474 },
+    { ';', 0, 0, 0, 1048 },
+    { 't', 0, 0, 274, 1048 },
+    { ';', 0, 0, 0, 5007 },
+    { 'f', 0, 0, 1302, 5478 },
+    { ';', 0, 0, 0, 5482 },
+    { 'n', 0, 0, 2995, 389 },
+    { 'e', 0, 0, 149, 3050 },
+    { 'k', 0, 0, 149, 4688 },
+    { 'e', 0, 0, 149, 5486 },
+    { 's', 2, 3048, 114, 0 },
+    { ';', 0, 0, 0, 3603 },
+    { 'l', 0, 0, 149, 5490 },
+    { ';', 0, 0, 0, 975 },
+    { 't', 0, 0, 1607, 4636 },
+    { 'd', 0, 0, 2433, 4651 },
+    { 'u', 0, 0, 210, 3603 },
+    { 'a', 0, 0, 3000, 3083 },
+    { 'h', 0, 0, 2974, 1313 },
+    { ';', 0, 0, 0, 3489 },
+    { 'r', 0, 0, 149, 3489 },
+    { ';', 0, 0, 0, 3567 },
+    { 'o', 0, 0, 2987, 3567 },
+    { ';', 0, 0, 0, 1685 },
+    { 'q', 0, 0, 149, 1685 },
+    { ';', 0, 0, 0, 5494 },
+    { 'E', 0, 0, 149, 5498 },
+    { ';', 0, 0, 0, 5502 },
+    { 'E', 0, 0, 149, 5506 },
+    { ';', 0, 0, 0, 5510 },
+    { 's', 0, 0, 149, 5514 },
+    { ';', 0, 0, 0, 5521 },
+    { 'a', 0, 0, 18, 5525 },
+    { ';', 0, 0, 0, 3615 },
+    { 's', 0, 0, 149, 5529 },
+    { ';', 0, 0, 0, 3619 },
+    { 's', 0, 0, 149, 5536 },
+    { ';', 0, 0, 0, 5543 },
+    { 'e', 0, 0, 149, 5547 },
+    { 's', 2, 3050, 2335, 0 },
+    { ';', 0, 0, 0, 5551 },
+    { 'e', 0, 0, 149, 5555 },
+    { 's', 2, 3052, 2335, 0 },
+    { 'e', 0, 0, 149, 3611 },
+    { 'f', 0, 0, 149, 1333 },
+    { 'e', 0, 0, 2414, 4009 },
+    { 'p', 0, 0, 3007, 4552 },
+    { ';', 0, 0, 0, 5027 },
+    { 'd', 0, 0, 93, 5559 },
+    { 'E', 0, 0, 149, 5563 },
+    { 'e', 0, 0, 149, 5567 },
+    { 'e', 3, 3054, 1011, 0 },
+    { 'i', 0, 0, 839, 5571 },
+    { 'u', 2, 3057, 0, 0 },
+    { 'a', 0, 0, 2733, 4724 },
+    { 'e', 0, 0, 3011, 4720 },
+    { 's', 0, 0, 1521, 4728 },
+    { ';', 0, 0, 0, 4802 },
+    { ';', 0, 0, 0, 4805 },
+    { ';', 0, 0, 0, 4808 },
+    { 'o', 0, 0, 1232, 5575 },
+    { 's', 0, 0, 3015, 5579 },
+    { ';', 0, 0, 0, 5031 },
+    { 'd', 0, 0, 93, 5583 },
+    { 'o', 0, 0, 1467, 5587 },
+    { 'u', 0, 0, 1627, 5591 },
+    { 'E', 0, 0, 149, 5595 },
+    { 'e', 0, 0, 149, 5599 },
+    { 'e', 3, 3059, 1011, 0 },
+    { 'i', 0, 0, 839, 5603 },
+    { 'u', 2, 3062, 0, 0 },
+    { ';', 0, 0, 0, 3563 },
+    { 'o', 0, 0, 2987, 3563 },
+    { '4', 0, 0, 149, 3631 },
+    { 'f', 0, 0, 3019, 3631 },
+    { ';', 0, 0, 0, 5607 },
+    { 's', 0, 0, 3024, 5610 },
+    { 'v', 0, 0, 149, 5610 },
+    { 'a', 0, 0, 2733, 1693 },
+    { 's', 0, 0, 1521, 1681 },
+    { ';', 0, 0, 0, 3781 },
+    { 'a', 0, 0, 18, 5613 },
+    { ';', 0, 0, 0, 5617 },
+    { 'o', 0, 0, 572, 5622 },
+    { ';', 0, 0, 0, 4898 },
+    { 'd', 0, 0, 2433, 3959 },
+    { 'l', 2, 3064, 2109, 0 },
+    { 'q', 0, 0, 149, 4851 },
+    { 'r', 2, 3066, 2092, 0 },
+    { ';', 0, 0, 0, 5626 },
+    { 'e', 0, 0, 18, 5626 },
+    { ';', 0, 0, 0, 5630 },
+    { 'e', 0, 0, 18, 5630 },
+    { 'h', 0, 0, 97, 4552 },
+    { 'i', 0, 0, 149, 2985 },
+    { 'r', 0, 0, 3028, 1048 },
+    { ';', 0, 0, 0, 1728 },
+    { 'h', 0, 0, 274, 4658 },
+    { 'i', 0, 0, 313, 4741 },
+    { 'u', 2, 3068, 0, 0 },
+    { 'h', 0, 0, 3034, 5610 },
+    { 'r', 2, 3070, 1767, 0 },
+    { 'E', 0, 0, 149, 5634 },
+    { 'e', 0, 0, 149, 5641 },
+    { 'E', 0, 0, 149, 5648 },
+    { 'e', 0, 0, 149, 5655 },
+    { ';', 0, 0, 0, 3698 },
+    { 'q', 0, 0, 149, 5662 },
+    { 't', 0, 0, 149, 3936 },
+    { 'u', 0, 0, 3039, 1969 },
+    { 'A', 0, 0, 1171, 2429 },
+    { 'R', 0, 0, 1213, 758 },
+    { 'T', 0, 0, 610, 1259 },
+    { 'L', 2, 3072, 2109, 0 },
+    { 'R', 0, 0, 1213, 3421 },
+    { ';', 0, 0, 0, 4158 },
+    { 'B', 0, 0, 329, 5666 },
+    { ';', 0, 0, 0, 4651 },
+    { 'B', 0, 0, 329, 5670 },
+    { ';', 0, 0, 0, 971 },
+    { 'B', 0, 0, 329, 5326 },
+    { 'R', 0, 0, 1213, 2556 },
+    { 'T', 0, 0, 2306, 5674 },
+    { 'V', 2, 3074, 1165, 0 },
+    { ';', 0, 0, 0, 3917 },
+    { 'A', 0, 0, 1171, 5384 },
+    { 'V', 0, 0, 2811, 5678 },
+    { ';', 0, 0, 0, 1039 },
+    { 'B', 0, 0, 329, 5682 },
+    { 'E', 0, 0, 970, 5372 },
+    { ';', 0, 0, 0, 4879 },
+    { 'B', 0, 0, 329, 5686 },
+    { ';', 0, 0, 0, 2701 },
+    { 'T', 0, 0, 188, 4345 },
+    { ';', 0, 0, 0, 5398 },
+    { 'B', 0, 0, 329, 5690 },
+    { 'E', 0, 0, 970, 5402 },
+    { ';', 0, 0, 0, 4381 },
+    { 'E', 0, 0, 970, 4377 },
+    { 'G', 0, 0, 920, 2794 },
+    { 'L', 0, 0, 928, 4283 },
+    { 'S', 0, 0, 933, 5392 },
+    { 'T', 0, 0, 188, 2763 },
+    { ';', 0, 0, 0, 4418 },
+    { 'B', 0, 0, 329, 5696 },
+    { 'E', 0, 0, 970, 4422 },
+    { 'b', 2, 3076, 2897, 0 },
+    { 'p', 2, 3078, 2901, 0 },
+    { 'b', 2, 3080, 2897, 0 },
+    { 'c', 4, 3082, 3049, 0 },
+    { 'p', 2, 3086, 2901, 0 },
+    { ';', 0, 0, 0, 2005 },
+    { 'B', 0, 0, 329, 5702 },
+    { ';', 0, 0, 0, 5543 },
+    { 'E', 0, 0, 970, 5547 },
+    { ';', 0, 0, 0, 5551 },
+    { 'E', 0, 0, 970, 5555 },
+    { 'e', 0, 0, 149, 5706 },
+    { 'k', 0, 0, 2354, 1831 },
+    { 'B', 0, 0, 329, 4251 },
+    { 'L', 0, 0, 2959, 4914 },
+    { 'S', 0, 0, 3055, 5710 },
+    { 'T', 0, 0, 188, 3381 },
+    { 'a', 0, 0, 149, 5714 },
+    { 'b', 0, 0, 149, 5718 },
+    { 'c', 0, 0, 149, 5722 },
+    { 'd', 0, 0, 149, 5726 },
+    { 'e', 0, 0, 149, 5730 },
+    { 'f', 0, 0, 149, 5734 },
+    { 'g', 0, 0, 149, 5738 },
+    { 'h', 0, 0, 149, 5742 },
+    { ';', 0, 0, 0, 5746 },
+    { 'd', 0, 0, 149, 5750 },
+    { ';', 0, 0, 0, 4902 },
+    { 'd', 0, 0, 2433, 3963 },
+    { 'l', 0, 0, 2616, 5376 },
+    { 'r', 0, 0, 2621, 4698 },
+    { 'l', 0, 0, 2616, 2887 },
+    { 'r', 0, 0, 2621, 2917 },
+    { 'R', 0, 0, 149, 402 },
+    { 'S', 0, 0, 149, 882 },
+    { 'a', 0, 0, 1502, 2842 },
+    { 'c', 0, 0, 163, 4505 },
+    { 'd', 0, 0, 362, 2849 },
+    { 'm', 0, 0, 3065, 5223 },
+    { 'x', 0, 0, 1108, 3509 },
+    { 'p', 0, 0, 3070, 3875 },
+    { 's', 0, 0, 3075, 3879 },
+    { '2', 1, 3088, 0, 2272 },
+    { '3', 0, 0, 149, 5754 },
+    { '4', 1, 3089, 0, 5758 },
+    { '5', 0, 0, 149, 5761 },
+    { '6', 0, 0, 149, 5765 },
+    { '8', 0, 0, 149, 5769 },
+    { '3', 0, 0, 149, 5773 },
+    { '5', 0, 0, 149, 5777 },
+    { '4', 1, 3090, 0, 5781 },
+    { '5', 0, 0, 149, 5784 },
+    { '8', 0, 0, 149, 5788 },
+    { '6', 0, 0, 149, 5792 },
+    { '8', 0, 0, 149, 5796 },
+    { ';', 0, 0, 0, 5800 },
+    { 'l', 0, 0, 149, 5804 },
+    { 'd', 0, 0, 149, 5808 },
+    { 'u', 0, 0, 149, 5812 },
+    { ';', 0, 0, 0, 4945 },
+    { 's', 0, 0, 149, 2556 },
+    { ';', 0, 0, 0, 5816 },
+    { 'r', 0, 0, 149, 5820 },
+    { 'g', 0, 0, 2934, 2490 },
+    { 'q', 0, 0, 3080, 2441 },
+    { 'a', 0, 0, 149, 4973 },
+    { 'b', 0, 0, 149, 5824 },
+    { 'c', 0, 0, 149, 5828 },
+    { 'a', 0, 0, 149, 4995 },
+    { 'b', 0, 0, 149, 5832 },
+    { 'c', 0, 0, 149, 5836 },
+    { ';', 0, 0, 0, 4398 },
+    { 'e', 0, 0, 2406, 4989 },
+    { ';', 0, 0, 0, 3362 },
+    { 'e', 2, 3091, 2499, 0 },
+    { ';', 0, 0, 0, 3369 },
+    { 'e', 2, 3093, 2499, 0 },
+    { 'a', 0, 0, 2733, 4585 },
+    { 'e', 0, 0, 3011, 4581 },
+    { 's', 0, 0, 1521, 4589 },
+    { 'd', 0, 0, 149, 5840 },
+    { 'u', 0, 0, 149, 5844 },
+    { ';', 0, 0, 0, 5543 },
+    { 'e', 0, 0, 2406, 5547 },
+    { ';', 0, 0, 0, 5551 },
+    { 'e', 0, 0, 2406, 5555 },
+    { ';', 0, 0, 0, 4778 },
+    { 'e', 2, 3095, 2499, 0 },
+    { 'n', 2, 3097, 3085, 0 },
+    { 'b', 0, 0, 149, 5848 },
+    { 'p', 0, 0, 149, 5852 },
+    { ';', 0, 0, 0, 4811 },
+    { 'e', 2, 3099, 2499, 0 },
+    { 'n', 2, 3101, 3085, 0 },
+    { 'b', 0, 0, 149, 5856 },
+    { 'p', 0, 0, 149, 5860 },
+    { ';', 0, 0, 0, 5368 },
+    { 'e', 0, 0, 2406, 5372 },
+    { ';', 0, 0, 0, 4690 },
+    { 'e', 0, 0, 2406, 4694 },
+    { 'b', 2, 3103, 3088, 0 },
+    { 'p', 2, 3105, 3088, 0 },
+    { 'l', 0, 0, 2616, 1039 },
+    { 'r', 0, 0, 2621, 1052 },
+    { 'A', 0, 0, 1171, 3405 },
+    { 'R', 0, 0, 1213, 3397 },
+    { ';', 0, 0, 0, 2001 },
+    { 'B', 0, 0, 329, 5864 },
+    { ';', 0, 0, 0, 5868 },
+    { 'E', 0, 0, 970, 4449 },
+    { ';', 0, 0, 0, 5874 },
+    { 'E', 0, 0, 970, 4453 },
+    { ';', 0, 0, 0, 3362 },
+    { 'E', 0, 0, 970, 5428 },
+    { ';', 0, 0, 0, 4426 },
+    { 'E', 0, 0, 970, 4434 },
+    { 'S', 0, 0, 933, 4430 },
+    { 'T', 0, 0, 188, 5880 },
+    { ';', 0, 0, 0, 3369 },
+    { 'E', 0, 0, 970, 5442 },
+    { ';', 0, 0, 0, 2272 },
+    { ';', 0, 0, 0, 5758 },
+    { ';', 0, 0, 0, 5781 },
+    { ';', 0, 0, 0, 5428 },
+    { 'q', 0, 0, 149, 5422 },
+    { ';', 0, 0, 0, 5442 },
+    { 'q', 0, 0, 149, 5436 },
+    { ';', 0, 0, 0, 5027 },
+    { 'q', 0, 0, 149, 4782 },
+    { ';', 0, 0, 0, 5567 },
+    { 'q', 0, 0, 149, 5563 },
+    { ';', 0, 0, 0, 5031 },
+    { 'q', 0, 0, 149, 4815 },
+    { ';', 0, 0, 0, 5599 },
+    { 'q', 0, 0, 149, 5595 },
+    { ';', 0, 0, 0, 5641 },
+    { 'q', 0, 0, 149, 5634 },
+    { ';', 0, 0, 0, 5655 },
+    { 'q', 0, 0, 149, 5648 },
+};
+
+static const char html_entity_tails[3095] =
+    "\000\003\154\151\147\001\120\004\143\165\164\145\005\162\145\166"
+    "\145\073\002\162\073\004\162\141\166\145\004\160\150\141\073\004"
+    "\141\143\162\073\002\144\073\014\160\154\171\106\165\156\143\164"
+    "\151\157\156\073\003\151\156\147\004\151\154\144\145\002\155\154"
+    "\002\171\073\003\160\146\073\004\145\166\145\073\003\143\162\073"
+    "\005\155\160\145\161\073\003\143\171\073\002\120\131\003\157\164"
+    "\073\002\151\073\004\162\143\154\145\001\157\004\157\163\163\073"
+    "\001\160\001\154\002\107\073\001\110\006\145\155\145\156\164\073"
+    "\006\163\151\154\157\156\073\001\165\002\141\073\004\154\154\145"
+    "\144\003\155\155\141\001\073\005\145\141\164\145\162\005\122\104"
+    "\143\171\073\004\151\162\143\073\013\154\142\145\162\164\123\160"
+    "\141\143\145\073\002\155\160\004\154\151\147\073\005\151\154\144"
+    "\145\073\004\153\143\171\073\004\160\160\141\073\005\151\144\157"
+    "\164\073\002\160\073\010\156\165\163\120\154\165\163\073\005\143"
+    "\165\164\145\073\005\142\154\141\143\073\007\145\156\103\165\162"
+    "\154\171\001\151\002\145\162\007\162\164\151\141\154\104\073\010"
+    "\165\163\115\151\156\165\163\073\002\117\124\004\141\162\162\073"
+    "\001\107\002\157\073\003\147\150\164\012\151\147\150\164\141\162"
+    "\162\157\167\073\012\154\145\104\145\154\141\171\145\144\073\005"
+    "\106\124\143\171\073\003\157\162\164\004\147\155\141\073\012\141"
+    "\154\154\103\151\162\143\154\145\073\003\141\162\073\003\117\122"
+    "\116\004\101\104\105\073\003\154\144\145\010\151\160\154\145\104"
+    "\157\164\073\001\162\004\151\156\147\073\004\141\163\150\073\003"
+    "\141\163\150\005\144\141\163\150\073\004\144\147\145\073\003\155"
+    "\154\073\002\162\153\004\161\165\157\073\001\147\005\141\162\157"
+    "\167\073\005\162\151\155\145\073\003\165\142\163\004\144\157\164"
+    "\073\005\154\143\164\171\073\003\162\162\073\002\141\162\001\143"
+    "\006\141\156\147\154\145\073\014\154\154\151\156\147\144\157\164"
+    "\163\145\161\073\005\155\141\154\145\073\003\157\146\073\007\141"
+    "\162\164\151\156\164\073\004\155\145\154\073\004\141\166\145\073"
+    "\001\163\004\162\157\144\073\004\165\145\163\164\004\141\164\150"
+    "\073\003\160\160\141\005\162\145\145\156\073\004\104\157\164\073"
+    "\014\141\163\165\162\145\144\141\156\147\154\145\073\005\160\154"
+    "\165\163\073\003\151\144\073\003\156\164\073\004\142\141\162\073"
+    "\005\156\143\163\160\073\004\157\165\163\164\004\155\151\144\073"
+    "\006\154\165\150\141\162\073\002\157\164\001\141\003\162\153\073"
+    "\005\154\162\145\143\073\004\164\162\151\073\002\163\165\004\162"
+    "\157\160\073\006\151\147\172\141\147\073\003\141\160\073\003\151"
+    "\163\073\003\145\145\073\005\145\144\147\145\073\001\156\006\147"
+    "\162\141\162\162\073\002\162\143\003\157\156\073\002\146\073\004"
+    "\151\147\156\073\007\153\163\154\141\163\150\073\005\141\165\163"
+    "\145\073\010\156\157\165\154\154\151\163\073\004\165\164\145\073"
+    "\005\154\145\171\163\073\004\162\157\156\073\003\144\151\154\003"
+    "\162\143\073\005\156\151\156\164\073\005\151\154\154\141\073\007"
+    "\164\145\162\104\157\164\073\005\151\156\165\163\073\004\154\165"
+    "\163\073\005\151\155\145\163\073\025\153\167\151\163\145\103\157"
+    "\156\164\157\165\162\111\156\164\145\147\162\141\154\073\006\145"
+    "\103\165\162\154\171\002\157\156\035\156\164\145\162\103\154\157"
+    "\143\153\167\151\163\145\103\157\156\164\157\165\162\111\156\164"
+    "\145\147\162\141\154\073\006\164\162\141\150\144\073\004\147\145"
+    "\162\073\003\150\166\073\013\146\145\162\145\156\164\151\141\154"
+    "\104\073\003\142\154\145\004\162\157\153\073\002\164\171\010\154"
+    "\151\142\162\151\165\155\073\002\155\073\004\163\164\163\073\012"
+    "\157\156\145\156\164\151\141\154\105\073\013\155\141\154\154\123"
+    "\161\165\141\162\145\073\017\145\162\171\123\155\141\154\154\123"
+    "\161\165\141\162\145\073\004\101\154\154\073\010\162\151\145\162"
+    "\164\162\146\073\004\144\151\154\073\004\161\165\141\154\011\165"
+    "\154\154\105\161\165\141\154\073\007\162\145\141\164\145\162\073"
+    "\004\145\163\163\073\012\154\141\156\164\105\161\165\141\154\073"
+    "\003\145\153\073\014\151\172\157\156\164\141\154\114\151\156\145"
+    "\073\010\157\167\156\110\165\155\160\073\005\161\165\141\154\073"
+    "\005\154\151\145\163\073\006\151\163\151\142\154\145\004\162\143"
+    "\171\073\004\142\144\141\073\002\147\073\010\154\141\143\145\164"
+    "\162\146\073\001\164\010\146\164\141\162\162\157\167\073\011\151"
+    "\165\155\123\160\141\143\145\073\007\154\151\156\164\162\146\073"
+    "\005\141\164\151\166\145\003\164\145\144\005\114\151\156\145\073"
+    "\005\162\145\141\153\073\016\102\162\145\141\153\151\156\147\123"
+    "\160\141\143\145\073\003\147\141\073\005\143\162\157\156\073\013"
+    "\157\165\142\154\145\121\165\157\164\145\073\005\165\157\164\145"
+    "\073\002\144\145\003\145\163\073\013\141\162\145\156\164\150\145"
+    "\163\151\163\073\013\156\143\141\162\145\160\154\141\156\145\073"
+    "\005\143\145\144\145\163\003\155\145\073\004\145\162\163\145\007"
+    "\145\151\154\151\156\147\073\005\154\157\157\162\073\005\145\143"
+    "\164\157\162\005\162\162\157\167\073\012\156\144\111\155\160\154"
+    "\151\145\163\073\004\110\143\171\073\011\157\167\156\101\162\162"
+    "\157\167\073\011\145\146\164\101\162\162\157\167\073\012\151\147"
+    "\150\164\101\162\162\157\167\073\007\160\101\162\162\157\167\073"
+    "\002\164\073\003\141\162\145\003\165\164\145\003\166\145\073\004"
+    "\162\162\157\167\013\161\165\151\154\151\142\162\151\165\155\073"
+    "\002\145\145\011\157\167\156\141\162\162\157\167\073\014\157\127"
+    "\151\144\164\150\123\160\141\143\145\073\002\164\145\003\150\141"
+    "\073\004\143\151\162\073\002\163\073\003\162\157\170\006\157\156"
+    "\151\156\164\073\001\153\004\142\162\153\073\003\156\147\073\003"
+    "\141\165\163\005\160\164\171\166\073\003\163\151\073\004\156\157"
+    "\165\073\007\162\151\141\156\147\154\145\003\143\153\073\004\164"
+    "\151\145\073\003\142\141\162\003\155\151\073\001\155\002\160\163"
+    "\002\151\154\002\143\153\003\151\164\073\003\163\163\073\003\141"
+    "\162\162\003\145\144\073\004\145\164\150\073\001\150\003\141\143"
+    "\073\005\164\163\145\161\073\003\164\141\073\004\163\150\164\073"
+    "\005\141\155\155\141\073\003\151\156\073\003\162\156\073\003\157"
+    "\160\073\004\154\141\162\073\014\142\154\145\142\141\162\167\145"
+    "\144\147\145\073\006\153\141\162\157\167\073\002\154\073\004\164"
+    "\145\162\073\004\154\157\156\073\003\141\166\145\006\156\164\145"
+    "\162\163\073\003\165\163\073\006\160\141\162\163\154\073\003\163"
+    "\164\073\003\151\147\073\003\156\163\073\003\167\156\073\002\155"
+    "\141\003\151\155\073\004\120\141\162\073\005\165\145\163\164\073"
+    "\007\162\164\156\145\161\161\073\002\105\073\004\162\163\160\073"
+    "\004\151\154\164\073\003\162\164\163\004\154\151\160\073\004\143"
+    "\157\156\073\004\164\150\164\073\004\165\154\154\073\004\150\145"
+    "\156\073\002\143\154\004\146\151\156\073\004\141\162\145\073\002"
+    "\151\156\004\154\144\145\073\004\141\151\154\073\006\155\160\164"
+    "\171\166\073\004\162\141\156\073\002\165\157\002\142\073\002\150"
+    "\073\004\157\157\162\073\003\154\153\073\006\157\162\156\145\162"
+    "\073\004\141\162\144\073\003\162\151\073\003\165\163\164\006\160"
+    "\141\162\162\157\167\004\162\145\145\073\004\155\145\163\073\005"
+    "\163\150\141\162\073\004\150\141\162\073\004\153\145\162\073\004"
+    "\155\155\141\073\002\162\157\002\165\163\004\145\154\163\073\004"
+    "\160\157\163\073\006\164\151\155\141\160\073\002\146\164\003\154"
+    "\141\073\002\165\162\002\156\147\004\165\151\166\073\003\151\163"
+    "\164\005\154\151\156\164\073\002\162\162\011\147\150\164\141\162"
+    "\162\157\167\073\002\162\151\006\151\141\156\147\154\145\005\156"
+    "\146\151\156\073\004\145\141\162\073\003\163\150\073\004\154\141"
+    "\143\073\002\166\073\004\157\154\144\073\003\151\162\073\002\156"
+    "\073\003\156\145\073\003\162\160\073\004\147\157\146\073\005\154"
+    "\157\160\145\073\002\145\163\003\157\144\073\003\151\154\073\004"
+    "\145\156\153\073\004\155\141\164\073\007\143\150\146\157\162\153"
+    "\073\006\156\164\151\156\164\073\002\156\144\003\165\145\073\002"
+    "\155\145\004\162\145\154\073\002\163\164\003\151\143\073\005\144"
+    "\150\141\162\073\002\150\164\012\151\156\147\144\157\164\163\145"
+    "\161\073\004\143\150\145\073\006\157\154\151\156\164\073\004\167"
+    "\141\162\073\002\162\164\004\164\143\171\073\004\164\155\156\073"
+    "\004\151\154\145\073\004\141\162\146\073\004\147\145\164\073\002"
+    "\162\156\003\144\145\073\006\145\172\151\165\155\073\003\170\164"
+    "\073\004\150\145\141\144\006\141\162\160\157\157\156\010\160\141"
+    "\162\162\157\167\163\073\004\147\162\164\073\004\145\162\160\073"
+    "\004\151\155\145\073\004\143\165\160\073\004\164\162\146\073\002"
+    "\152\073\021\164\141\154\104\151\146\146\145\162\145\156\164\151"
+    "\141\154\104\073\006\162\165\145\156\164\073\014\157\165\162\111"
+    "\156\164\145\147\162\141\154\073\006\157\144\165\143\164\073\007"
+    "\162\151\164\151\143\141\154\004\157\156\144\073\017\157\156\164"
+    "\157\165\162\111\156\164\145\147\162\141\154\073\004\151\147\150"
+    "\164\013\145\162\164\151\143\141\154\102\141\162\073\003\145\146"
+    "\164\007\151\156\141\162\171\111\073\005\157\155\155\141\073\014"
+    "\161\165\141\154\107\162\145\141\164\145\162\073\013\145\144\151"
+    "\165\155\123\160\141\143\145\073\002\150\151\015\145\162\171\124"
+    "\150\151\156\123\160\141\143\145\073\016\162\145\141\164\145\162"
+    "\107\162\145\141\164\145\162\073\010\145\163\163\114\145\163\163"
+    "\073\021\157\165\142\154\145\126\145\162\164\151\143\141\154\102"
+    "\141\162\073\006\162\145\141\164\145\162\003\165\155\160\001\145"
+    "\005\145\163\164\145\144\007\162\145\143\145\144\145\163\002\141"
+    "\143\004\165\143\164\073\006\157\162\164\151\157\156\015\160\105"
+    "\161\165\151\154\151\142\162\151\165\155\073\013\147\154\145\102"
+    "\162\141\143\153\145\164\073\003\162\157\167\013\142\154\145\102"
+    "\162\141\143\153\145\164\073\012\157\167\156\126\145\143\164\157"
+    "\162\073\011\145\145\126\145\143\164\157\162\073\014\156\164\145"
+    "\162\163\145\143\164\151\157\156\073\005\156\151\157\156\073\002"
+    "\145\164\004\145\145\144\163\005\124\150\141\164\073\004\162\163"
+    "\145\164\003\145\164\073\006\145\146\157\162\145\073\007\153\123"
+    "\160\141\143\145\073\006\123\160\141\143\145\073\012\124\150\151"
+    "\156\123\160\141\143\145\073\004\163\171\155\073\003\156\144\073"
+    "\002\145\073\002\163\144\002\161\073\004\157\156\147\073\007\160"
+    "\163\151\154\157\156\073\002\151\155\002\145\144\004\145\145\156"
+    "\073\004\157\167\156\073\002\153\073\002\064\073\003\157\155\073"
+    "\003\157\170\073\004\163\165\142\073\005\162\143\165\160\073\005"
+    "\162\144\157\164\073\004\141\162\153\073\002\143\073\005\162\143"
+    "\141\160\073\001\171\002\145\156\006\145\141\162\162\157\167\003"
+    "\156\170\073\001\161\006\161\165\141\162\145\073\012\157\167\156"
+    "\141\162\162\157\167\163\073\003\141\156\164\003\154\163\073\001"
+    "\166\010\143\164\141\164\151\157\156\073\011\156\145\156\164\151"
+    "\141\154\145\073\003\154\154\073\005\154\141\156\164\073\004\162"
+    "\157\170\073\011\145\146\164\141\162\162\157\167\073\003\151\145"
+    "\073\003\141\154\073\005\141\162\150\153\073\012\145\146\164\141"
+    "\162\162\157\167\163\073\012\150\162\145\145\164\151\155\145\163"
+    "\073\006\141\160\163\164\157\073\004\145\146\164\073\005\151\147"
+    "\150\164\073\004\156\147\145\073\002\164\157\005\154\154\145\154"
+    "\073\010\141\162\141\154\154\145\154\073\003\162\157\073\004\162"
+    "\151\145\073\004\154\145\154\073\003\167\157\073\007\162\156\151"
+    "\157\156\163\073\003\164\145\073\004\141\162\164\073\013\151\147"
+    "\150\164\141\162\162\157\167\163\073\012\161\165\151\147\141\162"
+    "\162\157\167\073\004\156\165\163\073\012\154\163\145\164\155\151"
+    "\156\165\163\073\003\150\160\073\004\165\154\164\073\006\160\160"
+    "\162\157\170\073\007\165\162\154\171\145\161\073\003\163\160\073"
+    "\004\156\147\154\145\005\141\160\160\141\073\007\157\164\150\151"
+    "\156\147\073\005\162\141\166\145\073\007\156\101\162\162\157\167"
+    "\073\013\151\147\150\164\126\145\143\164\157\162\073\004\162\141"
+    "\154\073\010\163\145\143\164\151\157\156\073\006\145\143\164\157"
+    "\162\073\010\156\147\162\165\145\156\164\073\005\160\103\141\160"
+    "\073\003\165\141\154\005\151\163\164\163\073\011\164\124\162\151"
+    "\141\156\147\154\145\015\166\145\162\163\145\105\154\145\155\145"
+    "\156\164\073\013\147\150\164\124\162\151\141\156\147\154\145\006"
+    "\165\141\162\145\123\165\012\165\151\154\151\142\162\151\165\155"
+    "\073\003\163\145\164\005\145\162\163\145\164\003\143\141\154\001"
+    "\142\007\157\172\145\156\147\145\073\004\165\151\164\073\007\156"
+    "\164\151\155\145\163\073\003\164\162\073\002\104\073\002\065\073"
+    "\002\070\073\005\160\162\157\170\073\005\154\145\163\163\073\004"
+    "\151\156\145\073\004\145\162\163\073\004\143\141\154\073\010\141"
+    "\162\160\157\157\156\163\073\003\163\145\073\002\167\073\004\165"
+    "\162\146\073\004\141\154\163\073\006\162\162\157\167\163\073\003"
+    "\150\151\073\003\161\161\073\003\165\142\073\004\157\162\145\073"
+    "\003\171\155\073\005\157\160\164\157\073\004\145\164\141\073\011"
+    "\142\154\145\101\143\165\164\145\073\005\143\145\145\144\163\011"
+    "\145\160\141\162\141\164\157\162\073\004\145\156\164\073\004\162"
+    "\145\143\073\004\165\143\143\073\004\147\164\162\073\002\145\161"
+    "\006\163\145\164\156\145\161"
+;
+
+static const char html_entity_values[5886] =
+    "\000\002\303\206\001\046\002\303\201\002\304\202\004\360\235\224"
+    "\204\002\303\200\002\316\221\002\304\200\003\342\251\223\003\342"
+    "\201\241\002\303\205\002\303\203\002\303\204\002\320\221\004\360"
+    "\235\224\205\004\360\235\224\271\002\313\230\003\342\204\254\003"
+    "\342\211\216\002\320\247\002\302\251\002\304\212\003\342\204\255"
+    "\002\316\247\003\342\250\257\004\360\235\222\236\002\320\202\002"
+    "\320\205\002\320\217\004\360\235\224\207\002\305\212\002\303\220"
+    "\002\303\211\002\304\226\004\360\235\224\210\002\303\210\003\342"
+    "\210\210\002\316\225\002\316\227\002\303\213\002\320\244\004\360"
+    "\235\224\211\003\342\204\261\002\320\203\001\076\002\304\236\002"
+    "\304\240\004\360\235\224\212\003\342\213\231\004\360\235\224\276"
+    "\004\360\235\222\242\003\342\211\253\002\320\252\002\304\244\003"
+    "\342\204\214\003\342\204\213\002\320\225\002\304\262\002\320\201"
+    "\002\303\215\002\304\260\003\342\204\221\002\303\214\003\342\204"
+    "\220\002\304\250\004\360\235\224\215\004\360\235\225\201\002\320"
+    "\204\002\320\245\002\320\214\002\316\232\004\360\235\224\216\004"
+    "\360\235\225\202\004\360\235\222\246\002\320\211\001\074\004\360"
+    "\235\224\217\002\304\277\003\342\211\252\003\342\244\205\002\320"
+    "\234\004\360\235\224\220\003\342\210\223\004\360\235\225\204\003"
+    "\342\204\263\002\316\234\002\320\212\002\305\203\004\360\235\224"
+    "\221\004\360\235\222\251\002\303\221\002\316\235\002\305\222\002"
+    "\303\223\002\305\220\004\360\235\224\222\002\303\222\004\360\235"
+    "\225\206\003\342\251\224\002\303\226\003\342\210\202\002\320\237"
+    "\004\360\235\224\223\002\316\246\002\316\240\002\302\261\001\042"
+    "\004\360\235\224\224\003\342\204\232\004\360\235\222\254\003\342"
+    "\244\220\002\302\256\003\342\204\234\002\316\241\003\342\207\233"
+    "\003\342\247\264\002\320\254\002\305\232\004\360\235\224\226\002"
+    "\316\243\003\342\210\230\004\360\235\225\212\004\360\235\222\256"
+    "\003\342\213\206\002\303\236\003\342\204\242\004\360\235\224\227"
+    "\004\360\235\225\213\003\342\203\233\002\305\260\004\360\235\224"
+    "\230\002\303\231\002\305\252\002\305\256\004\360\235\222\260\002"
+    "\305\250\002\303\234\003\342\212\253\003\342\253\253\002\320\222"
+    "\004\360\235\224\231\004\360\235\225\215\004\360\235\222\261\003"
+    "\342\212\252\002\305\264\003\342\213\200\004\360\235\224\232\004"
+    "\360\235\225\216\004\360\235\222\262\004\360\235\224\233\002\316"
+    "\236\004\360\235\225\217\004\360\235\222\263\002\320\257\002\320"
+    "\207\002\320\256\002\303\235\004\360\235\224\234\004\360\235\225"
+    "\220\004\360\235\222\264\002\305\270\002\320\226\002\305\271\002"
+    "\305\273\003\342\204\250\003\342\204\244\004\360\235\222\265\002"
+    "\303\241\002\304\203\002\303\246\002\303\240\002\303\245\002\303"
+    "\243\002\303\244\003\342\253\255\003\342\200\236\004\360\235\224"
+    "\237\003\342\244\215\003\342\200\265\002\304\213\004\360\235\224"
+    "\240\003\342\213\257\003\342\214\255\003\342\207\223\003\342\245"
+    "\245\002\321\222\003\342\246\246\002\304\227\003\342\205\207\003"
+    "\342\211\222\002\321\204\003\342\231\200\003\357\254\201\002\146"
+    "\152\002\306\222\003\342\250\215\004\360\235\222\273\002\304\237"
+    "\002\304\241\004\360\235\224\244\003\342\204\267\002\321\223\004"
+    "\360\235\225\230\001\140\003\342\207\224\003\342\204\217\002\304"
+    "\245\004\360\235\224\245\002\303\255\002\303\254\002\304\263\003"
+    "\342\250\274\002\302\277\004\360\235\224\247\002\310\267\004\360"
+    "\235\225\233\002\321\224\004\360\235\224\250\002\304\270\002\321"
+    "\205\002\321\234\004\360\235\225\234\004\360\235\223\200\003\342"
+    "\244\216\003\342\245\242\002\321\231\003\342\210\272\003\342\200"
+    "\224\003\342\210\241\004\360\235\224\252\003\342\204\247\003\342"
+    "\207\217\003\342\200\223\004\360\235\224\253\002\321\232\003\342"
+    "\210\244\003\342\223\210\002\305\223\003\342\210\256\004\360\235"
+    "\225\240\002\303\266\003\342\214\275\002\320\277\004\360\235\224"
+    "\255\003\342\200\210\004\360\235\224\256\003\342\250\214\004\360"
+    "\235\225\242\003\342\201\227\004\360\235\223\206\003\342\244\217"
+    "\003\342\245\244\003\342\253\256\003\342\207\211\003\342\245\250"
+    "\003\342\204\236\002\305\233\003\342\200\232\003\342\206\220\003"
+    "\342\206\222\002\303\237\003\342\216\264\003\342\214\225\004\360"
+    "\235\224\261\003\342\200\264\003\342\207\221\003\342\245\243\002"
+    "\303\271\004\360\235\223\212\003\342\246\247\003\342\207\225\003"
+    "\342\212\250\002\320\262\003\342\212\242\004\360\235\224\263\003"
+    "\342\212\262\004\360\235\225\247\003\342\210\235\003\342\212\263"
+    "\003\342\246\232\002\305\265\004\360\235\224\264\004\360\235\225"
+    "\250\003\342\204\230\004\360\235\223\214\003\342\226\275\004\360"
+    "\235\224\265\002\316\276\003\342\237\274\003\342\213\273\003\342"
+    "\213\201\002\302\245\004\360\235\224\266\002\321\227\004\360\235"
+    "\225\252\004\360\235\223\216\002\305\272\002\305\274\004\360\235"
+    "\224\267\002\320\266\003\342\207\235\004\360\235\225\253\004\360"
+    "\235\223\217\002\303\202\002\320\220\002\304\204\004\360\235\224"
+    "\270\004\360\235\222\234\003\342\211\224\003\342\210\226\003\342"
+    "\210\265\002\316\222\002\304\206\002\304\214\002\303\207\002\304"
+    "\210\003\342\210\260\002\302\270\002\302\267\003\342\212\231\003"
+    "\342\212\226\003\342\212\225\003\342\212\227\003\342\210\262\003"
+    "\342\210\263\003\342\213\223\003\342\211\215\003\342\205\205\003"
+    "\342\244\221\003\342\200\241\003\342\206\241\003\342\253\244\002"
+    "\304\216\002\320\224\003\342\210\207\002\316\224\003\342\205\206"
+    "\004\360\235\224\273\004\360\235\222\237\002\304\220\002\304\232"
+    "\002\303\212\002\320\255\002\304\222\002\304\230\004\360\235\224"
+    "\274\003\342\207\214\003\342\204\260\003\342\251\263\003\342\210"
+    "\203\003\342\227\274\003\342\226\252\004\360\235\224\275\003\342"
+    "\210\200\002\316\223\002\317\234\002\304\242\002\304\234\002\320"
+    "\223\003\342\211\247\003\342\252\242\003\342\211\267\003\342\251"
+    "\276\003\342\211\263\002\313\207\001\136\003\342\204\215\003\342"
+    "\224\200\002\304\246\003\342\211\217\002\303\216\002\320\230\003"
+    "\342\207\222\002\304\256\004\360\235\225\200\002\316\231\002\320"
+    "\206\002\303\217\002\304\264\002\320\231\004\360\235\222\245\002"
+    "\320\210\002\304\266\002\320\232\002\304\271\002\316\233\003\342"
+    "\237\252\003\342\204\222\003\342\206\236\002\304\275\002\304\273"
+    "\002\320\233\003\342\213\230\003\342\207\232\004\360\235\225\203"
+    "\003\342\206\260\002\305\201\003\342\201\237\002\305\207\002\305"
+    "\205\002\320\235\001\012\003\342\201\240\002\302\240\003\342\204"
+    "\225\002\303\224\002\320\236\002\305\214\002\316\251\002\316\237"
+    "\003\342\200\234\003\342\200\230\004\360\235\222\252\002\303\230"
+    "\002\303\225\003\342\250\267\003\342\217\234\003\342\204\231\003"
+    "\342\252\273\003\342\200\263\004\360\235\222\253\002\316\250\002"
+    "\305\224\003\342\237\253\002\305\230\002\305\226\002\320\240\003"
+    "\342\214\211\003\342\214\213\003\342\204\235\003\342\245\260\003"
+    "\342\204\233\003\342\206\261\002\320\251\002\320\250\003\342\252"
+    "\274\002\305\240\002\305\236\002\305\234\002\320\241\003\342\206"
+    "\223\003\342\206\221\003\342\210\232\003\342\210\221\002\320\213"
+    "\002\320\246\001\011\002\316\244\002\305\244\002\305\242\002\320"
+    "\242\003\342\210\274\003\342\211\203\003\342\211\205\003\342\211"
+    "\210\004\360\235\222\257\002\305\246\002\303\232\002\320\216\002"
+    "\305\254\002\303\233\002\320\243\002\305\262\004\360\235\225\214"
+    "\003\342\206\225\003\342\245\256\003\342\212\251\003\342\253\246"
+    "\002\305\266\002\320\253\002\305\275\002\320\227\003\342\200\213"
+    "\002\316\226\003\342\210\276\005\342\210\276\314\263\003\342\210"
+    "\277\002\303\242\002\302\264\002\320\260\004\360\235\224\236\002"
+    "\316\261\002\304\205\004\360\235\225\222\003\342\251\260\003\342"
+    "\251\257\003\342\211\212\003\342\211\213\001\047\004\360\235\222"
+    "\266\001\052\003\342\250\221\003\342\216\265\003\342\216\266\003"
+    "\342\211\214\002\320\261\003\342\246\260\002\317\266\003\342\250"
+    "\204\003\342\226\210\003\342\214\220\004\360\235\225\223\003\342"
+    "\213\210\002\302\246\004\360\235\222\267\003\342\201\217\002\304"
+    "\207\002\303\247\002\304\211\003\342\246\262\002\302\242\002\321"
+    "\207\002\317\207\003\342\227\213\003\342\247\203\003\342\211\227"
+    "\003\342\250\220\003\342\253\257\003\342\247\202\003\342\231\243"
+    "\003\342\206\265\003\342\234\227\004\360\235\222\270\003\342\213"
+    "\216\003\342\213\217\003\342\210\261\003\342\200\240\003\342\204"
+    "\270\002\313\235\002\304\217\002\320\264\003\342\251\267\002\302"
+    "\260\002\316\264\003\342\246\261\003\342\245\277\004\360\235\224"
+    "\241\003\342\207\203\003\342\207\202\002\302\250\002\317\235\003"
+    "\342\213\262\003\342\214\236\003\342\214\215\001\044\004\360\235"
+    "\225\225\003\342\214\206\003\342\247\266\002\304\221\003\342\213"
+    "\261\003\342\207\265\003\342\245\257\002\321\237\003\342\237\277"
+    "\003\342\211\221\002\303\251\003\342\251\256\002\304\233\003\342"
+    "\211\225\002\321\215\004\360\235\224\242\003\342\252\232\002\303"
+    "\250\003\342\252\231\003\342\217\247\003\342\204\223\002\304\223"
+    "\002\305\213\003\342\200\202\002\304\231\004\360\235\225\226\003"
+    "\342\251\261\003\342\247\245\003\342\211\223\003\342\245\261\003"
+    "\342\204\257\003\342\211\220\003\342\211\202\002\316\267\002\303"
+    "\260\002\303\253\003\342\202\254\001\041\003\357\254\203\004\360"
+    "\235\224\243\003\342\231\255\003\357\254\202\003\342\226\261\004"
+    "\360\235\225\227\003\342\214\242\003\342\252\214\002\307\265\003"
+    "\342\252\206\002\304\235\002\320\263\003\342\211\245\003\342\213"
+    "\233\003\342\252\222\003\342\252\245\003\342\252\244\003\342\211"
+    "\251\003\342\213\247\003\342\204\212\003\342\213\227\003\342\246"
+    "\225\003\342\251\274\006\342\211\251\357\270\200\003\342\200\212"
+    "\002\302\275\003\342\200\246\003\342\212\271\003\342\244\245\003"
+    "\342\244\246\003\342\207\277\003\342\210\273\004\360\235\225\231"
+    "\003\342\200\225\004\360\235\222\275\002\304\247\003\342\201\203"
+    "\003\342\200\220\003\342\201\243\002\303\256\002\320\270\002\320"
+    "\265\002\302\241\004\360\235\224\246\003\342\205\210\003\342\247"
+    "\234\003\342\204\251\003\342\212\267\002\306\265\003\342\204\205"
+    "\002\304\261\002\321\221\002\304\257\004\360\235\225\232\002\316"
+    "\271\004\360\235\222\276\003\342\201\242\002\304\251\002\321\226"
+    "\002\303\257\002\304\265\002\320\271\004\360\235\222\277\002\321"
+    "\230\002\316\272\002\317\260\002\304\267\002\320\272\003\342\207"
+    "\220\003\342\244\233\003\342\211\246\003\342\252\213\002\304\272"
+    "\003\342\246\264\002\316\273\003\342\252\205\002\302\253\003\342"
+    "\244\214\003\342\235\262\002\304\276\001\173\002\320\273\003\342"
+    "\244\266\003\342\206\262\003\342\211\244\003\342\213\232\003\342"
+    "\245\274\003\342\214\212\004\360\235\224\251\003\342\211\266\003"
+    "\342\252\221\003\342\226\204\003\342\207\207\003\342\245\253\003"
+    "\342\227\272\002\305\200\003\342\211\250\003\342\213\246\003\342"
+    "\237\246\003\342\250\264\001\050\003\342\246\223\003\342\207\206"
+    "\003\342\214\237\003\342\200\216\003\342\212\277\003\342\200\271"
+    "\004\360\235\223\201\002\305\202\003\342\213\226\003\342\213\213"
+    "\003\342\213\211\003\342\245\266\003\342\251\273\003\342\245\212"
+    "\003\342\245\246\006\342\211\250\357\270\200\002\302\257\003\342"
+    "\226\256\003\342\250\251\002\320\274\002\302\265\003\342\253\233"
+    "\003\342\212\247\004\360\235\225\236\004\360\235\223\202\002\316"
+    "\274\003\342\212\270\005\342\213\231\314\270\005\342\213\230\314"
+    "\270\003\342\212\257\003\342\212\256\002\305\204\006\342\210\240"
+    "\342\203\222\002\305\206\003\342\251\202\002\320\275\003\342\211"
+    "\240\003\342\207\227\005\342\211\220\314\270\003\342\211\242\005"
+    "\342\211\247\314\270\003\342\211\265\003\342\207\216\003\342\206"
+    "\256\003\342\253\262\003\342\210\213\003\342\207\215\005\342\211"
+    "\246\314\270\003\342\206\232\003\342\200\245\003\342\211\264\004"
+    "\360\235\225\237\002\302\254\003\342\250\224\003\342\206\233\003"
+    "\342\210\246\003\342\211\271\002\303\261\003\342\211\270\002\316"
+    "\275\003\342\212\255\003\342\244\204\006\342\211\215\342\203\222"
+    "\003\342\212\254\003\342\247\236\006\342\210\274\342\203\222\003"
+    "\342\207\226\003\342\244\247\002\303\263\003\342\212\233\002\320"
+    "\276\003\342\212\235\002\305\221\003\342\250\270\003\342\246\274"
+    "\003\342\246\277\004\360\235\224\254\002\313\233\002\303\262\003"
+    "\342\247\201\003\342\246\265\003\342\206\272\003\342\200\276\003"
+    "\342\247\200\002\305\215\002\317\211\003\342\246\267\003\342\246"
+    "\271\003\342\210\250\003\342\206\273\003\342\212\266\003\342\251"
+    "\226\003\342\251\227\003\342\251\233\003\342\204\264\002\303\270"
+    "\003\342\212\230\002\303\265\003\342\210\245\002\302\266\001\045"
+    "\001\056\003\342\200\260\003\342\212\245\003\342\200\261\003\342"
+    "\230\216\002\317\200\003\342\213\224\002\317\226\003\342\250\225"
+    "\004\360\235\225\241\002\302\243\003\342\211\272\003\342\252\263"
+    "\003\342\252\267\003\342\211\274\003\342\211\276\003\342\212\260"
+    "\004\360\235\223\205\002\317\210\003\342\244\234\003\342\246\263"
+    "\002\302\273\003\342\235\263\002\305\231\001\175\002\321\200\003"
+    "\342\244\267\003\342\245\251\003\342\206\263\003\342\226\255\003"
+    "\342\245\275\004\360\235\224\257\002\313\232\003\342\207\204\003"
+    "\342\200\217\003\342\216\261\003\342\237\247\003\342\250\265\003"
+    "\342\250\222\003\342\200\272\004\360\235\223\207\003\342\213\214"
+    "\003\342\213\212\003\342\211\273\003\342\252\264\003\342\211\275"
+    "\002\305\235\003\342\250\223\003\342\211\277\002\321\201\003\342"
+    "\213\205\003\342\212\241\003\342\251\246\003\342\207\230\002\302"
+    "\247\001\073\003\342\244\251\003\342\234\266\004\360\235\224\260"
+    "\003\342\231\257\002\302\255\003\342\247\244\002\321\214\004\360"
+    "\235\225\244\004\360\235\223\210\003\342\214\243\003\342\231\252"
+    "\003\342\207\231\003\342\244\252\003\342\214\226\002\317\204\002"
+    "\305\245\002\305\243\002\321\202\002\303\276\002\313\234\002\303"
+    "\227\003\342\210\255\003\342\244\250\003\342\217\242\002\321\233"
+    "\002\305\247\003\342\211\254\002\303\272\002\321\236\002\305\255"
+    "\002\303\273\002\321\203\003\342\207\205\002\305\261\003\342\245"
+    "\276\004\360\235\224\262\003\342\226\200\003\342\227\270\002\305"
+    "\253\002\305\263\004\360\235\225\246\003\342\212\216\003\342\207"
+    "\210\002\305\257\003\342\227\271\003\342\213\260\002\305\251\002"
+    "\303\274\003\342\253\250\003\342\253\251\003\342\246\234\003\342"
+    "\213\256\006\342\212\202\342\203\222\006\342\212\203\342\203\222"
+    "\004\360\235\223\213\003\342\211\200\003\342\213\202\003\342\227"
+    "\257\003\342\213\203\003\342\237\272\003\342\237\267\003\342\237"
+    "\270\003\342\237\265\003\342\250\200\003\342\250\202\003\342\237"
+    "\271\003\342\237\266\004\360\235\223\215\003\342\250\206\003\342"
+    "\226\263\002\303\275\002\321\217\002\305\267\002\321\213\002\321"
+    "\216\002\303\277\002\305\276\002\320\267\002\316\266\003\342\200"
+    "\215\003\342\200\214\003\342\253\247\003\342\213\222\003\342\200"
+    "\235\003\342\200\231\003\342\210\267\003\342\251\264\003\342\211"
+    "\241\003\342\210\257\003\342\204\202\003\342\210\220\003\342\213"
+    "\204\003\342\203\234\002\314\221\003\342\227\273\003\342\226\253"
+    "\003\342\251\265\002\304\252\003\342\210\254\003\342\214\210\003"
+    "\342\252\241\003\342\251\275\003\342\211\262\003\342\206\231\003"
+    "\342\206\230\003\342\253\254\003\342\252\257\003\342\210\217\003"
+    "\342\206\240\003\342\244\226\003\342\237\251\003\342\245\217\003"
+    "\342\245\234\003\342\207\200\003\342\245\223\003\342\226\241\003"
+    "\342\212\223\003\342\212\224\003\342\213\220\003\342\213\221\003"
+    "\342\210\264\002\316\230\006\342\201\237\342\200\212\003\342\200"
+    "\211\003\342\206\237\003\342\245\211\003\342\217\235\003\342\244"
+    "\222\003\342\206\245\003\342\206\226\003\342\206\227\002\317\222"
+    "\002\316\245\003\342\200\226\003\342\204\265\002\304\201\003\342"
+    "\250\277\003\342\210\247\003\342\251\225\003\342\251\234\003\342"
+    "\251\230\003\342\251\232\003\342\210\240\003\342\246\244\003\342"
+    "\215\274\003\342\212\275\002\316\262\003\342\204\266\003\342\250"
+    "\201\003\342\230\205\003\342\220\243\003\342\226\223\004\075\342"
+    "\203\245\006\342\211\241\342\203\245\003\342\247\211\003\342\212"
+    "\237\003\342\212\236\003\342\212\240\003\342\210\275\003\342\213"
+    "\215\001\134\003\342\247\205\003\342\237\210\003\342\200\242\003"
+    "\342\252\256\003\342\210\251\003\342\251\204\003\342\251\211\003"
+    "\342\251\200\006\342\210\251\357\270\200\003\342\201\201\003\342"
+    "\251\215\002\304\215\003\342\251\214\003\342\251\220\003\342\234"
+    "\223\002\313\206\001\072\004\360\235\225\224\003\342\244\270\003"
+    "\342\244\265\003\342\213\236\003\342\213\237\003\342\206\266\003"
+    "\342\244\275\003\342\210\252\003\342\251\210\003\342\212\215\003"
+    "\342\251\205\006\342\210\252\357\270\200\002\302\244\003\342\212"
+    "\243\003\342\207\212\003\342\231\246\002\303\267\003\342\213\207"
+    "\002\313\231\003\342\210\270\003\342\210\224\003\342\214\214\004"
+    "\360\235\222\271\002\321\225\003\342\226\277\003\342\226\276\003"
+    "\342\211\226\002\303\252\003\342\252\226\003\342\252\230\003\342"
+    "\252\225\003\342\252\227\003\342\210\205\003\342\200\203\003\342"
+    "\213\225\003\342\247\243\002\316\265\002\317\265\001\075\003\342"
+    "\211\237\003\357\254\200\003\357\254\204\003\342\201\204\002\316"
+    "\263\003\342\252\251\003\342\252\212\003\342\252\210\003\342\252"
+    "\216\003\342\252\220\003\342\252\247\003\342\251\272\002\321\212"
+    "\003\342\231\245\003\342\206\251\003\342\206\252\002\304\253\003"
+    "\342\210\236\003\342\247\235\003\342\210\253\003\342\212\272\003"
+    "\342\250\227\003\342\213\271\003\342\213\265\003\342\237\250\003"
+    "\342\246\221\003\342\244\235\003\342\206\253\003\342\244\271\003"
+    "\342\245\263\003\342\206\242\003\342\252\253\003\342\244\231\002"
+    "\304\274\003\342\245\247\003\342\245\213\003\342\252\250\003\342"
+    "\206\275\003\342\216\260\003\342\252\211\003\342\252\207\003\342"
+    "\237\254\003\342\207\275\003\342\206\254\003\342\246\205\004\360"
+    "\235\225\235\003\342\250\255\003\342\210\227\001\137\003\342\227"
+    "\212\003\342\247\253\003\342\207\213\003\342\245\255\003\342\252"
+    "\215\003\342\252\217\001\133\003\342\252\246\003\342\251\271\003"
+    "\342\246\226\003\342\231\202\003\342\206\246\003\342\210\243\003"
+    "\342\253\260\003\342\210\222\006\342\211\253\342\203\222\005\342"
+    "\211\253\314\270\006\342\211\252\342\203\222\005\342\211\252\314"
+    "\270\003\342\211\211\005\342\251\260\314\270\005\342\211\213\314"
+    "\270\002\305\211\003\342\231\256\005\342\211\216\314\270\005\342"
+    "\211\217\314\270\003\342\251\203\002\305\210\003\342\211\207\005"
+    "\342\251\255\314\270\003\342\244\244\005\342\211\202\314\270\003"
+    "\342\210\204\003\342\211\261\005\342\251\276\314\270\003\342\211"
+    "\257\003\342\213\274\003\342\213\272\003\342\211\260\003\342\211"
+    "\256\006\342\253\275\342\203\245\005\342\210\202\314\270\003\342"
+    "\212\200\003\342\213\240\005\342\244\263\314\270\005\342\206\235"
+    "\314\270\003\342\213\253\003\342\213\255\003\342\212\201\003\342"
+    "\213\241\005\342\252\260\314\270\004\360\235\223\203\003\342\211"
+    "\201\003\342\213\242\003\342\213\243\001\043\003\342\204\226\003"
+    "\342\200\207\006\342\211\245\342\203\222\004\076\342\203\222\003"
+    "\342\244\202\006\342\211\244\342\203\222\003\342\244\203\006\342"
+    "\212\265\342\203\222\003\342\244\243\003\342\212\232\002\303\264"
+    "\003\342\246\276\003\342\246\273\002\316\277\003\342\246\266\003"
+    "\342\251\235\002\302\252\002\302\272\003\342\250\266\003\342\253"
+    "\263\003\342\253\275\002\317\206\002\317\225\001\053\003\342\250"
+    "\243\003\342\250\242\003\342\251\262\003\342\250\246\003\342\250"
+    "\247\003\342\200\262\003\342\252\265\003\342\252\271\003\342\213"
+    "\250\003\342\250\226\001\077\005\342\210\275\314\261\002\305\225"
+    "\003\342\246\222\003\342\246\245\003\342\245\265\003\342\244\263"
+    "\003\342\244\236\003\342\245\205\003\342\245\264\003\342\206\243"
+    "\003\342\206\235\003\342\244\232\002\305\227\003\342\207\201\002"
+    "\317\201\002\317\261\003\342\237\255\003\342\207\276\003\342\246"
+    "\206\004\360\235\225\243\003\342\250\256\001\051\003\342\246\224"
+    "\001\135\003\342\226\271\003\342\212\265\003\342\226\270\003\342"
+    "\247\216\003\342\252\270\002\305\241\003\342\252\260\002\305\237"
+    "\003\342\252\266\003\342\252\272\003\342\213\251\002\321\211\002"
+    "\321\210\002\317\203\002\317\202\003\342\251\252\003\342\211\206"
+    "\003\342\250\244\003\342\245\262\003\342\250\263\003\342\252\252"
+    "\001\057\003\342\231\240\003\342\230\206\003\342\212\202\003\342"
+    "\253\205\003\342\252\275\003\342\253\201\003\342\252\277\003\342"
+    "\245\271\002\302\271\002\302\262\002\302\263\003\342\212\203\003"
+    "\342\253\206\003\342\245\273\003\342\253\202\003\342\253\200\003"
+    "\342\250\260\003\342\212\244\003\342\214\266\003\342\253\261\003"
+    "\342\227\254\003\342\211\234\003\342\250\272\003\342\250\271\003"
+    "\342\247\215\003\342\250\273\004\360\235\223\211\002\321\206\003"
+    "\342\206\277\003\342\206\276\003\342\214\217\002\317\205\003\342"
+    "\214\216\003\342\226\265\003\342\226\264\003\342\212\273\003\342"
+    "\211\232\001\174\003\342\251\237\004\360\235\225\251\003\342\244"
+    "\223\003\342\245\220\003\342\245\236\003\342\245\237\003\342\206"
+    "\247\003\342\206\224\003\342\245\216\003\342\245\221\003\342\245"
+    "\240\003\342\206\274\003\342\245\222\003\342\211\255\003\342\210"
+    "\211\005\342\252\242\314\270\005\342\252\241\314\270\005\342\252"
+    "\257\314\270\003\342\210\214\003\342\211\204\003\342\217\236\003"
+    "\342\207\245\003\342\245\235\003\342\245\233\003\342\247\220\003"
+    "\342\245\224\003\342\212\206\003\342\212\207\003\342\210\237\003"
+    "\342\210\242\003\342\214\205\003\342\226\222\003\342\226\221\003"
+    "\342\225\227\003\342\225\224\003\342\225\226\003\342\225\223\003"
+    "\342\225\220\003\342\225\246\003\342\225\251\003\342\225\244\003"
+    "\342\225\247\003\342\225\235\003\342\225\232\003\342\225\234\003"
+    "\342\225\231\003\342\225\221\003\342\225\254\003\342\225\243\003"
+    "\342\225\240\003\342\225\253\003\342\225\242\003\342\225\237\003"
+    "\342\225\225\003\342\225\222\003\342\224\220\003\342\224\214\003"
+    "\342\225\245\003\342\225\250\003\342\224\254\003\342\224\264\003"
+    "\342\225\233\003\342\225\230\003\342\224\230\003\342\224\224\003"
+    "\342\224\202\003\342\225\252\003\342\225\241\003\342\225\236\003"
+    "\342\224\274\003\342\224\244\003\342\224\234\003\342\251\213\003"
+    "\342\251\207\001\054\001\100\003\342\210\201\003\342\251\255\003"
+    "\342\204\227\003\342\253\217\003\342\253\221\003\342\253\220\003"
+    "\342\253\222\003\342\251\206\003\342\251\212\003\342\206\267\003"
+    "\342\244\274\003\342\200\204\003\342\200\205\003\342\251\270\003"
+    "\342\253\231\003\342\205\230\003\342\205\236\003\342\252\200\006"
+    "\342\213\233\357\270\200\003\342\252\224\003\342\245\270\003\342"
+    "\245\210\003\342\206\255\003\342\213\264\003\342\213\263\003\342"
+    "\207\244\003\342\244\237\003\342\252\255\006\342\252\255\357\270"
+    "\200\003\342\246\213\003\342\251\277\006\342\213\232\357\270\200"
+    "\003\342\252\223\003\342\245\252\003\342\227\203\003\342\212\264"
+    "\003\342\227\202\003\342\234\240\003\342\206\244\003\342\250\252"
+    "\005\342\251\275\314\270\003\342\213\252\003\342\213\254\005\342"
+    "\213\271\314\270\005\342\213\265\314\270\003\342\212\204\005\342"
+    "\253\205\314\270\003\342\212\210\003\342\212\205\005\342\253\206"
+    "\314\270\003\342\212\211\004\074\342\203\222\006\342\212\264\342"
+    "\203\222\003\342\204\216\003\342\250\245\003\342\214\256\003\342"
+    "\214\222\003\342\214\223\003\342\244\240\003\342\210\266\003\342"
+    "\246\214\003\342\245\254\003\342\252\236\003\342\252\240\003\342"
+    "\252\235\003\342\252\237\003\342\252\254\006\342\252\254\357\270"
+    "\200\003\342\247\204\003\342\214\277\006\342\212\223\357\270\200"
+    "\006\342\212\224\357\270\200\003\342\212\217\003\342\212\221\003"
+    "\342\212\220\003\342\212\222\003\342\253\203\003\342\253\213\003"
+    "\342\212\212\003\342\253\207\003\342\252\276\003\342\253\230\003"
+    "\342\253\204\003\342\237\211\003\342\253\227\003\342\253\214\003"
+    "\342\212\213\003\342\253\210\002\316\270\002\317\221\003\342\250"
+    "\261\004\360\235\225\245\003\342\253\232\003\342\214\234\003\342"
+    "\214\235\006\342\253\213\357\270\200\006\342\212\212\357\270\200"
+    "\006\342\253\214\357\270\200\006\342\212\213\357\270\200\003\342"
+    "\211\231\003\342\245\226\003\342\245\227\003\342\245\241\003\342"
+    "\245\232\003\342\247\217\003\342\245\230\005\342\247\217\314\270"
+    "\005\342\247\220\314\270\003\342\245\225\003\342\217\237\003\342"
+    "\235\230\003\342\246\250\003\342\246\251\003\342\246\252\003\342"
+    "\246\253\003\342\246\254\003\342\246\255\003\342\246\256\003\342"
+    "\246\257\003\342\212\276\003\342\246\235\003\342\205\223\002\302"
+    "\274\003\342\205\225\003\342\205\231\003\342\205\233\003\342\205"
+    "\224\003\342\205\226\002\302\276\003\342\205\227\003\342\205\234"
+    "\003\342\205\232\003\342\205\235\003\342\252\202\003\342\252\204"
+    "\003\342\246\217\003\342\246\215\003\342\252\201\003\342\252\203"
+    "\003\342\213\267\003\342\213\266\003\342\213\276\003\342\213\275"
+    "\003\342\246\216\003\342\246\220\003\342\253\225\003\342\253\223"
+    "\003\342\253\224\003\342\253\226\003\342\245\231\005\342\212\217"
+    "\314\270\005\342\212\220\314\270\005\342\211\277\314\270"
+;
+
+#endif // _HTML_ENTITY_TRIE_H_
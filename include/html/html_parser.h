@@ -1,11 +1,112 @@
 #ifndef _HTML_H_
 #define _HTML_H_
 
-#define MAX_TAG_LEN         16
-#define MAX_ATTR_NAME_LEN   32
-#define MAX_ATTR_VAL_LEN    512
-// #define MAX_ATTR_CONTENT_LEN     512 // TODO, also find shorter name for this
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
 
-extern void HTML_BeginParse(char* html_data);
+#include "arena.h"
+#include "html_document.h"
+#include "html_token.h"
+
+// Smallest piece a parallel parse will split a document into.
+#ifndef HTML_PARALLEL_MIN_CHUNK
+#define HTML_PARALLEL_MIN_CHUNK     (256 * 1024)
+#endif
+
+// Most threads a parallel parse will use.
+#define HTML_PARALLEL_MAX_THREADS   64
+
+// How much source an incremental re-parse tokenizes before
+// checking whether it has caught back up with the old tree.
+#define HTML_REPARSE_WINDOW         4096
+
+// Least room an edited document's source keeps for the
+// next edits. It grows along with the document.
+#define HTML_SOURCE_GAP_LEN         4096
+
+// Longest document that can be parsed, since nodes keep
+// their offsets and text lengths in 32 bits.
+#define HTML_DOCUMENT_MAX_LEN       UINT32_MAX
+
+// How many tokens HTML_TokenizeMarkup asks for at a time.
+#define HTML_TOKEN_BATCH            128
+
+// Smallest buffer HTML_NextTokens can fill: a start tag
+// can come with the text before it, and raw text content
+// with its end tag after.
+#define HTML_TOKEN_MIN_BATCH        4
+
+// Most of a tag the cleaner might have to hold on to from
+// the end of one piece, to tell if it's "</textarea" or not.
+#define HTML_CLEANER_PENDING_LEN    16
+
+typedef struct {
+    bool    preformatted;   // Currently inside of a <pre> or <textarea>.
+    size_t  bytes_saved;    // Total amount of whitespace removed so far.
+    char    last;           // Last byte kept, its whitespace rules carry on into the next piece.
+    char    pending[HTML_CLEANER_PENDING_LEN]; // Start of a tag cut off at the end of the last piece.
+    size_t  pending_len;
+} html_cleaner_t;
+
+//
+// Where tokenizing a stretch of a document is at, between
+// batches of tokens. Batches only ever end between two
+// pieces of markup, so nothing else has to be kept.
+//
+typedef struct {
+    html_document_t*    document;           // For attribute values and the counters.
+    char*               data;
+    size_t              length;
+    size_t              start;
+    size_t              end;                // Markup starting from here on is left alone.
+    size_t              pos;                // Where to look for the next '<'.
+    size_t              text_start;         // Where the current run of text started.
+    bool                parse_attributes;   // Or just step over them.
+    bool                finished;
+} html_tokenstate_t;
+
+//
+// How far a look for the end of a piece of markup got
+// before the data ran out, so it can pick up from there
+// once more arrives rather than starting over.
+//
+typedef struct {
+    size_t              start;              // The '<' it starts at.
+    size_t              pos;                // Where to carry on from.
+    byte                state;              // Tokenizer state at pos.
+} html_markupscan_t;
+
+//
+// A change to a document's (cleaned) source: removed bytes
+// starting at offset are replaced with text.
+//
+typedef struct {
+    size_t          offset;
+    size_t          removed;
+    const char*     text;
+    size_t          text_len;
+} html_edit_t;
+
+extern size_t HTML_CleanDocument(char* html_data, size_t length, html_cleaner_t* cleaner);
+extern bool HTML_IsRawTextElement(byte tag);
+extern const char* HTML_FindRawTextTag(char* data, size_t remaining);
+extern size_t HTML_FindRawTextEnd(char* html_data, size_t length, size_t start, const char* name);
+extern void HTML_BeginMarkupScan(html_markupscan_t* scan, size_t start);
+extern size_t HTML_ContinueMarkupScan(char* data, size_t length, html_markupscan_t* scan);
+extern size_t HTML_FindMarkupEnd(char* data, size_t length, size_t start);
+extern void HTML_BeginTokens(html_tokenstate_t* state, html_document_t* document, char* html_data,
+                                size_t length, size_t start, size_t end);
+extern size_t HTML_NextTokens(html_tokenstate_t* state, html_token_t* tokens, attribute_t* attributes,
+                                size_t capacity);
+extern size_t HTML_TokenizeMarkup(html_document_t* document, char* html_data, size_t length,
+                                    size_t start, size_t end, html_tokenemit_t emit, void* context);
+extern void HTML_ParseMarkup(html_document_t* document, char* html_data, size_t length);
+extern bool HTML_CheckDocumentLength(size_t length);
+extern html_document_t* HTML_BeginParse(char* html_data, size_t length);
+extern html_document_t* HTML_BeginParseInArena(arena_t* arena, char* html_data, size_t length);
+extern html_document_t* HTML_BeginParseParallel(char* html_data, size_t length, int threads);
+extern bool HTML_ReparseEdit(html_document_t* document, const html_edit_t* edit);
+extern char* HTML_DocumentSource(html_document_t* document);
 
 #endif // _HTML_H_
@@ -0,0 +1,34 @@
+#ifndef _HTML_TOKEN_H_
+#define _HTML_TOKEN_H_
+
+#include <stdint.h>
+
+#include "types.h"
+#include "html_datatype.h"
+
+// Token types.
+#define HTML_TOKEN_START        0
+#define HTML_TOKEN_END          1
+#define HTML_TOKEN_TEXT         2
+#define HTML_TOKEN_RAWTEXT      3   // Text kept as written, <script> and <style> content.
+
+//
+// One piece of markup, as the tokenizer hands it to the
+// tree builder. Laid out like a node: text tokens are a
+// slice of the document, start tags carry their attributes.
+//
+typedef struct {
+    byte                    type;           // HTML_TOKEN_*
+    byte                    tag;            // HTML_ELEM_* for start and end tags.
+    uint32_t                text_len;       // Length of text, for text tokens.
+    uint32_t                offset;         // Where the token starts in the document.
+    union {
+        const char*         text;           // Slice of the document, for text tokens.
+        attribute_t*        attributes;     // NULL if the start tag had none.
+    };
+} html_token_t;
+
+// Receives each token as it's produced.
+typedef void (*html_tokenemit_t)(void* context, const html_token_t* token);
+
+#endif // _HTML_TOKEN_H_
@@ -0,0 +1,32 @@
+#ifndef _HTML_TOKENIZER_H_
+#define _HTML_TOKENIZER_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "html_parser.h"
+
+// Initial size of the window holding not-yet-parsed input.
+// Text is split to keep it around this size, but a tag,
+// comment or raw text element is tokenized in one piece,
+// so the window grows to fit one that's still coming in.
+#define TOKENIZER_WINDOW_LEN    4096
+
+typedef struct {
+    char*           window;     // Input that arrived but hasn't been parsed yet.
+    size_t          length;     // Amount of data currently in the window.
+    size_t          capacity;   // Allocated size of the window.
+    size_t          scanned;    // How much of the window has been looked through.
+    size_t          boundary;   // End of the last complete piece of markup in it.
+    bool            in_markup;  // Whether scanned is partway into a piece of markup,
+    html_markupscan_t markup;   // and if so, how far that got.
+    const char*     raw_name;   // Raw text element whose end tag is still to come.
+    html_cleaner_t  cleaner;    // Whitespace state carried between chunks.
+    html_document_t* document;  // Document being built from the input.
+} html_tokenizer_t;
+
+extern html_tokenizer_t* HTML_TokenizerCreate(void);
+extern void HTML_TokenizerFeed(html_tokenizer_t* tok, char* buf, size_t len);
+extern html_document_t* HTML_TokenizerFinish(html_tokenizer_t* tok);
+
+#endif // _HTML_TOKENIZER_H_
@@ -0,0 +1,38 @@
+#ifndef _INTERN_H_
+#define _INTERN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "types.h"
+#include "arena.h"
+
+// Starting number of slots in a table, it doubles as needed.
+#define INTERN_TABLE_LEN    256
+
+typedef struct {
+    const char*             ptr;        // The table's copy of the string, NULL if unused.
+    uint32_t                len;
+    uint32_t                hash;
+} intern_entry_t;
+
+//
+// Every distinct string added to the table is stored just
+// once, in the table's arena, and adding it again hands
+// back that same copy. So two interned strings are equal
+// exactly when their pointers are.
+//
+typedef struct {
+    arena_t*                arena;      // Holds the strings (and the table itself).
+    intern_entry_t*         entries;    // Open addressed, on the heap so it can grow.
+    uint32_t                count;
+    uint32_t                capacity;
+} intern_table_t;
+
+extern intern_table_t* Intern_Create(arena_t* arena);
+extern slice_t Intern_String(intern_table_t* table, const char* str, size_t len);
+extern void Intern_Keep(intern_table_t* table, const char* str, size_t len);
+extern void Intern_Destroy(intern_table_t* table);
+
+#endif // _INTERN_H_
@@ -1,6 +1,18 @@
 #ifndef _PRTCL_H_
 #define _PRTCL_H_
 
-extern char* PRTCL_RetrieveDocument(char* req_uri);
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
 
-#endif // _PRTCL_H_
\ No newline at end of file
+typedef struct {
+    char*   data;       // The document contents, always NUL terminated.
+    size_t  length;     // Size of the document, not counting the terminator.
+    bool    mapped;     // Whether data is a memory mapping or a heap buffer.
+    size_t  map_size;   // Size of the mapping, if there is one.
+} prtcl_document_t;
+
+extern prtcl_document_t* PRTCL_RetrieveDocument(char* req_uri);
+extern void PRTCL_ReleaseDocument(prtcl_document_t* document);
+
+#endif // _PRTCL_H_
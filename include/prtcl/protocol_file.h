@@ -1,6 +1,12 @@
 #ifndef _PRTCL_FILE_H_
 #define _PRTCL_FILE_H_
 
-extern char* PRTCL_RetrieveFile(char* file_path);
+#include "protocol.h"
 
-#endif // _PRTCL_FILE_H_
\ No newline at end of file
+// How much to grow the buffer by when reading from
+// something that can't be mapped, like a pipe.
+#define PRTCL_READ_CHUNK_LEN    65536
+
+extern prtcl_document_t* PRTCL_RetrieveFile(char* file_path);
+
+#endif // _PRTCL_FILE_H_
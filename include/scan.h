@@ -0,0 +1,28 @@
+#ifndef _SCAN_H_
+#define _SCAN_H_
+
+#include <stddef.h>
+
+#include "types.h"
+
+// Most characters a single scan can look for at once.
+#define SCAN_SET_MAX        8
+
+//
+// A set of delimiters to scan for. Build these with
+// SCAN_SET so they can be static and const, e.g.
+//   static const scan_set_t quotes = SCAN_SET('"', '\'');
+//
+typedef struct {
+    char                    chars[SCAN_SET_MAX];
+    byte                    count;
+} scan_set_t;
+
+#define SCAN_SET(...) \
+    { .chars = {__VA_ARGS__}, .count = sizeof((char[]){__VA_ARGS__}) }
+
+extern size_t Scan_FindAny(const char* data, size_t length, size_t start, const scan_set_t* set);
+extern size_t Scan_FindNonASCII(const char* data, size_t length, size_t start);
+extern const char* Scan_Implementation(void);
+
+#endif // _SCAN_H_
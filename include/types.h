@@ -1,6 +1,19 @@
 #ifndef _TYPE_H_
 #define _TYPE_H_
 
+#include <stddef.h>
+
 typedef unsigned char byte;
 
+// A view of part of a string, which isn't necessarily
+// NUL terminated. Used to point into the document instead
+// of copying bits of it around.
+typedef struct {
+    const char*     ptr;
+    size_t          len;
+} slice_t;
+
+// For printing slices with "%.*s".
+#define SLICE_ARGS(s)   (int)(s).len, (s).ptr
+
 #endif // _TYPE_H_
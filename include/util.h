@@ -1,9 +1,81 @@
 #ifndef _UTIL_H_
 #define _UTIL_H_
 
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
 #include "types.h"
 
 extern void Util_CharDeleteAtIndex(char* src, int index);
 extern char* Util_BuildStringFromChunk(char* str, int start, int end);
 
+extern slice_t Util_SliceTrim(slice_t slice);
+extern bool Util_SliceEqualsNoCase(slice_t slice, const char* str);
+extern int Util_SliceToInt(slice_t slice);
+extern double Util_SliceToDouble(slice_t slice);
+
+extern uint64_t Util_HashData(const void* data, size_t len);
+extern size_t Util_EncodeUTF8(uint32_t codepoint, char* out);
+
+static inline slice_t Util_Slice(const char* ptr, size_t len)
+{
+    slice_t slice = {ptr, len};
+    return slice;
+}
+
+//
+// Perfect hash helpers, used by the tables generated with
+// tools/gen_perfect_hash.py. Keep these in sync with it!
+//
+
+// Case-insensitive FNV-1a. OR'ing with 0x20 lowercases
+// letters and leaves digits and most punctuation as-is;
+// anything it mangles is caught by Util_FoldEquals.
+static inline uint32_t Util_HashFold(const char* str, size_t len)
+{
+    uint32_t hash = 0x811C9DC5;
+
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (byte)str[i] | 0x20;
+        hash *= 0x01000193;
+    }
+
+    return hash;
+}
+
+// Turns a key hash plus its bucket's displacement into a
+// slot in the table.
+static inline uint32_t Util_HashSlot(uint32_t hash, uint32_t displace, uint32_t mask)
+{
+    hash += displace * 0x9E3779B9;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+
+    return hash & mask;
+}
+
+// Compares str against an all-lowercase key, ignoring
+// the case of str.
+static inline bool Util_FoldEquals(const char* str, size_t len, const char* key, size_t key_len)
+{
+    if (len != key_len)
+        return false;
+
+    for (size_t i = 0; i < len; i++) {
+        char c = str[i];
+
+        if (c >= 'A' && c <= 'Z')
+            c += 'a' - 'A';
+
+        if (c != key[i])
+            return false;
+    }
+
+    return true;
+}
+
 #endif // _UTIL_H_
@@ -0,0 +1,176 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <arena.h>
+
+//
+// A bump allocator. Memory is carved out of large blocks
+// and never freed individually, everything goes away at
+// once in Arena_Destroy. Documents own one of these so
+// parsing doesn't hit malloc for every tag and attribute.
+//
+
+// Block headers are padded so the data after them
+// stays aligned.
+#define ARENA_HEADER_LEN \
+    ((sizeof(arena_block_t) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+static arena_block_t* Arena_NewBlock(size_t size)
+{
+    arena_block_t* block = malloc(ARENA_HEADER_LEN + size);
+
+    if (block == NULL) {
+        printf("Arena_NewBlock: Out of memory allocating %zu bytes\n", size);
+        exit(1);
+    }
+
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+
+    return block;
+}
+
+arena_t* Arena_Create(size_t block_size)
+{
+    arena_t* arena = malloc(sizeof(arena_t));
+
+    arena->block_size = block_size;
+    arena->head = Arena_NewBlock(block_size);
+    arena->allocations = 0;
+    arena->bytes = 0;
+
+    return arena;
+}
+
+void* Arena_Alloc(arena_t* arena, size_t size)
+{
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+    arena->allocations++;
+    arena->bytes += size;
+
+    // Doesn't fit, start a new block. Anything big enough to
+    // waste most of a block gets one all to itself, placed
+    // behind the current block so we keep filling that.
+    if (arena->head->used + size > arena->head->size) {
+        if (size > arena->block_size / 4) {
+            arena_block_t* big = Arena_NewBlock(size);
+            big->used = size;
+            big->next = arena->head->next;
+            arena->head->next = big;
+            return (byte*)big + ARENA_HEADER_LEN;
+        }
+
+        arena_block_t* block = Arena_NewBlock(arena->block_size);
+        block->next = arena->head;
+        arena->head = block;
+    }
+
+    void* ptr = (byte*)arena->head + ARENA_HEADER_LEN + arena->head->used;
+    arena->head->used += size;
+
+    return ptr;
+}
+
+//
+// Arena_StringFromChunk
+// -----
+// Copies len characters of str into the arena as a NUL
+// terminated string.
+//
+char* Arena_StringFromChunk(arena_t* arena, const char* str, size_t len)
+{
+    char* dest = Arena_Alloc(arena, len + 1);
+    memcpy(dest, str, len);
+    dest[len] = '\0';
+    return dest;
+}
+
+//
+// Arena_Adopt
+// -----
+// Moves every block of other into arena, so whatever was
+// allocated from it lives as long as arena does. other is
+// freed and can't be used afterwards.
+//
+void Arena_Adopt(arena_t* arena, arena_t* other)
+{
+    arena_block_t* tail = other->head;
+    while (tail->next != NULL)
+        tail = tail->next;
+
+    // Slot them in behind the head so we keep filling
+    // the block we were already using.
+    tail->next = arena->head->next;
+    arena->head->next = other->head;
+
+    arena->allocations += other->allocations;
+    arena->bytes += other->bytes;
+
+    free(other);
+}
+
+//
+// Arena_Reset
+// -----
+// Throws away everything allocated from the arena but
+// keeps one block around, so an arena can be reused for
+// document after document without going back to malloc.
+//
+void Arena_Reset(arena_t* arena)
+{
+    arena_block_t* keep = NULL;
+    arena_block_t* block = arena->head;
+
+    while (block != NULL) {
+        arena_block_t* next = block->next;
+
+        if (keep == NULL && block->size == arena->block_size)
+            keep = block;
+        else
+            free(block);
+
+        block = next;
+    }
+
+    if (keep == NULL)
+        keep = Arena_NewBlock(arena->block_size);
+
+    keep->next = NULL;
+    keep->used = 0;
+
+    arena->head = keep;
+    arena->allocations = 0;
+    arena->bytes = 0;
+}
+
+void Arena_Destroy(arena_t* arena)
+{
+    arena_block_t* block = arena->head;
+
+    while (block != NULL) {
+        arena_block_t* next = block->next;
+        free(block);
+        block = next;
+    }
+
+    free(arena);
+}
@@ -0,0 +1,265 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
+
+#include <util.h>
+#include <arena.h>
+#include <batch.h>
+#include <prtcl/protocol.h>
+#include <html/html_parser.h>
+#include <html/html_cache.h>
+#include <html/html_charset.h>
+
+//
+// Batch mode parses a whole list of documents in one
+// process. A pool of workers pulls URIs off a shared
+// counter, and each worker parses into its own arena,
+// which gets reset between documents rather than freed.
+//
+
+typedef struct {
+    batch_list_t*           list;
+    const char*             cache_dir;      // Parse cache, NULL if not in use.
+    size_t                  next;           // Next URI to hand out, shared.
+    pthread_mutex_t         output_lock;    // Keeps status lines whole.
+} batch_queue_t;
+
+typedef struct {
+    batch_queue_t*          queue;
+    pthread_t               thread;
+    size_t                  documents;
+    size_t                  failed;
+    size_t                  bytes;
+    size_t                  nodes;
+} batch_worker_t;
+
+static double Batch_Seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void Batch_InitList(batch_list_t* list)
+{
+    list->uris = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
+
+void Batch_AddURI(batch_list_t* list, const char* uri)
+{
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : 64;
+        list->uris = realloc(list->uris, sizeof(char*) * list->capacity);
+    }
+
+    list->uris[list->count++] = strdup(uri);
+}
+
+//
+// Batch_ReadList
+// -----
+// Adds every line of file as a URI, skipping blank lines
+// and ones starting with '#'.
+//
+void Batch_ReadList(batch_list_t* list, FILE* file)
+{
+    char* line = NULL;
+    size_t line_capacity = 0;
+    ssize_t len;
+
+    while ((len = getline(&line, &line_capacity, file)) != -1) {
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r' ||
+                            line[len - 1] == ' ' || line[len - 1] == '\t'))
+            line[--len] = '\0';
+
+        if (len == 0 || line[0] == '#')
+            continue;
+
+        Batch_AddURI(list, line);
+    }
+
+    free(line);
+}
+
+void Batch_FreeList(batch_list_t* list)
+{
+    for (size_t i = 0; i < list->count; i++)
+        free(list->uris[i]);
+
+    free(list->uris);
+    Batch_InitList(list);
+}
+
+static void* Batch_Worker(void* arg)
+{
+    batch_worker_t* worker = arg;
+    batch_queue_t* queue = worker->queue;
+    arena_t* arena = Arena_Create(ARENA_BLOCK_LEN);
+
+    for (;;) {
+        size_t index = __atomic_fetch_add(&queue->next, 1, __ATOMIC_RELAXED);
+        if (index >= queue->list->count)
+            break;
+
+        char* uri = queue->list->uris[index];
+        double start = Batch_Seconds();
+
+        prtcl_document_t* document = PRTCL_RetrieveDocument(uri);
+
+        if (document == NULL) {
+            worker->failed++;
+
+            pthread_mutex_lock(&queue->output_lock);
+            printf("FAIL %s\n", uri);
+            pthread_mutex_unlock(&queue->output_lock);
+            continue;
+        }
+
+        size_t length = document->length;
+        html_document_t* html = NULL;
+        uint64_t hash = 0;
+
+        // Hashed before parsing, which changes the document.
+        if (queue->cache_dir != NULL) {
+            hash = Util_HashData(document->data, length);
+            html = HTML_CreateDocumentInArena(arena);
+
+            if (!HTML_LoadCache(html, queue->cache_dir, hash, length)) {
+                HTML_FreeDocument(html);
+                html = NULL;
+            }
+        }
+
+        html_input_t input = {0};
+
+        if (html == NULL) {
+            HTML_DecodeInput(&input, document->data, length);
+            html = HTML_BeginParseInArena(arena, input.data, input.length);
+
+            if (html != NULL && queue->cache_dir != NULL)
+                HTML_SaveCache(html, queue->cache_dir, hash, length);
+        }
+
+        if (html == NULL) {
+            worker->failed++;
+            HTML_FreeInput(&input);
+            PRTCL_ReleaseDocument(document);
+            Arena_Reset(arena);
+
+            pthread_mutex_lock(&queue->output_lock);
+            printf("FAIL %s\n", uri);
+            pthread_mutex_unlock(&queue->output_lock);
+            continue;
+        }
+
+        uint32_t nodes = html->node_count;
+
+        HTML_FreeDocument(html);
+        HTML_FreeInput(&input);
+        PRTCL_ReleaseDocument(document);
+        Arena_Reset(arena);
+
+        double elapsed = Batch_Seconds() - start;
+
+        worker->documents++;
+        worker->bytes += length;
+        worker->nodes += nodes;
+
+        pthread_mutex_lock(&queue->output_lock);
+        printf("OK   %s %zu bytes %u nodes %.3f ms\n", uri, length, nodes, elapsed * 1000.0);
+        pthread_mutex_unlock(&queue->output_lock);
+    }
+
+    Arena_Destroy(arena);
+
+    return NULL;
+}
+
+//
+// Batch_Run
+// -----
+// Parses every document in the list using the given
+// number of threads, then prints totals. Returns the
+// number of documents that couldn't be retrieved or
+// parsed. If cache_dir isn't NULL, documents go through
+// the parse cache there.
+//
+int Batch_Run(batch_list_t* list, int threads, const char* cache_dir)
+{
+    if (threads < 1)
+        threads = 1;
+    if (threads > BATCH_MAX_THREADS)
+        threads = BATCH_MAX_THREADS;
+    if (threads > list->count && list->count > 0)
+        threads = list->count;
+
+    batch_queue_t queue;
+    queue.list = list;
+    queue.cache_dir = cache_dir;
+    queue.next = 0;
+    pthread_mutex_init(&queue.output_lock, NULL);
+
+    batch_worker_t* workers = calloc(threads, sizeof(batch_worker_t));
+    double start = Batch_Seconds();
+
+    for (int i = 0; i < threads; i++) {
+        workers[i].queue = &queue;
+
+        if (pthread_create(&workers[i].thread, NULL, Batch_Worker, &workers[i]) != 0) {
+            printf("Batch_Run: Couldn't start worker %d, continuing with %d\n", i, i);
+            threads = i;
+            break;
+        }
+    }
+
+    // Couldn't start anything, do the work here instead.
+    if (threads == 0) {
+        workers[0].queue = &queue;
+        Batch_Worker(&workers[0]);
+        threads = 1;
+    } else {
+        for (int i = 0; i < threads; i++)
+            pthread_join(workers[i].thread, NULL);
+    }
+
+    double elapsed = Batch_Seconds() - start;
+
+    size_t documents = 0, failed = 0, bytes = 0, nodes = 0;
+    for (int i = 0; i < threads; i++) {
+        documents += workers[i].documents;
+        failed += workers[i].failed;
+        bytes += workers[i].bytes;
+        nodes += workers[i].nodes;
+    }
+
+    printf("Parsed %zu documents (%zu failed) with %d threads in %.3f s\n",
+        documents, failed, threads, elapsed);
+    printf("%.1f MB/s, %.1f documents/s, %zu nodes\n",
+        (bytes / (1024.0 * 1024.0)) / elapsed, documents / elapsed, nodes);
+
+    pthread_mutex_destroy(&queue.output_lock);
+    free(workers);
+
+    return failed;
+}
@@ -0,0 +1,152 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include <diag.h>
+
+//
+// Diagnostics about the documents being parsed: unknown
+// elements, attribute values that don't make sense and so
+// on. Each one goes to a single process-wide sink, which
+// prints them by default. With no sink they're only
+// counted, and the message is never even formatted, so
+// broken pages cost next to nothing extra.
+//
+
+static diag_sink_t diag_sink = Diag_PrintSink;
+static void* diag_context = NULL;
+static uint64_t diag_counts[DIAG_KINDS];
+
+static const char* diag_kind_names[DIAG_KINDS] = {
+    "unknown_element",
+    "unknown_attribute",
+    "duplicate_attribute",
+    "bad_value",
+    "cache",
+    "edit",
+    "charset",
+    "too_large",
+};
+
+//
+// Diag_SetSink
+// -----
+// Sends diagnostics to sink from now on, or nowhere if it's
+// NULL. Set this up before any parsing starts, the sink is
+// read without locking.
+//
+void Diag_SetSink(diag_sink_t sink, void* context)
+{
+    diag_sink = sink;
+    diag_context = context;
+}
+
+void Diag_Report(int kind, const char* source, const char* format, ...)
+{
+    __atomic_fetch_add(&diag_counts[kind], 1, __ATOMIC_RELAXED);
+
+    if (diag_sink == NULL)
+        return;
+
+    diag_t diag;
+    diag.kind = kind;
+    diag.source = source;
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(diag.message, sizeof(diag.message), format, args);
+    va_end(args);
+
+    diag_sink(diag_context, &diag);
+}
+
+//
+// Diag_Count
+// -----
+// How many diagnostics of a kind have been reported so
+// far, sink or no sink.
+//
+uint64_t Diag_Count(int kind)
+{
+    return __atomic_load_n(&diag_counts[kind], __ATOMIC_RELAXED);
+}
+
+const char* Diag_KindName(int kind)
+{
+    if (kind < 0 || kind >= DIAG_KINDS)
+        return "unknown";
+
+    return diag_kind_names[kind];
+}
+
+// The default sink, one line on stdout per diagnostic.
+void Diag_PrintSink(void* context, const diag_t* diag)
+{
+    printf("%s: %s\n", diag->source, diag->message);
+}
+
+void Diag_InitRing(diag_ring_t* ring, uint32_t capacity)
+{
+    ring->entries = calloc(capacity, sizeof(diag_t));
+    ring->capacity = capacity;
+    ring->written = 0;
+    pthread_mutex_init(&ring->lock, NULL);
+}
+
+// Sink that adds to the diag_ring_t given as its context.
+void Diag_RingSink(void* context, const diag_t* diag)
+{
+    diag_ring_t* ring = context;
+
+    pthread_mutex_lock(&ring->lock);
+    ring->entries[ring->written % ring->capacity] = *diag;
+    ring->written++;
+    pthread_mutex_unlock(&ring->lock);
+}
+
+//
+// Diag_ReadRing
+// -----
+// Copies the newest diagnostics in the ring to out, up to
+// max of them, oldest first. Returns how many it copied.
+//
+size_t Diag_ReadRing(diag_ring_t* ring, diag_t* out, size_t max)
+{
+    pthread_mutex_lock(&ring->lock);
+
+    uint64_t kept = ring->written < ring->capacity ? ring->written : ring->capacity;
+    if (max > kept)
+        max = kept;
+
+    uint64_t first = ring->written - max;
+    for (size_t i = 0; i < max; i++)
+        out[i] = ring->entries[(first + i) % ring->capacity];
+
+    pthread_mutex_unlock(&ring->lock);
+
+    return max;
+}
+
+void Diag_FreeRing(diag_ring_t* ring)
+{
+    free(ring->entries);
+    ring->entries = NULL;
+    pthread_mutex_destroy(&ring->lock);
+}
@@ -18,591 +18,708 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <ctype.h>
 
 #include <util.h>
+#include <diag.h>
+#include <intern.h>
 #include <html/html_parser.h>
 #include <html/html_datatype.h>
 #include <html/html_attributeparser.h>
+#include <html/html_entities.h>
 
-char* HTML_ParseTextAttribute(char* value)
+slice_t HTML_ParseTextAttribute(slice_t value)
 {
-    char* dest = malloc(sizeof(char)*(strlen(value) + 1));
-    strcpy(dest, value);
-    return dest;
+    // Text points straight into the document.
+    return value;
 }
 
-charsets_t HTML_ParseCharsetsAttribute(char* value) 
+//
+// HTML_LookupEnumValue
+// -----
+// Finds the entry for an enumerated attribute's value in
+// its table, ignoring case. The tables are tiny, so checking
+// the length and first character rules out nearly every
+// entry before any real comparison happens. Returns NULL
+// if the value isn't in the table.
+//
+static const html_enumvalue_t* HTML_LookupEnumValue(slice_t value, 
+                                        const html_enumvalue_t* table, size_t count)
+{
+    if (value.len == 0)
+        return NULL;
+
+    char first = value.ptr[0] | 0x20;
+
+    for (size_t i = 0; i < count; i++) {
+        if (table[i].len == value.len && table[i].name[0] == first &&
+            Util_FoldEquals(value.ptr, value.len, table[i].name, table[i].len))
+            return &table[i];
+    }
+
+    return NULL;
+}
+
+// The common labels for each charset we can decode.
+static const html_enumvalue_t html_charset_values[] = {
+    ENUM_VALUE("utf-8",             CS_UTF8),
+    ENUM_VALUE("utf8",              CS_UTF8),
+    ENUM_VALUE("unicode-1-1-utf-8", CS_UTF8),
+    ENUM_VALUE("iso-8859-1",        CS_ISO8859),
+    ENUM_VALUE("iso8859-1",         CS_ISO8859),
+    ENUM_VALUE("iso_8859-1",        CS_ISO8859),
+    ENUM_VALUE("latin1",            CS_ISO8859),
+    ENUM_VALUE("l1",                CS_ISO8859),
+    ENUM_VALUE("ascii",             CS_ASCII),
+    ENUM_VALUE("us-ascii",          CS_ASCII),
+    ENUM_VALUE("ansi",              CS_ANSI),
+    ENUM_VALUE("windows-1252",      CS_ANSI),
+    ENUM_VALUE("cp1252",            CS_ANSI),
+    ENUM_VALUE("x-cp1252",          CS_ANSI),
+};
+
+//
+// HTML_LookupCharset
+// -----
+// Returns the charset a label names, ignoring case and
+// surrounding whitespace, or CS_NONE if it isn't one we
+// know.
+//
+charsets_t HTML_LookupCharset(slice_t label)
 {
-    charsets_t charset;
-    int result = 0;
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(Util_SliceTrim(label), html_charset_values, 
+                                        ENUM_VALUE_COUNT(html_charset_values));
+
+    return entry != NULL ? entry->value : CS_NONE;
+}
 
-    GEN_FROM_VALUE(value, "utf-8", CS_UTF8, charset, result);
-    GEN_FROM_VALUE(value, "iso-8859-1", CS_ISO8859, charset, result);
-    GEN_FROM_VALUE(value, "ascii", CS_ASCII, charset, result);
-    GEN_FROM_VALUE(value, "ansi", CS_ANSI, charset, result);
+charsets_t HTML_ParseCharsetsAttribute(slice_t value)
+{
+    charsets_t charset = HTML_LookupCharset(value);
 
-    if (result == 0) {
-        printf("HTML_ParseCharsetsAttribute: Unknown charset %s, "
-        "defaulting to UTF-8\n", value);
-        charset = CS_UTF8;
+    if (charset == CS_NONE) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseCharsetsAttribute", "Unknown charset %.*s, "
+        "defaulting to UTF-8", SLICE_ARGS(value));
+        return CS_UTF8;
     }
 
     return charset;
 }
 
-contenttypes_t HTML_ParseContentTypesAttribute(char* value)
-{
-    contenttypes_t content_type;
-    int result = 0;
-
-    GEN_FROM_VALUE(value, "application/EDI-X12", 
-                    CTYPE_APP_EDIX12, content_type, result);
-    GEN_FROM_VALUE(value, "application/EDIFACT", 
-                    CTYPE_APP_EDIFACT, content_type, result);
-    GEN_FROM_VALUE(value, "application/javascript", 
-                    CTYPE_APP_JS, content_type, result);
-    GEN_FROM_VALUE(value, "application/octet-stream", 
-                    CTYPE_APP_OCTETSTREAM, content_type, result);
-    GEN_FROM_VALUE(value, "application/ogg", 
-                    CTYPE_APP_OGG, content_type, result);
-    GEN_FROM_VALUE(value, "application/pdf", 
-                    CTYPE_APP_PDF, content_type, result);
-    GEN_FROM_VALUE(value, "application/xhtml+xml", 
-                    CTYPE_APP_XHTMLXML, content_type, result);
-    GEN_FROM_VALUE(value, "application/x-shockwave-flash", 
-                    CTYPE_APP_XSHOCKWAVEFLASH, content_type, result);
-    GEN_FROM_VALUE(value, "application/json",
-                CTYPE_APP_JSON, content_type, result);
-    GEN_FROM_VALUE(value, "application/ld+json",
-                CTYPE_APP_LDJSON, content_type, result);
-    GEN_FROM_VALUE(value, "application/xml",
-                CTYPE_APP_XML, content_type, result);
-    GEN_FROM_VALUE(value, "application/zip",
-                CTYPE_APP_ZIP, content_type, result);
-    GEN_FROM_VALUE(value, "application/x-www-form-urlencoded",
-                CTYPE_APP_XWWWFORMURLENCODED, content_type, result);
-    GEN_FROM_VALUE(value, "audio/mpeg",
-                CTYPE_AUD_MPEG, content_type, result);
-    GEN_FROM_VALUE(value, "audio/x-ms-wma",
-                CTYPE_AUD_XMASWMA, content_type, result);
-    GEN_FROM_VALUE(value, "audio/vnd.rn-realaudio",
-                CTYPE_AUD_VNDRNREALAUDIO, content_type, result);
-    GEN_FROM_VALUE(value, "audio/x-wav",
-                CTYPE_AUD_XWAV, content_type, result);
-    GEN_FROM_VALUE(value, "image/gif",
-                CTYPE_IMG_GIF, content_type, result);
-    GEN_FROM_VALUE(value, "image/jpeg",
-                CTYPE_IMG_JPEG, content_type, result);
-    GEN_FROM_VALUE(value, "image/png",
-                CTYPE_IMG_PNG, content_type, result);
-    GEN_FROM_VALUE(value, "image/tiff",
-                CTYPE_IMG_TIFF, content_type, result);
-    GEN_FROM_VALUE(value, "image/vnd.microsoft.icon",
-                CTYPE_IMG_VNDMICROSOFTICON, content_type, result);
-    GEN_FROM_VALUE(value, "image/x-icon",
-                CTYPE_IMG_XICON, content_type, result);
-    GEN_FROM_VALUE(value, "image/vnd.djvu",
-                CTYPE_IMG_VNDDJVU, content_type, result);
-    GEN_FROM_VALUE(value, "image/svg+xml",
-                CTYPE_IMG_SVGXML, content_type, result);
-    GEN_FROM_VALUE(value, "multipart/mixed",
-                CTYPE_MPA_MIXED, content_type, result);
-    GEN_FROM_VALUE(value, "multipart/alternative",
-                CTYPE_MPA_ALTERNATIVE, content_type, result);
-    GEN_FROM_VALUE(value, "multipart/related",
-                CTYPE_MPA_RELATED, content_type, result);
-    GEN_FROM_VALUE(value, "multipart/form-data",
-                CTYPE_MPA_FORMDATA, content_type, result);
-    GEN_FROM_VALUE(value, "text/css",
-                CTYPE_TXT_CSS, content_type, result);
-    GEN_FROM_VALUE(value, "text/csv",
-                CTYPE_TXT_CSV, content_type, result);
-    GEN_FROM_VALUE(value, "text/html",
-                CTYPE_TXT_HTML, content_type, result);
-    GEN_FROM_VALUE(value, "text/javascript",
-                CTYPE_TXT_JS, content_type, result);
-    GEN_FROM_VALUE(value, "text/plain",
-                CTYPE_TXT_PLAIN, content_type, result);
-    GEN_FROM_VALUE(value, "text/xml",
-                CTYPE_TXT_XML, content_type, result);
-    GEN_FROM_VALUE(value, "video/mpeg",
-                CTYPE_VID_MPEG, content_type, result);
-    GEN_FROM_VALUE(value, "video/mp4",
-                CTYPE_VID_MP4, content_type, result);
-    GEN_FROM_VALUE(value, "video/quicktime",
-                CTYPE_VID_QUICKTIME, content_type, result);
-    GEN_FROM_VALUE(value, "video/x-ms-wmv",
-                CTYPE_VID_XMSWMV, content_type, result);
-    GEN_FROM_VALUE(value, "video/x-msvideo",
-                CTYPE_VID_XMSVIDEO, content_type, result);
-    GEN_FROM_VALUE(value, "video/x-flv",
-                CTYPE_VID_XFLV, content_type, result);
-    GEN_FROM_VALUE(value, "video/webm",
-                CTYPE_VID_WEBM, content_type, result);
-    GEN_FROM_VALUE(value, "application/vnd.oasis.opendocument.text",
-                CTYPE_APP_VNDOASISOPENDOCUMENTTEXT, content_type, result);
-    GEN_FROM_VALUE(value, "application/vnd.oasis.opendocument.spreadsheet",
-                CTYPE_APP_VNDOASISOPENDOCUMENTSPREADSHEET, content_type, result);
-    GEN_FROM_VALUE(value, "application/vnd.oasis.opendocument.presentation",
-                CTYPE_APP_VNDOASISOPENDOCUMENTPRESENTATION, content_type, result);
-    GEN_FROM_VALUE(value, "application/vnd.oasis.opendocument.graphics",
-                CTYPE_APP_VNDOASISOPENDOCUMENTGRAPHICS, content_type, result);
-    GEN_FROM_VALUE(value, "application/vnd.ms-excel",
-                CTYPE_APP_VNDMSEXCEL, content_type, result);
-    GEN_FROM_VALUE(value, "application/vnd.openxmlformats-officedocument.spreadsheetml.sheet",
-                CTYPE_APP_VNDOPENXMLFORMATSOFFICEDOCUMENTSPREADSHEET, content_type, result);
-    GEN_FROM_VALUE(value, "application/vnd.ms-powerpoint",
-                CTYPE_APP_VNDMSPOWERPOINT, content_type, result);
-    GEN_FROM_VALUE(value, "application/vnd.openxmlformats-",
-                CTYPE_APP_VNDOPENXMLFORMATS, content_type, result);
-    GEN_FROM_VALUE(value, "officedocument.presentationml.presentation",
-                CTYPE_APP_VNDOPENXMLFORMATSOFFICEDOCUMENTPRESENTATIONMLPRESENTATION, content_type, result);
-    GEN_FROM_VALUE(value, "application/msword",
-                CTYPE_APP_MSWORD, content_type, result);
-    GEN_FROM_VALUE(value, "officedocument.wordprocessingml.document",
-                CTYPE_APP_VNDOPENXMLFORMATSOFFICEDOCUMENTWORDPROCESSINGMLDOCUMENT, content_type, result);
-    GEN_FROM_VALUE(value, "application/vnd.mozilla.xul+xml",
-                CTYPE_APP_VNDMOZILLAXULXML, content_type, result);
-    
-    if (result == 0) {
-        printf("HTML_ParseContentTypesAttribute: Unknown content type %s, \
-        defaulting to text/plain\n", value);
-        content_type = CTYPE_TXT_PLAIN;
+//
+// Content types are resolved through a perfect hash table
+// generated from tools/keys/contenttypes.txt.
+//
+#include <html/html_contenttypes_hash.h>
+
+//
+// HTML_ParseContentTypesAttribute
+// -----
+// Parses a MIME type such as "text/html; charset=utf-8".
+// The type itself is looked up directly in the value, and
+// a charset parameter is picked up along the way. Lists
+// (as used by accept) only have their first type parsed.
+// A missing type, as in "; charset=utf-8", is quietly
+// taken as text/plain and its charset is still kept.
+//
+contenttype_t HTML_ParseContentTypesAttribute(slice_t value)
+{
+    contenttype_t content_type = {CTYPE_TXT_PLAIN, CS_NONE};
+
+    // The type runs up to its parameters or the next type.
+    size_t end = 0;
+    while (end < value.len && value.ptr[end] != ';' && value.ptr[end] != ',')
+        end++;
+
+    slice_t mime = Util_SliceTrim(Util_Slice(value.ptr, end));
+
+    uint32_t hash = Util_HashFold(mime.ptr, mime.len);
+    uint32_t displace = html_contenttypes_displace[hash & (HTML_CONTENTTYPES_BUCKETS - 1)];
+    const html_contenttype_t* entry = 
+        &html_contenttypes_table[Util_HashSlot(hash, displace, HTML_CONTENTTYPES_SLOTS - 1)];
+
+    if (entry->name != NULL && Util_FoldEquals(mime.ptr, mime.len, entry->name, entry->len)) {
+        content_type.type = entry->type;
+    } else if (mime.len > 0) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseContentTypesAttribute", "Unknown content type %.*s, "
+        "defaulting to text/plain", SLICE_ARGS(mime));
+    }
+
+    // Look through the parameters for a charset.
+    while (end < value.len && value.ptr[end] == ';') {
+        size_t start = end + 1;
+
+        end = start;
+        while (end < value.len && value.ptr[end] != ';' && value.ptr[end] != ',')
+            end++;
+
+        slice_t param = Util_SliceTrim(Util_Slice(&value.ptr[start], end - start));
+
+        if (param.len <= 8 || !Util_FoldEquals(param.ptr, 8, "charset=", 8))
+            continue;
+
+        slice_t charset = Util_SliceTrim(Util_Slice(&param.ptr[8], param.len - 8));
+
+        // Parameter values are allowed to be quoted.
+        if (charset.len >= 2 && (charset.ptr[0] == '\'' || charset.ptr[0] == '"') &&
+            charset.ptr[charset.len - 1] == charset.ptr[0]) {
+            charset.ptr++;
+            charset.len -= 2;
+        }
+
+        const html_enumvalue_t* known = HTML_LookupEnumValue(charset, html_charset_values, 
+                                                ENUM_VALUE_COUNT(html_charset_values));
+
+        if (known != NULL) {
+            content_type.charset = known->value;
+        } else {
+            Diag_Report(DIAG_BAD_VALUE, "HTML_ParseContentTypesAttribute", "Unknown charset %.*s "
+            "in content type", SLICE_ARGS(charset));
+        }
     }
 
     return content_type;
 }
 
-char HTML_ParseCharacterAttribute(char* value)
+char HTML_ParseCharacterAttribute(slice_t value)
 {
-    if (strlen(value) > 1) {
-        printf("HTML_ParseCharacterAttribute: character attribute %s "
-        "has length of %lu, only using first character.\n", value, strlen(value));
+    if (value.len > 1) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseCharacterAttribute", "character attribute %.*s "
+        "has length of %zu, only using first character.", SLICE_ARGS(value), value.len);
     }
 
-    return value[0];
+    return value.len > 0 ? value.ptr[0] : '\0';
 }
 
-align_t HTML_ParseAlignAttribute(char* value)
+static const html_enumvalue_t html_align_values[] = {
+    ENUM_VALUE("top",      ALIGN_TOP),
+    ENUM_VALUE("left",     ALIGN_LEFT),
+    ENUM_VALUE("center",   ALIGN_CENTER),
+    ENUM_VALUE("right",    ALIGN_RIGHT),
+    ENUM_VALUE("bottom",   ALIGN_BOTTOM),
+    ENUM_VALUE("middle",   ALIGN_MIDDLE),
+    ENUM_VALUE("justify",  ALIGN_JUSTIFY),
+    ENUM_VALUE("char",     ALIGN_CHAR),
+};
+
+align_t HTML_ParseAlignAttribute(slice_t value)
 {
-    align_t align;
-    int result = 0;
-
-    GEN_FROM_VALUE(value, "top", ALIGN_TOP, align, result);
-    GEN_FROM_VALUE(value, "left", ALIGN_LEFT, align, result);
-    GEN_FROM_VALUE(value, "center", ALIGN_CENTER, align, result);
-    GEN_FROM_VALUE(value, "right", ALIGN_RIGHT, align, result);
-    GEN_FROM_VALUE(value, "bottom", ALIGN_BOTTOM, align, result);
-    GEN_FROM_VALUE(value, "middle", ALIGN_MIDDLE, align, result);
-    GEN_FROM_VALUE(value, "justify", ALIGN_JUSTIFY, align, result);
-    GEN_FROM_VALUE(value, "char", ALIGN_CHAR, align, result);
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_align_values, 
+                                        ENUM_VALUE_COUNT(html_align_values));
 
-    if (result == 0) {
-        printf("HTML_ParseAlignAttribute: Unknown alignment %s,"
-        " ignoring.", value);
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseAlignAttribute", "Unknown alignment %.*s,"
+        " ignoring.", SLICE_ARGS(value));
+        return ALIGN_NONE;
     }
 
-    return align;
+    return entry->value;
 }
 
-color_t HTML_ParseColorAttribute(char* value)
-{
-    color_t color;
+//
+// Named colors are resolved through a perfect hash table
+// generated from tools/keys/colors.txt.
+//
+#include <html/html_colors_hash.h>
 
-    // Colors are an annoyingly involved process.
-    // There are basically 3 different possibilities
-    // for assigning color values.
-    // 1. "rgb(255, 255, 255)", can also be rgba (we
-    //    will parse this but won't support alpha).
-    // 2. "#FFFFFF" / hex colors
-    // 3. pre-defined color-word such as "red", "silver",
-    //    "fuchsia".. there are 16 total in HTML 4.01, and
-    //    more were added later that we will support
-    //    due to the simplicity of appending the list.
-    // ----
-    // Also note that every browser basically has broken
-    // rgb() with bgcolor with no documentation as to how.
-    // Forget that, we will just give it the same love as
-    // everything else.
+// One more than the value of each hex digit, so anything
+// that isn't one is left as zero.
+static const byte html_hex_digits[256] = {
+    ['0'] = 1,  ['1'] = 2,  ['2'] = 3,  ['3'] = 4,  ['4'] = 5,
+    ['5'] = 6,  ['6'] = 7,  ['7'] = 8,  ['8'] = 9,  ['9'] = 10,
+    ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+    ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+};
 
-    //
-    // RGB(A)
-    //
-    if (value[0] == 'r' && value[1] == 'g' && value[2] == 'b') {
-        byte colors[3]; // Stores the RGB color values
-        byte col_index; // Keeps track of if we're filling R, G, or B
-        for (int i = 3; i < strlen(value); i++) {
-            // Ignore alpha (or anything else after)
-            if (col_index > 2)
-                continue;
-            // This is off spec, but basically if it's not
-            // a number, we don't care about it.
-            if (value[i] >= '0' && value[i] <= '9') {
-                colors[col_index] = colors[col_index] * 10 + (value[i] - '0');
-            } else if (value[i] == ',') {
-                col_index++; // Move to the next color component
-            }
-        }
+//
+// HTML_ParseHexColor
+// -----
+// Parses the digits of a hex color, in either the short
+// ("fff") or long ("ffffff") form, with or without an
+// alpha digit pair that is ignored. Every digit is looked
+// up before any of them are checked, so a bad one just
+// fails the whole thing.
+//
+static bool HTML_ParseHexColor(slice_t digits, color_t* color)
+{
+    byte values[8] = {0};
+    byte bad = 0;
+    size_t count = digits.len < 8 ? digits.len : 8;
+
+    for (size_t i = 0; i < count; i++) {
+        values[i] = html_hex_digits[(byte)digits.ptr[i]];
+        bad |= (values[i] == 0);
+        values[i] -= 1;
+    }
 
-        // Fill the attribute struct with the values
-        color.r = colors[0];
-        color.g = colors[1];
-        color.b = colors[2];
-    }
-    //
-    // Hex Colors
-    //
-    else if (value[0] == '#') {
-        byte colors[3]; // Stores the RGB color values
-        for (int i = 1; i < strlen(value); i += 2) {
-            char hex[3] = {value[i], value[i + 1], '\0'};
-            int decimal = strtol(hex, NULL, 16); // Convert hex to decimal
-            colors[(i - 1) / 2] = (byte)decimal;
-        }
+    if (bad)
+        return false;
+
+    switch(digits.len) {
+        case 3:
+        case 4:
+            color->r = values[0] * 17;
+            color->g = values[1] * 17;
+            color->b = values[2] * 17;
+            return true;
+        case 6:
+        case 8:
+            color->r = (values[0] << 4) | values[1];
+            color->g = (values[2] << 4) | values[3];
+            color->b = (values[4] << 4) | values[5];
+            return true;
+        default:
+            return false;
+    }
+}
 
-        // Fill the attribute struct with the values
-        color.r = colors[0];
-        color.g = colors[1];
-        color.b = colors[2];
-    }
-    //
-    // Color names
-    //
-    else {
-        int result = 0;
-
-        //
-        // Standard HTML 4.01 colors
-        // https://en.wikipedia.org/wiki/Web_colors#Basic_colors
-        //
-        COLOR_FROM_NAME(value, "white", 255, 255, 255, color, result);
-        COLOR_FROM_NAME(value, "silver", 191, 191, 191, color, result);
-        COLOR_FROM_NAME(value, "gray", 128, 128, 128, color, result);
-        COLOR_FROM_NAME(value, "black", 0, 0, 0, color, result);
-        COLOR_FROM_NAME(value, "red", 255, 0, 0, color, result);
-        COLOR_FROM_NAME(value, "maroon", 128, 0, 0, color, result);
-        COLOR_FROM_NAME(value, "yellow", 255, 255, 0, color, result);
-        COLOR_FROM_NAME(value, "olive", 128, 128, 0, color, result);
-        COLOR_FROM_NAME(value, "lime", 0, 255, 0, color, result);
-        COLOR_FROM_NAME(value, "green", 0, 128, 0, color, result);
-        COLOR_FROM_NAME(value, "aqua", 0, 255, 255, color, result);
-        COLOR_FROM_NAME(value, "teal", 0, 128, 128, color, result);
-        COLOR_FROM_NAME(value, "blue", 0, 0, 255, color, result);
-        COLOR_FROM_NAME(value, "navy", 0, 0, 128, color, result);
-        COLOR_FROM_NAME(value, "fuschia", 255, 0, 255, color, result);
-        COLOR_FROM_NAME(value, "purple", 128, 0, 128, color, result);
-        //
-        // Extended HTML colors
-        // https://en.wikipedia.org/wiki/Web_colors#Extended_colors
-        //
-        // Pink colors
-        COLOR_FROM_NAME(value, "mediumvioletred", 199, 21, 133, color, result);
-        COLOR_FROM_NAME(value, "deeppink", 255, 20, 147, color, result);
-        COLOR_FROM_NAME(value, "palevioletred", 219, 112, 147, color, result);
-        COLOR_FROM_NAME(value, "hotpink", 255, 105, 180, color, result);
-        COLOR_FROM_NAME(value, "lightpink", 255, 182, 193, color, result);
-        COLOR_FROM_NAME(value, "pink", 255, 192, 203, color, result);
-        // Red colors
-        COLOR_FROM_NAME(value, "darkred", 139, 0, 0, color, result);
-        COLOR_FROM_NAME(value, "firebrick", 178, 34, 34, color, result);
-        COLOR_FROM_NAME(value, "crimson", 220, 20, 60, color, result);
-        COLOR_FROM_NAME(value, "indianred", 205, 92, 92, color, result);
-        COLOR_FROM_NAME(value, "lightcoral", 240, 128, 128, color, result);
-        COLOR_FROM_NAME(value, "salmon", 250, 128, 114, color, result);
-        COLOR_FROM_NAME(value, "darksalmon", 233, 150, 122, color, result);
-        COLOR_FROM_NAME(value, "lightsalmon", 255, 160, 122, color, result);
-        // Orange colors
-        COLOR_FROM_NAME(value, "orangered", 255, 69, 0, color, result);
-        COLOR_FROM_NAME(value, "tomato", 255, 99, 71, color, result);
-        COLOR_FROM_NAME(value, "darkorange", 255, 140, 0, color, result);
-        COLOR_FROM_NAME(value, "coral", 255, 127, 80, color, result);
-        COLOR_FROM_NAME(value, "orange", 255, 165, 0, color, result);
-        // Yellow colors
-        COLOR_FROM_NAME(value, "darkkhaki", 189, 183, 107, color, result);
-        COLOR_FROM_NAME(value, "gold", 255, 215, 0, color, result);
-        COLOR_FROM_NAME(value, "khaki", 240, 230, 140, color, result);
-        COLOR_FROM_NAME(value, "peachpuff", 255, 218, 185, color, result);
-        COLOR_FROM_NAME(value, "palegoldenrod", 238, 232, 170, color, result);
-        COLOR_FROM_NAME(value, "moccasin", 255, 228, 181, color, result);
-        COLOR_FROM_NAME(value, "papayawhip", 255, 239, 213, color, result);
-        COLOR_FROM_NAME(value, "lightgoldenrodyellow", 250, 250, 210, color, result);
-        COLOR_FROM_NAME(value, "lemonchiffon", 255, 250, 205, color, result);
-        COLOR_FROM_NAME(value, "lightyellow", 255, 255, 224, color, result);
-        // Brown colors
-        COLOR_FROM_NAME(value, "brown", 165, 42, 42, color, result);
-        COLOR_FROM_NAME(value, "saddlebrown", 139, 69, 19, color, result);
-        COLOR_FROM_NAME(value, "sienna", 160, 82, 45, color, result);
-        COLOR_FROM_NAME(value, "chocolate", 210, 105, 30, color, result);
-        COLOR_FROM_NAME(value, "darkgoldenrod", 184, 134, 11, color, result);
-        COLOR_FROM_NAME(value, "peru", 205, 133, 63, color, result);
-        COLOR_FROM_NAME(value, "rosybrown", 188, 143, 143, color, result);
-        COLOR_FROM_NAME(value, "goldenrod", 218, 165, 32, color, result);
-        COLOR_FROM_NAME(value, "sandybrown", 244, 164, 96, color, result);
-        COLOR_FROM_NAME(value, "tan", 210, 180, 140, color, result);
-        COLOR_FROM_NAME(value, "burlywood", 222, 184, 135, color, result);
-        COLOR_FROM_NAME(value, "wheat", 245, 222, 179, color, result);
-        COLOR_FROM_NAME(value, "navajowhite", 255, 222, 173, color, result);
-        COLOR_FROM_NAME(value, "bisque", 255, 228, 196, color, result);
-        COLOR_FROM_NAME(value, "blanchedalmond", 255, 235, 205, color, result);
-        COLOR_FROM_NAME(value, "cornsilk", 255, 248, 220, color, result);
-        // Purple, violet, and magenta colors
-        COLOR_FROM_NAME(value, "indigo", 75, 0, 130, color, result);
-        COLOR_FROM_NAME(value, "darkmagenta", 139, 0, 139, color, result);
-        COLOR_FROM_NAME(value, "darkviolet", 148, 0, 211, color, result);
-        COLOR_FROM_NAME(value, "darkslateblue", 72, 61, 139, color, result);
-        COLOR_FROM_NAME(value, "blueviolet", 138, 43, 226, color, result);
-        COLOR_FROM_NAME(value, "darkorchid", 153, 50, 204, color, result);
-        COLOR_FROM_NAME(value, "magenta", 255, 0, 255, color, result);
-        COLOR_FROM_NAME(value, "slateblue", 106, 90, 205, color, result);
-        COLOR_FROM_NAME(value, "mediumslateblue", 123, 104, 238, color, result);
-        COLOR_FROM_NAME(value, "mediumorchid", 186, 85, 211, color, result);
-        COLOR_FROM_NAME(value, "mediumpurple", 147, 112, 219, color, result);
-        COLOR_FROM_NAME(value, "orchid", 218, 112, 214, color, result);
-        COLOR_FROM_NAME(value, "violet", 238, 130, 238, color, result);
-        COLOR_FROM_NAME(value, "plum", 221, 160, 221, color, result);
-        COLOR_FROM_NAME(value, "thistle", 216, 191, 216, color, result);
-        COLOR_FROM_NAME(value, "lavender", 230, 230, 250, color, result);
-        // Blue colors
-        COLOR_FROM_NAME(value, "midnightblue", 25, 25, 112, color, result);
-        COLOR_FROM_NAME(value, "darkblue", 0, 0, 139, color, result);
-        COLOR_FROM_NAME(value, "mediumblue", 0, 0, 205, color, result);
-        COLOR_FROM_NAME(value, "royalblue", 65, 105, 225, color, result);
-        COLOR_FROM_NAME(value, "steelblue", 70, 130, 180, color, result);
-        COLOR_FROM_NAME(value, "dodgerblue", 30, 144, 255, color, result);
-        COLOR_FROM_NAME(value, "deepskyblue", 0, 191, 255, color, result);
-        COLOR_FROM_NAME(value, "cornflowerblue", 100, 149, 237, color, result);
-        COLOR_FROM_NAME(value, "skyblue", 135, 206, 235, color, result);
-        COLOR_FROM_NAME(value, "lightskyblue", 135, 206, 250, color, result);
-        COLOR_FROM_NAME(value, "lightsteelblue", 176, 196, 222, color, result);
-        COLOR_FROM_NAME(value, "lightblue", 173, 216, 230, color, result);
-        COLOR_FROM_NAME(value, "powderblue", 176, 224, 230, color, result);
-        // Cyan colors
-        COLOR_FROM_NAME(value, "darkcyan", 0, 139, 139, color, result);
-        COLOR_FROM_NAME(value, "lightseagreen", 32, 178, 170, color, result);
-        COLOR_FROM_NAME(value, "cadetblue", 95, 158, 160, color, result);
-        COLOR_FROM_NAME(value, "darkturquoise", 0, 206, 209, color, result);
-        COLOR_FROM_NAME(value, "mediumturquoise", 72, 209, 204, color, result);
-        COLOR_FROM_NAME(value, "turquoise", 64, 224, 208, color, result);
-        COLOR_FROM_NAME(value, "cyan", 0, 255, 255, color, result);
-        COLOR_FROM_NAME(value, "aquamarine", 127, 255, 212, color, result);
-        COLOR_FROM_NAME(value, "paleturquoise", 175, 238, 238, color, result);
-        COLOR_FROM_NAME(value, "lightcyan", 224, 255, 255, color, result);
-        // Green colors
-        COLOR_FROM_NAME(value, "darkgreen", 0, 100, 0, color, result);
-        COLOR_FROM_NAME(value, "darkolivegreen", 85, 107, 47, color, result);
-        COLOR_FROM_NAME(value, "forestgreen", 34, 139, 34, color, result);
-        COLOR_FROM_NAME(value, "seagreen", 46, 139, 87, color, result);
-        COLOR_FROM_NAME(value, "olivedrab", 107, 142, 35, color, result);
-        COLOR_FROM_NAME(value, "mediumseagreen", 60, 179, 113, color, result);
-        COLOR_FROM_NAME(value, "limegreen", 50, 205, 50, color, result);
-        COLOR_FROM_NAME(value, "springgreen", 0, 255, 127, color, result);
-        COLOR_FROM_NAME(value, "mediumspringgreen", 0, 250, 154, color, result);
-        COLOR_FROM_NAME(value, "darkseagreen", 143, 188, 143, color, result);
-        COLOR_FROM_NAME(value, "mediumaquamarine", 102, 205, 170, color, result);
-        COLOR_FROM_NAME(value, "yellowgreen", 154, 205, 50, color, result);
-        COLOR_FROM_NAME(value, "lawngreen", 124, 252, 0, color, result);
-        COLOR_FROM_NAME(value, "chartreuse", 127, 255, 0, color, result);
-        COLOR_FROM_NAME(value, "lightgreen", 144, 238, 144, color, result);
-        COLOR_FROM_NAME(value, "greenyellow", 173, 255, 47, color, result);
-        COLOR_FROM_NAME(value, "palegreen", 152, 251, 152, color, result);
-        // White colors
-        COLOR_FROM_NAME(value, "mistyrose", 255, 228, 225, color, result);
-        COLOR_FROM_NAME(value, "antiquewhite", 250, 235, 215, color, result);
-        COLOR_FROM_NAME(value, "linen", 250, 240, 230, color, result);
-        COLOR_FROM_NAME(value, "beige", 245, 245, 220, color, result);
-        COLOR_FROM_NAME(value, "whitesmoke", 245, 245, 245, color, result);
-        COLOR_FROM_NAME(value, "lavenderblush", 255, 240, 245, color, result);
-        COLOR_FROM_NAME(value, "oldlace", 253, 245, 230, color, result);
-        COLOR_FROM_NAME(value, "aliceblue", 240, 248, 255, color, result);
-        COLOR_FROM_NAME(value, "seashell", 255, 245, 238, color, result);
-        COLOR_FROM_NAME(value, "ghostwhite", 248, 248, 255, color, result);
-        COLOR_FROM_NAME(value, "honeydew", 240, 255, 240, color, result);
-        COLOR_FROM_NAME(value, "floralwhite", 255, 250, 240, color, result);
-        COLOR_FROM_NAME(value, "azure", 240, 255, 255, color, result);
-        COLOR_FROM_NAME(value, "mintcream", 245, 255, 250, color, result);
-        COLOR_FROM_NAME(value, "snow", 255, 250, 250, color, result);
-        COLOR_FROM_NAME(value, "ivory", 255, 255, 240, color, result);
-        // Gray and black colors
-        COLOR_FROM_NAME(value, "darkslategray", 47, 79, 79, color, result);
-        COLOR_FROM_NAME(value, "dimgray", 105, 105, 105, color, result);
-        COLOR_FROM_NAME(value, "slategray", 112, 128, 144, color, result);
-        COLOR_FROM_NAME(value, "lightslategray", 119, 136, 153, color, result);
-        COLOR_FROM_NAME(value, "darkgray", 169, 169, 169, color, result);
-        COLOR_FROM_NAME(value, "lightgray", 211, 211, 211, color, result);
-        COLOR_FROM_NAME(value, "gainsboro", 220, 220, 220, color, result);
-        
-        if (result == 0) {
-            printf("HTML_ParseColorAttribute: Unknown color %s\n", value);
+//
+// HTML_ParseColorComponent
+// -----
+// Reads the next number out of the arguments of an rgb()
+// or hsl() color, skipping the comma, slash, or whitespace
+// separating it from the last one. Any unit after it is
+// skipped too, but a percent sign is reported. Returns
+// false when there isn't a number to be read.
+//
+static bool HTML_ParseColorComponent(slice_t args, size_t* offset, double* number, bool* percent)
+{
+    size_t i = *offset;
+
+    while (i < args.len && isspace((byte)args.ptr[i]))
+        i++;
+    if (i < args.len && (args.ptr[i] == ',' || args.ptr[i] == '/'))
+        i++;
+    while (i < args.len && isspace((byte)args.ptr[i]))
+        i++;
+
+    bool negative = false;
+    if (i < args.len && (args.ptr[i] == '-' || args.ptr[i] == '+'))
+        negative = (args.ptr[i++] == '-');
+
+    double value = 0;
+    size_t digits = 0;
+    while (i < args.len && args.ptr[i] >= '0' && args.ptr[i] <= '9') {
+        value = value * 10 + (args.ptr[i++] - '0');
+        digits++;
+    }
+
+    if (i < args.len && args.ptr[i] == '.') {
+        double scale = 0.1;
+        for (i++; i < args.len && args.ptr[i] >= '0' && args.ptr[i] <= '9'; i++) {
+            value += (args.ptr[i] - '0') * scale;
+            scale *= 0.1;
+            digits++;
         }
     }
 
-    return color;
+    if (digits == 0)
+        return false;
+
+    *percent = (i < args.len && args.ptr[i] == '%');
+    while (i < args.len && (args.ptr[i] == '%' || isalpha((byte)args.ptr[i])))
+        i++;
+
+    *number = negative ? -value : value;
+    *offset = i;
+    return true;
 }
 
-pixels_t HTML_ParsePixelsAttribute(char* value)
+// Clamps and rounds a color channel.
+static byte HTML_ColorChannel(double value)
 {
-    pixels_t pixels = atoi(value);
-    return pixels;
+    if (value <= 0)
+        return 0;
+    if (value >= 255)
+        return 255;
+    return (byte)(value + 0.5);
 }
 
-length_t HTML_ParseLengthAttribute(char* value)
+// Used by HTML_ParseColorAttribute for hsl(), hue is in
+// turns.
+static double HTML_HueToChannel(double low, double high, double hue)
 {
-    length_t length;
+    if (hue < 0)
+        hue += 1;
+    if (hue > 1)
+        hue -= 1;
+
+    if (hue * 6 < 1)
+        return low + (high - low) * hue * 6;
+    if (hue * 2 < 1)
+        return high;
+    if (hue * 3 < 2)
+        return low + (high - low) * (2.0 / 3.0 - hue) * 6;
+    return low;
+}
 
-    // First, get the actual number specified in the length.
-    int len;
-    for (int i = 0; i < strlen(value); i++) {
-        // If it's not a number, we don't care about it.
-        if (value[i] >= '0' && value[i] <= '9') {
-            len = len * 10 + (value[i] - '0');
-        }
+//
+// HTML_ParseColorFunction
+// -----
+// Parses rgb(), rgba(), hsl(), and hsla() colors. Numbers
+// and percentages are both accepted for every channel,
+// and out of range values are clamped. Alpha is read past
+// but not kept, and anything else left over fails it.
+//
+static bool HTML_ParseColorFunction(slice_t value, color_t* color)
+{
+    size_t open = 0;
+    while (open < value.len && value.ptr[open] != '(')
+        open++;
+
+    if (open == value.len || value.ptr[value.len - 1] != ')')
+        return false;
+
+    slice_t name = Util_SliceTrim(Util_Slice(value.ptr, open));
+    slice_t args = Util_Slice(value.ptr + open + 1, value.len - open - 2);
+
+    bool hsl;
+    if (Util_FoldEquals(name.ptr, name.len, "rgb", 3) || 
+        Util_FoldEquals(name.ptr, name.len, "rgba", 4))
+        hsl = false;
+    else if (Util_FoldEquals(name.ptr, name.len, "hsl", 3) || 
+        Util_FoldEquals(name.ptr, name.len, "hsla", 4))
+        hsl = true;
+    else
+        return false;
+
+    double channels[3];
+    bool percent[3];
+    size_t offset = 0;
+
+    for (int i = 0; i < 3; i++) {
+        if (!HTML_ParseColorComponent(args, &offset, &channels[i], &percent[i]))
+            return false;
     }
-    length.len = len;
-    
-    // Now parse the suffix to determine whether its absolute
-    // or relative.
-    // Why can't these all have a static measurement length.. :(
-    char last_char = value[strlen(value) - 1];
-    char last2_char = value[strlen(value) - 2];
-    char last3_char = value[strlen(value) - 3];
-    char last4_char = value[strlen(value) - 4];
-
-    // Relative Measurements
-    if (last_char == '%') {
-        length.type = LEN_PERCENT;
-    } else if (last2_char == 'e') {
-        if (last_char == 'm') {
-            if (last3_char == 'r') {
-                length.type = LEN_REM;
-            } else {
-                length.type = LEN_EM;
-            }
-        }
-     
-        if (last_char == 'x') {
-            length.type = LEN_EX;
-        }
-    } else if (last2_char == 'c' && last_char == 'h') {
-        length.type = LEN_CH;
-    } else if (last2_char == 'v') {
-        if (last_char == 'w') {
-            length.type = LEN_VW;
-        } else if (last_char == 'h') {
-            length.type = LEN_VH;
+
+    double alpha;
+    bool alpha_percent;
+    HTML_ParseColorComponent(args, &offset, &alpha, &alpha_percent);
+
+    while (offset < args.len && isspace((byte)args.ptr[offset]))
+        offset++;
+    if (offset != args.len)
+        return false;
+
+    if (!hsl) {
+        for (int i = 0; i < 3; i++) {
+            if (percent[i])
+                channels[i] = channels[i] * 255 / 100;
         }
-    } else if (last4_char == 'v' && last3_char == 'm') {
-        if (last2_char == 'i' && last_char == 'n') {
-            length.type = LEN_VMIN;
-        } else if (last2_char == 'a' && last_char == 'x') {
-            length.type = LEN_VMAX;
+
+        color->r = HTML_ColorChannel(channels[0]);
+        color->g = HTML_ColorChannel(channels[1]);
+        color->b = HTML_ColorChannel(channels[2]);
+        return true;
+    }
+
+    // Wrap the hue into a single turn. Absurd hues are
+    // dropped first so the truncation stays defined.
+    double hue = channels[0] / 360;
+    if (!(hue > -1e9 && hue < 1e9))
+        hue = 0;
+    hue -= (long)hue;
+    if (hue < 0)
+        hue += 1;
+
+    double saturation = channels[1] / 100;
+    double lightness = channels[2] / 100;
+    saturation = saturation < 0 ? 0 : saturation > 1 ? 1 : saturation;
+    lightness = lightness < 0 ? 0 : lightness > 1 ? 1 : lightness;
+
+    double high = lightness <= 0.5 ? lightness * (saturation + 1) : 
+                    lightness + saturation - lightness * saturation;
+    double low = lightness * 2 - high;
+
+    color->r = HTML_ColorChannel(HTML_HueToChannel(low, high, hue + 1.0 / 3.0) * 255);
+    color->g = HTML_ColorChannel(HTML_HueToChannel(low, high, hue) * 255);
+    color->b = HTML_ColorChannel(HTML_HueToChannel(low, high, hue - 1.0 / 3.0) * 255);
+    return true;
+}
+
+//
+// HTML_ParseColorAttribute
+// -----
+// Colors come in three forms: hex ("#FFFFFF" or "#FFF"),
+// functional (rgb(), rgba(), hsl(), hsla()), and any of
+// the 148 CSS named colors. Plenty of old pages also leave
+// the '#' off of hex colors, so those are tried last.
+// Anything else gives back a color that isn't marked used.
+//
+color_t HTML_ParseColorAttribute(slice_t value)
+{
+    color_t color = {0, 0, 0, true};
+
+    value = Util_SliceTrim(value);
+
+    if (value.len > 0 && value.ptr[0] == '#') {
+        if (HTML_ParseHexColor(Util_Slice(value.ptr + 1, value.len - 1), &color))
+            return color;
+    } else if (value.len > 0 && value.ptr[value.len - 1] == ')') {
+        if (HTML_ParseColorFunction(value, &color))
+            return color;
+    } else {
+        uint32_t hash = Util_HashFold(value.ptr, value.len);
+        uint32_t displace = html_colors_displace[hash & (HTML_COLORS_BUCKETS - 1)];
+        const html_namedcolor_t* entry = 
+            &html_colors_table[Util_HashSlot(hash, displace, HTML_COLORS_SLOTS - 1)];
+
+        if (entry->name != NULL && Util_FoldEquals(value.ptr, value.len, entry->name, entry->len)) {
+            color.r = entry->r;
+            color.g = entry->g;
+            color.b = entry->b;
+            return color;
         }
+
+        if ((value.len == 3 || value.len == 6) && HTML_ParseHexColor(value, &color))
+            return color;
     }
-    // Absolute measurements
-    // We only store these in pixels, despite there being
-    // a lot of different absolute measurements. The reason
-    // being, they all have documented conversion factors:
-    // (https://www.w3schools.com/cssref/css_units.php)
-    // -----
-    // cm   centimeters
-    // mm   millimeters
-    // in   inches (1in = 96px = 2.54cm)
-    // px   pixels (1px = 1/96th of 1in)
-    // pt   points (1pt = 1/72 of 1in)
-    // pc   picas (1pc = 12 pt) 
-    // -----
-    // We only use integer precision here though. So there
-    // is going to be some inaccuracy. Hopefully it'll never
-    // be too bad!
-
-    // Centimeter
-    else if (last2_char == 'c' && last_char == 'm') {
-        // 1 in = 2.54 cm
-        // 1 pixel = 1/96 in
-        // pixel = (2.54 * (1/96))
-        length.len *= (int)(2.54 * (float)(1/96));
-        length.type = LEN_PIXEL;
+
+    Diag_Report(DIAG_BAD_VALUE, "HTML_ParseColorAttribute", "Unknown color %.*s",
+                SLICE_ARGS(value));
+
+    color_t unknown = {0, 0, 0, false};
+    return unknown;
+}
+
+pixels_t HTML_ParsePixelsAttribute(slice_t value)
+{
+    pixels_t pixels = Util_SliceToInt(value);
+    return pixels;
+}
+
+//
+// Units a length can have. Absolute ones are turned into
+// pixels right away (1in = 2.54cm = 96px = 72pt = 6pc), by
+// multiplying with scale and dividing by divide.
+//
+typedef struct {
+    const char*             name;       // Lowercase.
+    byte                    len;
+    byte                    type;       // LEN_*
+    int32_t                 scale;
+    int32_t                 divide;
+} html_lengthunit_t;
+
+#define LENGTH_UNIT(name, type, scale, divide)  { name, sizeof(name) - 1, type, scale, divide }
+
+// Biggest whole part kept while reading a length, well past
+// anything a fixed point length_t can hold.
+#define LENGTH_WHOLE_MAX    (1 << 24)
+
+static const html_lengthunit_t html_length_units[] = {
+    LENGTH_UNIT("px",   LEN_PIXEL,      1,      1),
+    LENGTH_UNIT("%",    LEN_PERCENT,    1,      1),
+    LENGTH_UNIT("*",    LEN_RELATIVE,   1,      1),
+    LENGTH_UNIT("em",   LEN_EM,         1,      1),
+    LENGTH_UNIT("rem",  LEN_REM,        1,      1),
+    LENGTH_UNIT("ex",   LEN_EX,         1,      1),
+    LENGTH_UNIT("ch",   LEN_CH,         1,      1),
+    LENGTH_UNIT("vw",   LEN_VW,         1,      1),
+    LENGTH_UNIT("vh",   LEN_VH,         1,      1),
+    LENGTH_UNIT("vmin", LEN_VMIN,       1,      1),
+    LENGTH_UNIT("vmax", LEN_VMAX,       1,      1),
+    LENGTH_UNIT("in",   LEN_PIXEL,      96,     1),
+    LENGTH_UNIT("cm",   LEN_PIXEL,      9600,   254),
+    LENGTH_UNIT("mm",   LEN_PIXEL,      960,    254),
+    LENGTH_UNIT("q",    LEN_PIXEL,      240,    254),
+    LENGTH_UNIT("pt",   LEN_PIXEL,      4,      3),
+    LENGTH_UNIT("pc",   LEN_PIXEL,      16,     1),
+};
+
+static const html_lengthunit_t* HTML_LookupLengthUnit(const char* name, size_t len)
+{
+    // No unit at all means pixels.
+    if (len == 0)
+        return &html_length_units[0];
+
+    for (size_t i = 0; i < sizeof(html_length_units) / sizeof(html_length_units[0]); i++) {
+        const html_lengthunit_t* unit = &html_length_units[i];
+
+        if (Util_FoldEquals(name, len, unit->name, unit->len))
+            return unit;
     }
-    // Millimeter
-    else if (last2_char == 'm' && last_char == 'm') {
-        // 1cm = 10mm
-        // pixel = (2.54 * 10 * (1/96))
-        length.len *= (int)(2.54 * 10 * (float)(1/96));
-        length.type = LEN_PIXEL;
+
+    return NULL;
+}
+
+//
+// HTML_ParseLength
+// -----
+// Reads one length starting at *pos in a single pass: an
+// optional sign, digits with an optional fraction, then
+// the unit. Surrounding whitespace is skipped. Returns
+// false if there isn't a length there, otherwise leaves
+// *pos just past it.
+//
+static bool HTML_ParseLength(slice_t value, size_t* pos, length_t* length)
+{
+    const char* data = value.ptr;
+    size_t i = *pos;
+
+    while (i < value.len && isspace((byte)data[i]))
+        i++;
+
+    bool negative = false;
+    if (i < value.len && (data[i] == '-' || data[i] == '+')) {
+        negative = data[i] == '-';
+        i++;
     }
-    // Inch
-    else if (last2_char == 'i' && last_char == 'n') {
-        // pixel = (1/96) in
-        length.len = (int)((float)(length.len) * (float)(1/96));
-        length.type = LEN_PIXEL;
+
+    // Digits past the fourth after the point are too small
+    // for the fixed point to notice, and anything too big
+    // for it is cut down to size at the end anyway.
+    int64_t whole = 0;
+    int64_t fraction = 0;
+    int64_t divide = 1;
+    bool digits = false;
+
+    for (; i < value.len && data[i] >= '0' && data[i] <= '9'; i++) {
+        if (whole < LENGTH_WHOLE_MAX)
+            whole = whole * 10 + (data[i] - '0');
+        digits = true;
     }
-    // Pixel (do nothing)
-    else if (last2_char == 'p' && last_char == 'x') {
-        length.type = LEN_PIXEL;
+
+    if (i < value.len && data[i] == '.') {
+        for (i++; i < value.len && data[i] >= '0' && data[i] <= '9'; i++) {
+            if (divide < 10000) {
+                fraction = fraction * 10 + (data[i] - '0');
+                divide *= 10;
+            }
+            digits = true;
+        }
     }
-    // Point
-    else if (last2_char == 'p' && last_char == 't') {
-        // 1 pt = 1.33 px 
-        // (i cheated: https://weboverhauls.github.io/conversion-table/)
-        length.len = (int)((float)length.len * 1.33);
+
+    size_t unit_start = i;
+    while (i < value.len && (isalpha((byte)data[i]) || data[i] == '%' || data[i] == '*'))
+        i++;
+
+    const html_lengthunit_t* unit = HTML_LookupLengthUnit(&data[unit_start], i - unit_start);
+
+    // A "*" on its own is "1*", anything else needs a number.
+    if (unit == NULL || (!digits && unit->type != LEN_RELATIVE))
+        return false;
+
+    if (!digits)
+        whole = 1;
+
+    // Converting the unit before rounding keeps 2.54cm at
+    // exactly 96px.
+    int64_t numerator = (whole * divide + fraction) * LENGTH_ONE * unit->scale;
+    int64_t denominator = divide * unit->divide;
+    int64_t fixed = (numerator + denominator / 2) / denominator;
+
+    if (fixed > INT32_MAX)
+        fixed = INT32_MAX;
+
+    length->value = negative ? -fixed : fixed;
+    length->type = unit->type;
+
+    while (i < value.len && isspace((byte)data[i]))
+        i++;
+
+    *pos = i;
+    return true;
+}
+
+length_t HTML_ParseLengthAttribute(slice_t value)
+{
+    length_t length = {0, LEN_PIXEL};
+    size_t pos = 0;
+
+    if (!HTML_ParseLength(value, &pos, &length) || pos != value.len) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseLengthAttribute", "Unknown measurement"
+        " in length %.*s. Ignoring", SLICE_ARGS(value));
+        length.value = 0;
         length.type = LEN_PIXEL;
     }
-    // Pica
-    else if (last2_char == 'p' && last_char == 'c') {
-        // 1 pc = 12pt
-        length.len = (int)((float)length.len * 1.33 * 12);
-        length.type = LEN_PIXEL;
-    } else {
-        if (last_char >= '0' && last_char <= '9') {
-            length.type = LEN_PIXEL;
-        } else {
-            printf("HTML_ParseLengthAttribute: Unknown measurement"
-            " in length %s. Ignoring\n", value);
-            length.len = 0; 
+
+    return length;
+}
+
+static size_t HTML_ScanMultiLengths(slice_t value, length_t* lengths, size_t max, bool* valid)
+{
+    size_t count = 0;
+    size_t pos = 0;
+
+    *valid = true;
+
+    while (pos < value.len) {
+        length_t length;
+
+        if (!HTML_ParseLength(value, &pos, &length) || (pos < value.len && value.ptr[pos] != ',')) {
+            *valid = false;
+            break;
         }
+
+        if (count < max)
+            lengths[count] = length;
+        count++;
+
+        // Step over the comma.
+        pos++;
     }
 
-    return length;
+    return count;
 }
 
-clear_t HTML_ParseClearAttribute(char* value)
+//
+// HTML_ParseMultiLengths
+// -----
+// Parses a comma separated list of lengths, like a
+// frameset's cols="1*,2*,50%", storing up to max of them.
+// Returns how many there are in all (which may be more
+// than max), stopping at the first one that's broken.
+//
+size_t HTML_ParseMultiLengths(slice_t value, length_t* lengths, size_t max)
 {
-    clear_t clear;
-    int result = 0;
+    bool valid;
+    return HTML_ScanMultiLengths(value, lengths, max, &valid);
+}
 
-    GEN_FROM_VALUE(value, "left", CLEAR_LEFT, clear, result);
-    GEN_FROM_VALUE(value, "right", CLEAR_RIGHT, clear, result);
-    GEN_FROM_VALUE(value, "all", CLEAR_ALL, clear, result);
-    GEN_FROM_VALUE(value, "none", CLEAR_NONE, clear, result);
+static const html_enumvalue_t html_clear_values[] = {
+    ENUM_VALUE("left",   CLEAR_LEFT),
+    ENUM_VALUE("right",  CLEAR_RIGHT),
+    ENUM_VALUE("all",    CLEAR_ALL),
+    ENUM_VALUE("none",   CLEAR_NONE),
+};
 
-    if (result == 0) {
-        printf("HTML_ParseClearAttribute: Unknown clear value %s\n", value);
+clear_t HTML_ParseClearAttribute(slice_t value)
+{
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_clear_values, 
+                                        ENUM_VALUE_COUNT(html_clear_values));
+
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseClearAttribute", "Unknown clear value %.*s",
+                    SLICE_ARGS(value));
+        return CLEAR_NONE;
     }
 
-    return clear;
+    return entry->value;
 }
 
-number_t HTML_ParseNumberAttribute(char* value)
+number_t HTML_ParseNumberAttribute(slice_t value)
 {
-    number_t number = strtod(value, NULL);
+    number_t number = Util_SliceToDouble(value);
     return number;
 }
 
-coords_t HTML_ParseCoordsAttribute(char* value)
+coords_t HTML_ParseCoordsAttribute(slice_t value)
 {
     coords_t coords;
 
-    unsigned int coord[4];
+    unsigned int coord[4] = {0};
     int coord_index = 0;
-    for (int i = 0; i < strlen(value); i++) {
+    for (size_t i = 0; i < value.len; i++) {
         // Ignore any number after the 4 coords
         if (coord_index > 3)
             continue;
         // This is off spec, but basically if it's not
         // a number, we don't care about it.
-        if (value[i] >= '0' && value[i] <= '9') {
-            coord[coord_index] = coord[coord_index] * 10 + (value[i] - '0');
-        } else if (value[i] == ',') {
+        if (value.ptr[i] >= '0' && value.ptr[i] <= '9') {
+            coord[coord_index] = coord[coord_index] * 10 + (value.ptr[i] - '0');
+        } else if (value.ptr[i] == ',') {
             coord_index++; // Move to the next color component
         }
     }
@@ -616,381 +733,396 @@ coords_t HTML_ParseCoordsAttribute(char* value)
     return coords;
 }
 
-tframe_t HTML_ParseTFrameAttribute(char* value)
+static const html_enumvalue_t html_tframe_values[] = {
+    ENUM_VALUE("void",    TF_VOID),
+    ENUM_VALUE("above",   TF_ABOVE),
+    ENUM_VALUE("below",   TF_BELOW),
+    ENUM_VALUE("hsides",  TF_HSIDES),
+    ENUM_VALUE("lhs",     TF_LHS),
+    ENUM_VALUE("rhs",     TF_RHS),
+    ENUM_VALUE("vsides",  TF_VSIDES),
+    ENUM_VALUE("box",     TF_BOX),
+    ENUM_VALUE("border",  TF_BORDER),
+};
+
+tframe_t HTML_ParseTFrameAttribute(slice_t value)
 {
-    tframe_t tframe;
-    int result = 0;
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_tframe_values, 
+                                        ENUM_VALUE_COUNT(html_tframe_values));
 
-    GEN_FROM_VALUE(value, "void", TF_VOID, tframe, result);
-    GEN_FROM_VALUE(value, "above", TF_ABOVE, tframe, result);
-    GEN_FROM_VALUE(value, "below", TF_BELOW, tframe, result);
-    GEN_FROM_VALUE(value, "hsides", TF_HSIDES, tframe, result);
-    GEN_FROM_VALUE(value, "lhs", TF_LHS, tframe, result);
-    GEN_FROM_VALUE(value, "rhs", TF_RHS, tframe, result);
-    GEN_FROM_VALUE(value, "vsides", TF_VSIDES, tframe, result);
-    GEN_FROM_VALUE(value, "box", TF_BOX, tframe, result);
-    GEN_FROM_VALUE(value, "border", TF_BORDER, tframe, result);
-    
-    if (result == 0) {
-        printf("HTML_ParseTFrameAttribute: Unknown tframe %s\n", value);
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseTFrameAttribute", "Unknown tframe %.*s",
+                    SLICE_ARGS(value));
+        return TF_NONE;
     }
 
-    return tframe;
+    return entry->value;
 }
 
-method_t HTML_ParseMethodAttribute(char* value)
+static const html_enumvalue_t html_method_values[] = {
+    ENUM_VALUE("get",   METHOD_GET),
+    ENUM_VALUE("post",  METHOD_POST),
+};
+
+method_t HTML_ParseMethodAttribute(slice_t value)
 {
-    method_t method;
-    int result = 0;
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_method_values, 
+                                        ENUM_VALUE_COUNT(html_method_values));
 
-    GEN_FROM_VALUE(value, "get", METHOD_GET, method, result);
-    GEN_FROM_VALUE(value, "post", METHOD_POST, method, result);
-    
-    if (result == 0) {
-        printf("HTML_ParseMethodAttribute: Unknown method %s\n", value);
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseMethodAttribute", "Unknown method %.*s",
+                    SLICE_ARGS(value));
+        return METHOD_NONE;
     }
 
-    return method;
+    return entry->value;
 }
 
-trules_t HTML_ParseTRulesAttribute(char* value)
-{
-    trules_t trules;
-    int result = 0;
+static const html_enumvalue_t html_trules_values[] = {
+    ENUM_VALUE("none",    TR_NONE),
+    ENUM_VALUE("groups",  TR_GROUPS),
+    ENUM_VALUE("rows",    TR_ROWS),
+    ENUM_VALUE("cols",    TR_COLS),
+    ENUM_VALUE("all",     TR_ALL),
+};
 
-    GEN_FROM_VALUE(value, "none", TR_NONE, trules, result);
-    GEN_FROM_VALUE(value, "groups", TR_GROUPS, trules, result);
-    GEN_FROM_VALUE(value, "rows", TR_ROWS, trules, result);
-    GEN_FROM_VALUE(value, "cols", TR_COLS, trules, result);
-    GEN_FROM_VALUE(value, "all", TR_ALL, trules, result);
+trules_t HTML_ParseTRulesAttribute(slice_t value)
+{
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_trules_values, 
+                                        ENUM_VALUE_COUNT(html_trules_values));
 
-    if (result == 0) {
-        printf("HTML_ParseTRulesAttribute: Unknown rule %s\n", value);
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseTRulesAttribute", "Unknown rule %.*s",
+                    SLICE_ARGS(value));
+        return TR_NONE;
     }
 
-    return trules;
+    return entry->value;
 }
 
-scope_t HTML_ParseScopeAttribute(char* value)
+static const html_enumvalue_t html_scope_values[] = {
+    ENUM_VALUE("row",       SCOPE_ROW),
+    ENUM_VALUE("col",       SCOPE_COL),
+    ENUM_VALUE("rowgroup",  SCOPE_ROWGROUP),
+    ENUM_VALUE("colgroup",  SCOPE_COLGROUP),
+};
+
+scope_t HTML_ParseScopeAttribute(slice_t value)
 {
-    scope_t scope;
-    int result = 0;
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_scope_values, 
+                                        ENUM_VALUE_COUNT(html_scope_values));
 
-    GEN_FROM_VALUE(value, "row", SCOPE_ROW, scope, result);
-    GEN_FROM_VALUE(value, "col", SCOPE_COL, scope, result);
-    GEN_FROM_VALUE(value, "rowgroup", SCOPE_ROWGROUP, scope, result);
-    GEN_FROM_VALUE(value, "colgroup", SCOPE_COLGROUP, scope, result);
-    
-    if (result == 0) {
-        printf("HTML_ParseScopeAttribute: Unknown scope %s\n", value);
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseScopeAttribute", "Unknown scope %.*s",
+                    SLICE_ARGS(value));
+        return SCOPE_NONE;
     }
 
-    return scope;
+    return entry->value;
 }
 
-scroll_t HTML_ParseScrollAttribute(char* value)
-{
-    scroll_t scroll;
-    int result = 0;
+static const html_enumvalue_t html_scroll_values[] = {
+    ENUM_VALUE("yes",   SCROLL_YES),
+    ENUM_VALUE("no",    SCROLL_NO),
+    ENUM_VALUE("auto",  SCROLL_AUTO),
+};
 
-    GEN_FROM_VALUE(value, "yes", SCROLL_YES, scroll, result);
-    GEN_FROM_VALUE(value, "no", SCROLL_NO, scroll, result);
-    GEN_FROM_VALUE(value, "auto", SCROLL_AUTO, scroll, result);
+scroll_t HTML_ParseScrollAttribute(slice_t value)
+{
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_scroll_values, 
+                                        ENUM_VALUE_COUNT(html_scroll_values));
 
-    if (result == 0) {
-        printf("HTML_ParseScrollAttribute: Unknown scroll value %s\n", value);
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseScrollAttribute", "Unknown scroll value %.*s",
+                    SLICE_ARGS(value));
+        return SCROLL_NONE;
     }
 
-    return scroll;
+    return entry->value;
 }
 
-shape_t HTML_ParseShapeAttribute(char* value)
-{
-    shape_t shape;
-    int result = 0;
+static const html_enumvalue_t html_shape_values[] = {
+    ENUM_VALUE("rect",     SHAPE_RECT),
+    ENUM_VALUE("circle",   SHAPE_CIRCLE),
+    ENUM_VALUE("poly",     SHAPE_POLY),
+    ENUM_VALUE("default",  SHAPE_DEFAULT),
+};
 
-    GEN_FROM_VALUE(value, "rect", SHAPE_RECT, shape, result);
-    GEN_FROM_VALUE(value, "circle", SHAPE_CIRCLE, shape, result);
-    GEN_FROM_VALUE(value, "poly", SHAPE_POLY, shape, result);
-    GEN_FROM_VALUE(value, "default", SHAPE_DEFAULT, shape, result);
+shape_t HTML_ParseShapeAttribute(slice_t value)
+{
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_shape_values, 
+                                        ENUM_VALUE_COUNT(html_shape_values));
 
-    if (result == 0) {
-        printf("HTML_ParseShapeAttribute: Unknown shape %s\n", value);
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseShapeAttribute", "Unknown shape %.*s",
+                    SLICE_ARGS(value));
+        return SHAPE_NONE;
     }
 
-    return shape;
+    return entry->value;
 }
 
-char* HTML_ParseStyleSheetAttribute(char* value)
+slice_t HTML_ParseStyleSheetAttribute(slice_t value)
 {
-    int size = strlen(value);
+    slice_t style = value;
 
     // If the end of a stylesheet has whitespace,
-    // adjust the size to avoid copying it.
-    if (value[size - 1] == ' ')
-        size -= 1;
+    // leave it out of the slice.
+    if (style.len > 0 && style.ptr[style.len - 1] == ' ')
+        style.len -= 1;
 
-    char* dest = malloc(sizeof(char)*(size + 1));
+    // An empty one has nothing to end.
+    if (style.len > 0 && style.ptr[style.len - 1] != ';')
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseStyleSheetAttribute", "style \'%.*s\'"
+        " is missing ending semi-colon (;)", SLICE_ARGS(value));
 
-    for (int i = 0; i < size; i++) {
-        dest[i] = value[i];
-    }
-    dest[size + 1] = '\0';
+    return style;
+}
 
-    if (dest[strlen(dest) - 1] != ';')
-        printf("HTML_ParseStyleSheetAttribute: style \'%s\'"
-        " is missing ending semi-colon (;)\n", value);
+static const html_enumvalue_t html_valign_values[] = {
+    ENUM_VALUE("top",       VA_TOP),
+    ENUM_VALUE("middle",    VA_MIDDLE),
+    ENUM_VALUE("bottom",    VA_BOTTOM),
+    ENUM_VALUE("baseline",  VA_BASELINE),
+};
+
+valign_t HTML_ParseVAlignAttribute(slice_t value)
+{
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_valign_values, 
+                                        ENUM_VALUE_COUNT(html_valign_values));
 
-    return dest;
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseVAlignAttribute", "Unknown valign %.*s",
+                    SLICE_ARGS(value));
+        return VA_NONE;
+    }
+
+    return entry->value;
 }
 
-valign_t HTML_ParseVAlignAttribute(char* value)
-{
-    valign_t valign;
-    int result = 0;
+static const html_enumvalue_t html_valuetype_values[] = {
+    ENUM_VALUE("data",    VT_DATA),
+    ENUM_VALUE("ref",     VT_REF),
+    ENUM_VALUE("object",  VT_OBJECT),
+};
 
-    GEN_FROM_VALUE(value, "top", VA_TOP, valign, result);
-    GEN_FROM_VALUE(value, "middle", VA_MIDDLE, valign, result);
-    GEN_FROM_VALUE(value, "bottom", VA_BOTTOM, valign, result);
-    GEN_FROM_VALUE(value, "baseline", VA_BASELINE, valign, result);
+valuetype_t HTML_ParseValueTypeAttribute(slice_t value)
+{
+    const html_enumvalue_t* entry = HTML_LookupEnumValue(value, html_valuetype_values, 
+                                        ENUM_VALUE_COUNT(html_valuetype_values));
 
-    if (result == 0) {
-        printf("HTML_ParseShapeAttribute: Unknown valign %s\n", value);
+    if (entry == NULL) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_ParseValueTypeAttribute", "Unknown valuetype %.*s",
+                    SLICE_ARGS(value));
+        return VT_NONE;
     }
 
-    return valign;
+    return entry->value;
 }
 
-valuetype_t HTML_ParseValueTypeAttribute(char* value)
+//
+// Assignment functions for every attribute value type,
+// referenced by the generated attribute name table.
+//
+static bool HTML_ParseBoolAttribute(slice_t value)
 {
-    valuetype_t valuetype;
-    int result = 0;
+    return true;
+}
 
-    GEN_FROM_VALUE(value, "data", VT_DATA, valuetype, result);
-    GEN_FROM_VALUE(value, "ref", VT_REF, valuetype, result);
-    GEN_FROM_VALUE(value, "object", VT_OBJECT, valuetype, result);
+//
+// HTML_KeepText
+// -----
+// Text values point into the document, but the streaming
+// tokenizer reuses its buffer, so there they have to be
+// copied into the arena instead. Values with character
+// references are decoded into the arena too.
+//
+static slice_t HTML_KeepText(html_document_t* document, slice_t text)
+{
+    return HTML_DecodeText(document->arena, text.ptr, text.len, document->copy_text, true);
+}
 
-    if (result == 0) {
-        printf("HTML_ParseValuetypeAttribute: Unknown valuetype %s\n", value);
-    }
+static void HTML_AssignTextAttribute(html_document_t* document, attrvalue_t* slot, slice_t value)
+{
+    slot->text = HTML_KeepText(document, HTML_ParseTextAttribute(value));
+}
 
-    return valuetype;
+static void HTML_AssignStyleSheetAttribute(html_document_t* document, attrvalue_t* slot, slice_t value)
+{
+    slot->text = HTML_KeepText(document, HTML_ParseStyleSheetAttribute(value));
 }
 
-void HTML_ParseAttributeContent(char* html_data, char* attribute_name, bool has_value,
-                                        attribute_t* attributes, int* offset)
+//
+// HTML_AssignMultiLengthAttribute
+// -----
+// cols and rows are lists of lengths on a frameset but a
+// plain number everywhere else, so they're kept as text
+// for HTML_ParseMultiLengths. They still get checked here
+// so broken ones are reported.
+//
+static void HTML_AssignMultiLengthAttribute(html_document_t* document, attrvalue_t* slot, slice_t value)
 {
-    // First off - we need to store the value in a char*,
-    // so let's prep that.
-    char* attr_value = NULL;
-    char* real_value = NULL;
+    bool valid;
+    HTML_ScanMultiLengths(value, NULL, 0, &valid);
 
-    if (has_value) {
-        // Before we begin, there's potential need to scrub the
-        // data at this point: we're particularly looking for
-        // whitespace and the start identifier ('"").
-        bool whitespace = true;
-        while(whitespace) {
-            if (html_data[*offset] != ' ') {
-                whitespace = false;
-                break;
-            } else {
-                *offset += 1;
-            }
-        }
+    if (!valid) {
+        Diag_Report(DIAG_BAD_VALUE, "HTML_AssignMultiLengthAttribute", "Bad length in list %.*s",
+                    SLICE_ARGS(value));
+    }
 
-        if (html_data[*offset - 1] == '"' && 
-        html_data[*offset] == '"') {
-            has_value = false;
-            *offset += 1;
-            return;
-        } 
-
-        if (html_data[*offset - 1] == ' ' && 
-        html_data[*offset - 2] == '"' &&
-        html_data[*offset] == '"') {
-            has_value = false;
-            *offset += 1;
-            return;
-        }
+    slot->text = HTML_KeepText(document, value);
+}
 
-        // Now, if we're at a '"', skip that too.
-        if (html_data[*offset] == '"') {
-            *offset += 1;
-        }
-            
+//
+// HTML_AssignAtomAttribute
+// -----
+// For text values that repeat all over a page (class,
+// type, rel, etc.). They're interned in the document's
+// string table, so equal values share one pointer and
+// can be compared with ==.
+//
+static void HTML_AssignAtomAttribute(html_document_t* document, attrvalue_t* slot, slice_t value)
+{
+    value = HTML_DecodeText(document->arena, value.ptr, value.len, false, true);
+    slot->text = Intern_String(document->strings, value.ptr, value.len);
+}
 
-        // Allocate memory for the char* that holds the value.
-        attr_value = malloc(sizeof(char)*MAX_ATTR_VAL_LEN);
+ATTR_ASSIGN_FUNC(HTML_AssignCoordsAttribute, coords, HTML_ParseCoordsAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignCharsetsAttribute, integer, HTML_ParseCharsetsAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignContentTypesAttribute, content_type, HTML_ParseContentTypesAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignCharacterAttribute, character, HTML_ParseCharacterAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignAlignAttribute, integer, HTML_ParseAlignAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignColorAttribute, color, HTML_ParseColorAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignPixelsAttribute, integer, HTML_ParsePixelsAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignLengthAttribute, length, HTML_ParseLengthAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignClearAttribute, integer, HTML_ParseClearAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignNumberAttribute, number, HTML_ParseNumberAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignTFrameAttribute, integer, HTML_ParseTFrameAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignMethodAttribute, integer, HTML_ParseMethodAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignTRulesAttribute, integer, HTML_ParseTRulesAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignScopeAttribute, integer, HTML_ParseScopeAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignScrollAttribute, integer, HTML_ParseScrollAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignShapeAttribute, integer, HTML_ParseShapeAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignVAlignAttribute, integer, HTML_ParseVAlignAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignValueTypeAttribute, integer, HTML_ParseValueTypeAttribute)
+ATTR_ASSIGN_FUNC(HTML_AssignBoolAttribute, boolean, HTML_ParseBoolAttribute)
 
-        // Store the offset index for the value parsing.
-        int val_offset = 0;
+//
+// Attribute names are resolved through a perfect hash table
+// generated from tools/keys/attributes.txt, which maps each
+// name straight to its field and value parser.
+//
+#include <html/html_attributes_hash.h>
 
-        // Just like BeginParse, iterate through the document.
-        int i = 0;
+//
+// HTML_LookupAttributeName
+// -----
+// Returns the table entry for an attribute name, ignoring
+// case, or NULL if it isn't one we support.
+//
+const html_attrname_t* HTML_LookupAttributeName(const char* name, size_t len)
+{
+    uint32_t hash = Util_HashFold(name, len);
+    uint32_t displace = html_attributes_displace[hash & (HTML_ATTRIBUTES_BUCKETS - 1)];
+    const html_attrname_t* entry = 
+        &html_attributes_table[Util_HashSlot(hash, displace, HTML_ATTRIBUTES_SLOTS - 1)];
 
-        for (i = 0; i < MAX_ATTR_VAL_LEN; i++) {
-            // End of value, break off.
-            if (html_data[i + *offset] == '"') {
-                i++;
-                break;
-            }
+    if (entry->name != NULL && Util_FoldEquals(name, len, entry->name, entry->len))
+        return entry;
 
-            // Otherwise, append to value contents.
-            attr_value[val_offset] = html_data[i + *offset];
-            attr_value[val_offset + 1] = '\0';
-            val_offset++;
-        }
+    return NULL;
+}
+
+//
+// HTML_GetAttributeStringFromID
+// -----
+// Returns the name of an attribute. Searches the whole
+// table, so keep it out of anything hot.
+//
+const char* HTML_GetAttributeStringFromID(byte id)
+{
+    for (int i = 0; i < HTML_ATTRIBUTES_SLOTS; i++) {
+        const html_attrname_t* entry = &html_attributes_table[i];
 
-        // Update the document position.
-        *offset += i;
+        if (entry->name != NULL && entry->id == id)
+            return entry->name;
+    }
 
-        // Now we have a mess to clean up, obviously we don't want
-        // to allocate 512 bytes for every attribute value.
-        real_value = malloc(sizeof(char)*(val_offset + 1));
+    return "unknown";
+}
 
-        // Copy the value data to the optimized char*.
-        for (int j = 0; j < val_offset + 1; j++) {
-            real_value[j] = attr_value[j];
-        }
+//
+// HTML_MarkAttributes
+// -----
+// Sets the bit of every attribute parsed by assign in a
+// bitmap laid out like attribute_t's present.
+//
+static void HTML_MarkAttributes(uint64_t* bits, html_attrassign_t assign)
+{
+    for (int i = 0; i < HTML_ATTRIBUTES_SLOTS; i++) {
+        const html_attrname_t* entry = &html_attributes_table[i];
 
-        // Free the bloaty one.
-        free(attr_value);
-    }
-
-    // Iterate through all supported attributes and fill
-    // the value accordingly.
-    char* name = attribute_name;
-    int result = 0;
-
-    if (name[0] == 'a' || name[0] == 'A') {
-        ASSIGN_TEXT_ATTR(name, "abbr", attributes->abbr, real_value, result);
-        ASSIGN_CSET_ATTR(name, "accept-charset", attributes->accept_charset,
-                        real_value, result);
-        ASSIGN_CONT_ATTR(name, "accept", attributes->accept, real_value, result);
-        ASSIGN_CHAR_ATTR(name, "accesskey", attributes->accesskey, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "action", attributes->action, real_value, result);
-        ASSIGN_ALGN_ATTR(name, "align", attributes->align, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "alt", attributes->alt, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "archive", attributes->archive, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "axis", attributes->axis, real_value, result);
-    } else if (attribute_name[0] == 'b' || attribute_name[0] == 'B') {
-        ASSIGN_TEXT_ATTR(name, "background", attributes->background, real_value, result);
-        ASSIGN_COLR_ATTR(name, "bgcolor", attributes->bgcolor, real_value, result);
-        ASSIGN_PIXL_ATTR(name, "border", attributes->border, real_value, result);
-        ASSIGN_LENG_ATTR(name, "bottommargin", attributes->bottommargin, real_value, result);
-    } else if (attribute_name[0] == 'c' || attribute_name[0] == 'C') {
-        ASSIGN_LENG_ATTR(name, "cellpadding", attributes->cellpadding, real_value, result);
-        ASSIGN_LENG_ATTR(name, "cellspacing", attributes->cellspacing, real_value, result);
-        ASSIGN_CHAR_ATTR(name, "char", attributes->_char, real_value, result);
-        ASSIGN_LENG_ATTR(name, "charoff", attributes->charoff, real_value, result);
-        ASSIGN_CSET_ATTR(name, "charset", attributes->charset, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "checked", attributes->checked, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "cite", attributes->cite, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "class", attributes->class, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "classid", attributes->classid, real_value, result);
-        ASSIGN_CLER_ATTR(name, "clear", attributes->clear, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "code", attributes->code, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "codebase", attributes->codebase, real_value, result);
-        ASSIGN_CONT_ATTR(name, "codetype", attributes->codetype, real_value, result);
-        ASSIGN_COLR_ATTR(name, "color", attributes->color, real_value, result);
-        ASSIGN_LENG_ATTR(name, "cols", attributes->cols, real_value, result);
-        ASSIGN_NUMB_ATTR(name, "colspan", attributes->colspan, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "compact", attributes->compact, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "content", attributes->content, real_value, result);
-        ASSIGN_CORD_ATTR(name, "coords", attributes->coords, real_value, result);
-    } else if (attribute_name[0] == 'd' || attribute_name[0] == 'D') {
-        ASSIGN_TEXT_ATTR(name, "data", attributes->data, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "datetime", attributes->datetime, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "declare", attributes->declare, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "dir", attributes->dir, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "disabled", attributes->disabled, real_value, result);
-    } else if (attribute_name[0] == 'e' || attribute_name[0] == 'E') {
-        ASSIGN_CONT_ATTR(name, "enctype", attributes->enctype, real_value, result);
-    } else if (attribute_name[0] == 'f' || attribute_name[0] == 'F') {
-        ASSIGN_TEXT_ATTR(name, "face", attributes->face, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "for", attributes->_for, real_value, result);
-        ASSIGN_TFRM_ATTR(name, "frame", attributes->frame, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "frameborder", attributes->frameborder, real_value, result);
-    } else if (attribute_name[0] == 'h' || attribute_name[0] == 'H') {
-        ASSIGN_TEXT_ATTR(name, "headers", attributes->headers, real_value, result);
-        ASSIGN_LENG_ATTR(name, "height", attributes->height, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "href", attributes->href, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "hreflang", attributes->hreflang, real_value, result);
-        ASSIGN_PIXL_ATTR(name, "hspace", attributes->hspace, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "http-equiv", attributes->http_equiv, real_value, result);
-    } else if (attribute_name[0] == 'i' || attribute_name[0] == 'I') {
-        ASSIGN_TEXT_ATTR(name, "id", attributes->id, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "ismap", attributes->ismap, real_value, result);
-    } else if (attribute_name[0] == 'l' || attribute_name[0] == 'L') {
-        ASSIGN_TEXT_ATTR(name, "label", attributes->label, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "lang", attributes->lang, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "language", attributes->language, real_value, result);
-        ASSIGN_LENG_ATTR(name, "leftmargin", attributes->leftmargin, real_value, result);
-        ASSIGN_COLR_ATTR(name, "link", attributes->link, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "longdesc", attributes->longdesc, real_value, result);
-    } else if (attribute_name[0] == 'm' || attribute_name[0] == 'M') {
-        ASSIGN_PIXL_ATTR(name, "marginheight", attributes->marginheight, real_value, result);
-        ASSIGN_PIXL_ATTR(name, "marginwidth", attributes->marginwidth, real_value, result);
-        ASSIGN_NUMB_ATTR(name, "maxlength", attributes->maxlength, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "media", attributes->media, real_value, result);
-        ASSIGN_MTHD_ATTR(name, "method", attributes->method, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "multiple", attributes->multiple, real_value, result);
-    } else if (attribute_name[0] == 'n' || attribute_name[0] == 'N') {
-        ASSIGN_TEXT_ATTR(name, "name", attributes->name, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "nohref", attributes->nohref, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "noresize", attributes->noresize, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "noshade", attributes->noshade, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "nowrap", attributes->nowrap, real_value, result);
-    } else if (attribute_name[0] == 'o' || attribute_name[0] == 'O') {
-        ASSIGN_TEXT_ATTR(name, "object", attributes->object, real_value, result);
-    } else if (attribute_name[0] == 'p' || attribute_name[0] == 'P') {
-        ASSIGN_TEXT_ATTR(name, "profile", attributes->profile, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "prompt", attributes->prompt, real_value, result);
-    } else if (attribute_name[0] == 'r' || attribute_name[0] == 'R') {
-        ASSIGN_BOOL_ATTR(name, "readonly", attributes->readonly, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "rel", attributes->rel, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "required", attributes->required, real_value, result);
-        ASSIGN_LENG_ATTR(name, "rightmargin", attributes->rightmargin, real_value, result);
-        ASSIGN_LENG_ATTR(name, "rows", attributes->rows, real_value, result);
-        ASSIGN_NUMB_ATTR(name, "rowspan", attributes->rowspan, real_value, result);
-        ASSIGN_TRLE_ATTR(name, "rules", attributes->rules, real_value, result);
-    } else if (attribute_name[0] == 's' || attribute_name[0] == 'S') {
-        ASSIGN_TEXT_ATTR(name, "scheme", attributes->scheme, real_value, result);
-        ASSIGN_SCOP_ATTR(name, "scope", attributes->scope, real_value, result);
-        ASSIGN_SCRL_ATTR(name, "scrolling", attributes->scrolling, real_value, result);
-        ASSIGN_BOOL_ATTR(name, "selected", attributes->selected, real_value, result);
-        ASSIGN_SHPE_ATTR(name, "shape", attributes->shape, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "size", attributes->size, real_value, result);
-        ASSIGN_NUMB_ATTR(name, "span", attributes->span, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "src", attributes->src, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "standby", attributes->standby, real_value, result);
-        ASSIGN_NUMB_ATTR(name, "start", attributes->start, real_value, result);
-        ASSIGN_STYL_ATTR(name, "style", attributes->style, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "summary", attributes->summary, real_value, result);
-    } else if (attribute_name[0] == 't' || attribute_name[0] == 'T') {
-        ASSIGN_NUMB_ATTR(name, "tabindex", attributes->tabindex, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "target", attributes->target, real_value, result);
-        ASSIGN_COLR_ATTR(name, "text", attributes->text, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "title", attributes->title, real_value, result);
-        ASSIGN_LENG_ATTR(name, "topmargin", attributes->topmargin, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "type", attributes->type, real_value, result);
-    } else if (attribute_name[0] == 'u' || attribute_name[0] == 'U') {
-        ASSIGN_TEXT_ATTR(name, "usemap", attributes->usemap, real_value, result);
-    } else if (attribute_name[0] == 'v' || attribute_name[0] == 'V') {
-        ASSIGN_VALN_ATTR(name, "valign", attributes->valign, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "value", attributes->value, real_value, result);
-        ASSIGN_VALT_ATTR(name, "valuetype", attributes->valuetype, real_value, result);
-        ASSIGN_TEXT_ATTR(name, "version", attributes->version, real_value, result);
-        ASSIGN_COLR_ATTR(name, "vlink", attributes->vlink, real_value, result);
-        ASSIGN_PIXL_ATTR(name, "vspace", attributes->vspace, real_value, result);
-    } else if (attribute_name[0] == 'w' || attribute_name[0] == 'W') {
-        ASSIGN_LENG_ATTR(name, "width", attributes->width, real_value, result);
-    } 
-    
-    if (result == 0) {
-        printf("HTML_ParseAttributeContent: Unrecognized attribute name %s\n", 
-        attribute_name);
+        if (entry->name != NULL && entry->assign == assign)
+            bits[entry->id / 64] |= (uint64_t)1 << (entry->id % 64);
     }
+}
 
+//
+// HTML_FindAtomAttributes
+// -----
+// Marks the attributes whose values are interned.
+//
+void HTML_FindAtomAttributes(uint64_t* atoms)
+{
+    memset(atoms, 0, sizeof(uint64_t) * ((HTML_ATTR_COUNT + 63) / 64));
+    HTML_MarkAttributes(atoms, HTML_AssignAtomAttribute);
+}
+
+//
+// HTML_FindTextAttributes
+// -----
+// Marks the attributes whose values are text slices,
+// interned or not.
+//
+void HTML_FindTextAttributes(uint64_t* text)
+{
+    memset(text, 0, sizeof(uint64_t) * ((HTML_ATTR_COUNT + 63) / 64));
+    HTML_MarkAttributes(text, HTML_AssignTextAttribute);
+    HTML_MarkAttributes(text, HTML_AssignStyleSheetAttribute);
+    HTML_MarkAttributes(text, HTML_AssignMultiLengthAttribute);
+    HTML_MarkAttributes(text, HTML_AssignAtomAttribute);
+}
+
+//
+// HTML_AddAttribute
+// -----
+// Sets an attribute the tokenizer read. The value is a
+// slice of the document, the parsers only need to look at
+// it (or keep pointing into the document). Boolean
+// attributes (and broken ones) can show up without a
+// value, those get an empty one.
+//
+void HTML_AddAttribute(html_document_t* document, attribute_t* attributes, 
+                        slice_t attribute_name, slice_t value)
+{
+    // Look up the attribute and hand the value off to the
+    // parser for its type.
+    const html_attrname_t* entry = HTML_LookupAttributeName(attribute_name.ptr, 
+                                                            attribute_name.len);
+
+    if (entry != NULL) {
+        attrvalue_t* slot = HTML_SetAttribute(document->arena, attributes, entry->id);
+        HTML_COUNT(document, attributes[entry->id], 1);
+
+        if (slot == NULL) {
+            HTML_COUNT(document, duplicate_attributes, 1);
+            ATTR_DUPE_REPORT(attribute_name);
+        } else {
+            entry->assign(document, slot, value);
+        }
+    } else {
+        HTML_COUNT(document, unknown_attributes, 1);
+        Diag_Report(DIAG_UNKNOWN_ATTRIBUTE, "HTML_AddAttribute", "Unrecognized attribute name %.*s", 
+        SLICE_ARGS(attribute_name));
+    }
 }
@@ -0,0 +1,674 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <diag.h>
+#include <intern.h>
+#include <html/html_attributeparser.h>
+#include <html/html_cache.h>
+#include <html/html_parser.h>
+
+//
+// The parse cache. A parsed document is written out to
+// <cache_dir>/<content hash>.tree, and the next time the
+// same document comes along the file is mapped straight
+// back in instead of parsing it again. Nodes, attributes
+// and text stay where they are in the mapping, which is
+// never written to: offsets are turned into pointers as the
+// text and attributes get asked for, and only once a loaded
+// document is edited do its nodes move out of the mapping.
+//
+
+// Every section starts on a multiple of this.
+#define HTML_CACHE_ALIGN        8
+
+// Text written so far that didn't come from the source.
+typedef struct {
+    const char*             ptr;            // NULL if unused.
+    size_t                  len;
+    uint64_t                offset;
+} html_cachestring_t;
+
+typedef struct {
+    html_document_t*        document;
+    uint64_t                text[(HTML_ATTR_COUNT + 63) / 64];
+    uint64_t                strings;        // File offset of the strings section.
+    char*                   extra;          // Text from outside the source, after it.
+    size_t                  extra_len;
+    size_t                  extra_capacity;
+    html_cachestring_t*     seen;           // Open addressed by pointer.
+    uint32_t                seen_count;
+    uint32_t                seen_capacity;
+} html_cachewriter_t;
+
+static void HTML_CachePath(char* path, size_t size, const char* cache_dir, uint64_t hash)
+{
+    snprintf(path, size, "%s/%016llx.tree", cache_dir, (unsigned long long)hash);
+}
+
+static uint64_t HTML_CacheAlign(uint64_t offset)
+{
+    return (offset + HTML_CACHE_ALIGN - 1) & ~(uint64_t)(HTML_CACHE_ALIGN - 1);
+}
+
+static bool HTML_IsTextAttribute(const uint64_t* text, byte id)
+{
+    return (text[id / 64] >> (id % 64)) & 1;
+}
+
+static uint32_t HTML_CacheSeenSlot(const char* ptr, uint32_t mask)
+{
+    uint64_t hash = (uintptr_t)ptr * 0x9E3779B97F4A7C15ULL;
+    return (hash >> 32) & mask;
+}
+
+static html_cachestring_t* HTML_CacheFindSeen(html_cachewriter_t* writer, const char* ptr, size_t len)
+{
+    uint32_t mask = writer->seen_capacity - 1;
+
+    for (uint32_t slot = HTML_CacheSeenSlot(ptr, mask);; slot = (slot + 1) & mask) {
+        html_cachestring_t* entry = &writer->seen[slot];
+
+        if (entry->ptr == NULL || (entry->ptr == ptr && entry->len == len))
+            return entry;
+    }
+}
+
+static void HTML_CacheGrowSeen(html_cachewriter_t* writer)
+{
+    html_cachestring_t* old = writer->seen;
+    uint32_t old_capacity = writer->seen_capacity;
+
+    writer->seen_capacity *= 2;
+    writer->seen = calloc(writer->seen_capacity, sizeof(html_cachestring_t));
+
+    for (uint32_t i = 0; i < old_capacity; i++) {
+        if (old[i].ptr != NULL)
+            *HTML_CacheFindSeen(writer, old[i].ptr, old[i].len) = old[i];
+    }
+
+    free(old);
+}
+
+//
+// HTML_CacheString
+// -----
+// Returns the file offset text will end up at. Text from
+// the source is already there. Anything else gets added
+// after it, once per pointer, so strings shared in memory
+// (interned ones especially) stay shared after loading.
+//
+static uint64_t HTML_CacheString(html_cachewriter_t* writer, const char* ptr, size_t len)
+{
+    html_document_t* document = writer->document;
+
+    // Empty slices all point at the source's terminator.
+    if (len == 0)
+        return writer->strings + document->source_len;
+
+    if (document->source != NULL && ptr >= document->source &&
+        ptr + len <= document->source + document->source_len)
+        return writer->strings + (ptr - document->source);
+
+    if ((writer->seen_count + 1) * 4 > writer->seen_capacity * 3)
+        HTML_CacheGrowSeen(writer);
+
+    html_cachestring_t* entry = HTML_CacheFindSeen(writer, ptr, len);
+    if (entry->ptr != NULL)
+        return entry->offset;
+
+    while (writer->extra_len + len + 1 > writer->extra_capacity) {
+        writer->extra_capacity *= 2;
+        writer->extra = realloc(writer->extra, writer->extra_capacity);
+    }
+
+    entry->ptr = ptr;
+    entry->len = len;
+    entry->offset = writer->strings + document->source_len + 1 + writer->extra_len;
+    writer->seen_count++;
+
+    memcpy(&writer->extra[writer->extra_len], ptr, len);
+    writer->extra[writer->extra_len + len] = '\0';
+    writer->extra_len += len + 1;
+
+    return entry->offset;
+}
+
+// Swaps the text slices among pairs for file offsets.
+static void HTML_CachePairs(html_cachewriter_t* writer, attrpair_t* pairs, int count)
+{
+    for (int i = 0; i < count; i++) {
+        if (HTML_IsTextAttribute(writer->text, pairs[i].id)) {
+            slice_t* text = &pairs[i].value.text;
+            text->ptr = (const char*)(uintptr_t)HTML_CacheString(writer, text->ptr, text->len);
+        }
+    }
+}
+
+//
+// HTML_CacheWrite
+// -----
+// Writes size bytes at offset, zero filling from wherever
+// the file is up to now.
+//
+static void HTML_CacheWrite(FILE* file, uint64_t* position, uint64_t offset,
+                            const void* data, size_t size)
+{
+    static const char zeroes[HTML_CACHE_ALIGN];
+
+    if (offset > *position)
+        fwrite(zeroes, 1, offset - *position, file);
+
+    if (size > 0)
+        fwrite(data, 1, size, file);
+
+    *position = offset + size;
+}
+
+//
+// HTML_SaveCache
+// -----
+// Writes the document to the parse cache, keyed by the
+// hash and length of what it was parsed from. The file is
+// written under a temporary name first, so a reader never
+// sees half of one.
+//
+bool HTML_SaveCache(html_document_t* document, const char* cache_dir, uint64_t hash, size_t length)
+{
+    html_cacheheader_t header;
+    memset(&header, 0, sizeof(header));
+
+    // A loaded document needs its pointers back, and an
+    // edited one has gaps in its nodes and source to close
+    // up first.
+    HTML_DetachCache(document);
+    HTML_CompactNodes(document);
+    if (document->source != NULL)
+        HTML_DocumentSource(document);
+
+    memcpy(header.magic, HTML_CACHE_MAGIC, sizeof(header.magic));
+    header.version = HTML_CACHE_VERSION;
+    header.byte_order = HTML_CACHE_BYTE_ORDER;
+    header.pointer_size = sizeof(void*);
+    header.node_size = sizeof(html_node_t);
+    header.attribute_size = sizeof(attribute_t);
+    header.attribute_count = HTML_ATTR_COUNT;
+    header.hash = hash;
+    header.length = length;
+    header.node_count = document->node_count;
+    header.current = document->current;
+    header.source_len = document->source != NULL ? document->source_len : 0;
+    header.has_source = document->source != NULL;
+    header.element_count = HTML_ELEM_COUNT;
+    header.atom_total = document->strings->count;
+
+    for (nodeid_t i = 0; i < document->node_count; i++) {
+        html_node_t* node = &document->nodes[i];
+
+        if (node->type != HTML_NODE_ELEMENT || node->attributes == NULL)
+            continue;
+
+        header.attribute_total++;
+        if (node->attributes->overflow != NULL)
+            header.pair_total += node->attributes->count;
+    }
+
+    header.nodes = HTML_CacheAlign(sizeof(header));
+    header.attributes = HTML_CacheAlign(header.nodes + sizeof(html_node_t) * header.node_count);
+    header.pairs = HTML_CacheAlign(header.attributes + sizeof(attribute_t) * header.attribute_total);
+    header.atoms = HTML_CacheAlign(header.pairs + sizeof(attrpair_t) * header.pair_total);
+    header.strings = HTML_CacheAlign(header.atoms + sizeof(html_cacheatom_t) * header.atom_total);
+
+    html_cachewriter_t writer;
+    writer.document = document;
+    writer.strings = header.strings;
+    writer.extra_len = 0;
+    writer.extra_capacity = 4096;
+    writer.extra = malloc(writer.extra_capacity);
+    writer.seen_count = 0;
+    writer.seen_capacity = 256;
+    writer.seen = calloc(writer.seen_capacity, sizeof(html_cachestring_t));
+    HTML_FindTextAttributes(writer.text);
+
+    html_node_t* nodes = malloc(sizeof(html_node_t) * header.node_count);
+    attribute_t* attributes = malloc(sizeof(attribute_t) * (header.attribute_total + 1));
+    attrpair_t* pairs = malloc(sizeof(attrpair_t) * (header.pair_total + 1));
+    html_cacheatom_t* atoms = malloc(sizeof(html_cacheatom_t) * (header.atom_total + 1));
+    uint64_t attribute_index = 0;
+    uint64_t pair_index = 0;
+
+    for (nodeid_t i = 0; i < document->node_count; i++) {
+        html_node_t* node = &nodes[i];
+        *node = document->nodes[i];
+
+        if (node->type == HTML_NODE_TEXT) {
+            node->text = (const char*)(uintptr_t)HTML_CacheString(&writer, node->text, node->text_len);
+            continue;
+        }
+
+        if (node->type != HTML_NODE_ELEMENT || node->attributes == NULL) {
+            node->attributes = NULL;
+            continue;
+        }
+
+        attribute_t* attr = &attributes[attribute_index];
+        *attr = *node->attributes;
+
+        if (attr->overflow != NULL) {
+            // The inline slots are stale once it spills.
+            memset(attr->pairs, 0, sizeof(attr->pairs));
+            memcpy(&pairs[pair_index], attr->overflow, sizeof(attrpair_t) * attr->count);
+            HTML_CachePairs(&writer, &pairs[pair_index], attr->count);
+
+            attr->overflow = (attrpair_t*)(uintptr_t)(header.pairs + sizeof(attrpair_t) * pair_index);
+            attr->capacity = attr->count;
+            pair_index += attr->count;
+        } else {
+            memset(&attr->pairs[attr->count], 0, sizeof(attrpair_t) * (ATTR_INLINE_LEN - attr->count));
+            HTML_CachePairs(&writer, attr->pairs, attr->count);
+        }
+
+        node->attributes = (attribute_t*)(uintptr_t)(header.attributes + sizeof(attribute_t) * attribute_index);
+        attribute_index++;
+    }
+
+    intern_table_t* strings = document->strings;
+    uint64_t atom_index = 0;
+
+    for (uint32_t i = 0; i < strings->capacity; i++) {
+        intern_entry_t* entry = &strings->entries[i];
+
+        if (entry->ptr == NULL)
+            continue;
+
+        atoms[atom_index].offset = HTML_CacheString(&writer, entry->ptr, entry->len);
+        atoms[atom_index].len = entry->len;
+        atom_index++;
+    }
+
+    header.strings_len = header.source_len + 1 + writer.extra_len;
+
+    char path[PATH_MAX];
+    char temp_path[PATH_MAX + 8];
+    HTML_CachePath(path, sizeof(path), cache_dir, hash);
+    snprintf(temp_path, sizeof(temp_path), "%s.XXXXXX", path);
+
+    bool saved = false;
+    int fd = mkstemp(temp_path);
+    FILE* file = fd >= 0 ? fdopen(fd, "wb") : NULL;
+
+    if (file != NULL) {
+        uint64_t position = 0;
+
+        HTML_CacheWrite(file, &position, 0, &header, sizeof(header));
+        HTML_CacheWrite(file, &position, header.nodes, nodes, sizeof(html_node_t) * header.node_count);
+        HTML_CacheWrite(file, &position, header.attributes, attributes, 
+                        sizeof(attribute_t) * header.attribute_total);
+        HTML_CacheWrite(file, &position, header.pairs, pairs, sizeof(attrpair_t) * header.pair_total);
+        HTML_CacheWrite(file, &position, header.atoms, atoms, sizeof(html_cacheatom_t) * header.atom_total);
+        HTML_CacheWrite(file, &position, header.strings, document->source, header.source_len);
+        HTML_CacheWrite(file, &position, position, "", 1);
+        HTML_CacheWrite(file, &position, position, writer.extra, writer.extra_len);
+
+        saved = !ferror(file);
+        saved = fclose(file) == 0 && saved;
+        saved = saved && rename(temp_path, path) == 0;
+
+        if (!saved)
+            unlink(temp_path);
+    } else if (fd >= 0) {
+        close(fd);
+        unlink(temp_path);
+    }
+
+    if (!saved)
+        Diag_Report(DIAG_CACHE, "HTML_SaveCache", "Could not write '%s'", path);
+
+    free(nodes);
+    free(attributes);
+    free(pairs);
+    free(atoms);
+    free(writer.extra);
+    free(writer.seen);
+
+    return saved;
+}
+
+//
+// HTML_CacheFits
+// -----
+// Whether count items of size bytes starting at offset
+// fit between start and end.
+//
+static bool HTML_CacheFits(uint64_t offset, uint64_t count, size_t size, uint64_t start, uint64_t end)
+{
+    if (offset < start || offset > end)
+        return false;
+
+    return count <= (end - offset) / size;
+}
+
+// Turns text offsets among pairs back into pointers.
+static bool HTML_RelocatePairs(const char* base, const html_cacheheader_t* header, const uint64_t* text,
+                                attrpair_t* pairs, int count)
+{
+    uint64_t strings_end = header->strings + header->strings_len;
+
+    for (int i = 0; i < count; i++) {
+        if (pairs[i].id >= HTML_ATTR_COUNT)
+            return false;
+
+        if (!HTML_IsTextAttribute(text, pairs[i].id))
+            continue;
+
+        slice_t* value = &pairs[i].value.text;
+        uint64_t offset = (uintptr_t)value->ptr;
+
+        if (!HTML_CacheFits(offset, value->len, 1, header->strings, strings_end))
+            return false;
+
+        value->ptr = base + offset;
+    }
+
+    return true;
+}
+
+static bool HTML_CacheLink(const html_cacheheader_t* header, nodeid_t id)
+{
+    return id == HTML_NODE_NONE || id < header->node_count;
+}
+
+//
+// HTML_CheckNode
+// -----
+// Whether node id of a cache file is one we could have
+// written. Its links have to follow document order (parent
+// before it, children and next sibling after), so walking
+// them can never go around in circles.
+//
+static bool HTML_CheckNode(const html_cacheheader_t* header, const html_node_t* nodes, nodeid_t id)
+{
+    const html_node_t* node = &nodes[id];
+
+    if (node->tag >= HTML_ELEM_COUNT && node->tag != HTML_ELEM_ERROR)
+        return false;
+
+    if (!HTML_CacheLink(header, node->parent) || !HTML_CacheLink(header, node->first_child) ||
+        !HTML_CacheLink(header, node->last_child) || !HTML_CacheLink(header, node->next_sibling))
+        return false;
+
+    if (id == HTML_NODE_ROOT) {
+        if (node->type != HTML_NODE_DOCUMENT || node->parent != HTML_NODE_NONE || 
+            node->next_sibling != HTML_NODE_NONE)
+            return false;
+    } else {
+        if (node->type != HTML_NODE_ELEMENT && node->type != HTML_NODE_TEXT)
+            return false;
+
+        if (node->parent >= id || nodes[node->parent].type == HTML_NODE_TEXT)
+            return false;
+
+        if (node->next_sibling != HTML_NODE_NONE && node->next_sibling <= id)
+            return false;
+    }
+
+    if (node->first_child == HTML_NODE_NONE)
+        return node->last_child == HTML_NODE_NONE;
+
+    return node->type != HTML_NODE_TEXT && node->first_child > id && 
+           node->last_child != HTML_NODE_NONE && node->last_child >= node->first_child;
+}
+
+//
+// HTML_CheckCache
+// -----
+// Looks a mapped cache file over, without writing to it,
+// so nothing read out of it later can point outside of it.
+// Anything out of place means the file can't be used.
+// Attribute contents get checked when they're first used,
+// see HTML_CachedAttributes.
+//
+static bool HTML_CheckCache(const char* base, size_t size, uint64_t hash, size_t length)
+{
+    const html_cacheheader_t* header = (const html_cacheheader_t*)base;
+
+    if (memcmp(header->magic, HTML_CACHE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != HTML_CACHE_VERSION ||
+        header->byte_order != HTML_CACHE_BYTE_ORDER ||
+        header->pointer_size != sizeof(void*) ||
+        header->node_size != sizeof(html_node_t) ||
+        header->attribute_size != sizeof(attribute_t) ||
+        header->attribute_count != HTML_ATTR_COUNT ||
+        header->element_count != HTML_ELEM_COUNT)
+        return false;
+
+    if (header->hash != hash || header->length != length)
+        return false;
+
+    if (header->node_count == 0 || header->current >= header->node_count)
+        return false;
+
+    if (!HTML_CacheFits(header->nodes, header->node_count, sizeof(html_node_t), 0, size) ||
+        !HTML_CacheFits(header->attributes, header->attribute_total, sizeof(attribute_t), 0, size) ||
+        !HTML_CacheFits(header->pairs, header->pair_total, sizeof(attrpair_t), 0, size) ||
+        !HTML_CacheFits(header->atoms, header->atom_total, sizeof(html_cacheatom_t), 0, size) ||
+        !HTML_CacheFits(header->strings, header->strings_len, 1, 0, size))
+        return false;
+
+    if (header->nodes % HTML_CACHE_ALIGN != 0 || header->attributes % HTML_CACHE_ALIGN != 0 ||
+        header->pairs % HTML_CACHE_ALIGN != 0 || header->atoms % HTML_CACHE_ALIGN != 0)
+        return false;
+
+    // The source and the whole section end in a NUL.
+    const char* strings = base + header->strings;
+    if (header->strings_len <= header->source_len || strings[header->source_len] != '\0' ||
+        strings[header->strings_len - 1] != '\0')
+        return false;
+
+    uint64_t strings_end = header->strings + header->strings_len;
+    uint64_t attributes_end = header->attributes + sizeof(attribute_t) * header->attribute_total;
+    const html_node_t* nodes = (const html_node_t*)(base + header->nodes);
+
+    for (nodeid_t i = 0; i < header->node_count; i++) {
+        const html_node_t* node = &nodes[i];
+
+        if (!HTML_CheckNode(header, nodes, i))
+            return false;
+
+        if (node->type == HTML_NODE_TEXT) {
+            if (!HTML_CacheFits((uintptr_t)node->text, node->text_len, 1, header->strings, strings_end))
+                return false;
+        } else if (node->type == HTML_NODE_ELEMENT && node->attributes != NULL) {
+            uint64_t offset = (uintptr_t)node->attributes;
+
+            if ((offset - header->attributes) % sizeof(attribute_t) != 0 ||
+                !HTML_CacheFits(offset, 1, sizeof(attribute_t), header->attributes, attributes_end))
+                return false;
+        }
+    }
+
+    return nodes[header->current].type != HTML_NODE_TEXT;
+}
+
+//
+// HTML_CachedAttributes
+// -----
+// Makes a copy of the attributes at offset in the parse
+// cache file the document was loaded from, with pointers
+// in place of offsets, the first time they're asked for.
+// Returns NULL if they don't make sense.
+//
+attribute_t* HTML_CachedAttributes(html_document_t* document, uint64_t offset)
+{
+    const char* base = document->mapping;
+    const html_cacheheader_t* header = (const html_cacheheader_t*)base;
+    uint64_t index = (offset - header->attributes) / sizeof(attribute_t);
+
+    if (document->cached_attributes == NULL)
+        document->cached_attributes = calloc(header->attribute_total, sizeof(attribute_t*));
+
+    if (document->cached_attributes[index] != NULL)
+        return document->cached_attributes[index];
+
+    attribute_t* attr = Arena_Alloc(document->arena, sizeof(attribute_t));
+    *attr = *(const attribute_t*)(base + offset);
+
+    uint64_t overflow = (uintptr_t)attr->overflow;
+    uint64_t pairs_end = header->pairs + sizeof(attrpair_t) * header->pair_total;
+    bool valid;
+
+    uint64_t text[(HTML_ATTR_COUNT + 63) / 64];
+    HTML_FindTextAttributes(text);
+
+    if (overflow == 0) {
+        valid = attr->count <= ATTR_INLINE_LEN;
+    } else {
+        valid = (overflow - header->pairs) % sizeof(attrpair_t) == 0 && attr->count <= attr->capacity &&
+                HTML_CacheFits(overflow, attr->capacity, sizeof(attrpair_t), header->pairs, pairs_end);
+
+        if (valid) {
+            attr->overflow = Arena_Alloc(document->arena, sizeof(attrpair_t) * (attr->count + 1));
+            attr->capacity = attr->count;
+            memcpy(attr->overflow, base + overflow, sizeof(attrpair_t) * attr->count);
+        }
+    }
+
+    if (!valid || !HTML_RelocatePairs(base, header, text, HTML_AttributePairs(attr), attr->count)) {
+        Diag_Report(DIAG_CACHE, "HTML_CachedAttributes", "Attributes at %llu in the parse cache are damaged",
+                    (unsigned long long)offset);
+        return NULL;
+    }
+
+    document->cached_attributes[index] = attr;
+    return attr;
+}
+
+//
+// HTML_DetachCache
+// -----
+// Moves a document loaded from the parse cache out into
+// memory of its own, before it gets changed. Text stays in
+// the mapping, but the nodes get their pointers, and the
+// table of interned strings is filled back in so new
+// values can share with the old ones.
+//
+void HTML_DetachCache(html_document_t* document)
+{
+    if (!HTML_NodesMapped(document))
+        return;
+
+    const char* base = document->mapping;
+    const html_cacheheader_t* header = (const html_cacheheader_t*)base;
+    html_node_t* nodes = malloc(sizeof(html_node_t) * document->node_count);
+
+    for (nodeid_t i = 0; i < document->node_count; i++) {
+        nodes[i] = document->nodes[i];
+
+        if (nodes[i].type == HTML_NODE_TEXT)
+            nodes[i].text = HTML_NodeText(document, i);
+        else
+            nodes[i].attributes = HTML_NodeAttributes(document, i);
+    }
+
+    document->nodes = nodes;
+    document->node_capacity = document->node_count;
+
+    free(document->cached_attributes);
+    document->cached_attributes = NULL;
+
+    const html_cacheatom_t* atoms = (const html_cacheatom_t*)(base + header->atoms);
+    uint64_t strings_end = header->strings + header->strings_len;
+
+    for (uint64_t i = 0; i < header->atom_total; i++) {
+        if (HTML_CacheFits(atoms[i].offset, atoms[i].len, 1, header->strings, strings_end))
+            Intern_Keep(document->strings, base + atoms[i].offset, atoms[i].len);
+    }
+}
+
+//
+// HTML_LoadCache
+// -----
+// Fills an empty document from the parse cache, if it has
+// an entry for the hash and length. The document's nodes
+// and text then live in the mapped file until it's freed,
+// or its nodes until it's edited (see HTML_DetachCache).
+//
+bool HTML_LoadCache(html_document_t* document, const char* cache_dir, uint64_t hash, size_t length)
+{
+    char path[PATH_MAX];
+    HTML_CachePath(path, sizeof(path), cache_dir, hash);
+
+    double start = HTML_CLOCK();
+
+    // Not being cached yet is the usual case, not an error.
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(html_cacheheader_t)) {
+        Diag_Report(DIAG_CACHE, "HTML_LoadCache", "Ignoring unusable cache entry '%s'", path);
+        close(fd);
+        return false;
+    }
+
+    // Nothing gets written to it, so its pages stay shared
+    // with the page cache.
+    size_t size = info.st_size;
+    char* base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (base == MAP_FAILED)
+        return false;
+
+    if (!HTML_CheckCache(base, size, hash, length)) {
+        Diag_Report(DIAG_CACHE, "HTML_LoadCache", "Ignoring unusable cache entry '%s'", path);
+        munmap(base, size);
+        return false;
+    }
+
+    html_cacheheader_t* header = (html_cacheheader_t*)base;
+
+    free(document->nodes);
+    document->nodes = (html_node_t*)(base + header->nodes);
+    document->node_count = header->node_count;
+    document->node_capacity = header->node_count;
+    document->node_gap = header->node_count;
+    document->node_gap_len = 0;
+    document->offset_shift = 0;
+    document->current = header->current;
+    document->source = header->has_source ? base + header->strings : NULL;
+    document->source_len = header->source_len;
+    document->source_capacity = 0;
+    document->source_gap = 0;
+    document->source_gap_len = 0;
+    document->mapping = base;
+    document->mapping_size = size;
+
+    HTML_COUNT(document, load_seconds, HTML_CLOCK() - start);
+
+    return true;
+}
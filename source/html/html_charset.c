@@ -0,0 +1,549 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include <util.h>
+#include <diag.h>
+#include <scan.h>
+#include <html/html_attributeparser.h>
+#include <html/html_charset.h>
+
+//
+// The input stage, between retrieving a document and
+// parsing it. The parser only knows UTF-8, so this works out
+// what the document is really in -- from a byte order mark,
+// then a <meta> near the top -- and transcodes it if needed.
+// Documents that don't say are taken as UTF-8 if they are
+// valid UTF-8, and as Windows-1252 (which is what browsers
+// guess) if not. Labels for ISO-8859-1 and ASCII are read
+// as Windows-1252 as well, like browsers do, since pages
+// using them tend to have its extra characters anyway.
+//
+// Most documents are UTF-8 already, often pure ASCII, so
+// the vector scanner goes through them looking for bytes
+// with the top bit set and only those get looked at. If it
+// all checks out the document is used right where it is.
+//
+
+static const scan_set_t scan_tag_open = SCAN_SET('<');
+static const scan_set_t scan_tag_close = SCAN_SET('>');
+
+const unsigned short html_windows1252[32] = {
+    0x20AC, 0, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0, 0x017D, 0,
+    0, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0, 0x017E, 0x0178,
+};
+
+// A character as UTF-8.
+typedef struct {
+    char                    bytes[3];
+    byte                    len;
+} html_utf8char_t;
+
+// Bytes 0x80 - 0xFF of Windows-1252 as UTF-8. Built the
+// first time it's needed, and only read after that.
+static html_utf8char_t html_windows1252_utf8[128];
+static pthread_once_t html_windows1252_once = PTHREAD_ONCE_INIT;
+
+static void HTML_BuildWindows1252Table(void)
+{
+    for (int i = 0; i < 128; i++) {
+        // The gaps are C1 controls, same as in ISO-8859-1.
+        uint32_t codepoint = 0x80 + i;
+        if (i < 32 && html_windows1252[i] != 0)
+            codepoint = html_windows1252[i];
+
+        html_windows1252_utf8[i].len = Util_EncodeUTF8(codepoint, html_windows1252_utf8[i].bytes);
+    }
+}
+
+static bool HTML_IsPrescanSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+//
+// HTML_PrescanAttribute
+// -----
+// Reads the next attribute of a tag being prescanned and
+// leaves pos after it. Returns false once the tag is over.
+//
+static bool HTML_PrescanAttribute(const char* data, size_t length, size_t* pos,
+                                    slice_t* name, slice_t* value)
+{
+    size_t i = *pos;
+
+    while (i < length && (HTML_IsPrescanSpace(data[i]) || data[i] == '/'))
+        i++;
+
+    if (i >= length || data[i] == '>') {
+        *pos = i;
+        return false;
+    }
+
+    // A stray '=' makes a name of its own.
+    size_t start = i++;
+    while (i < length && !HTML_IsPrescanSpace(data[i]) && data[i] != '=' && 
+            data[i] != '/' && data[i] != '>')
+        i++;
+
+    *name = Util_Slice(&data[start], i - start);
+    *value = Util_Slice("", 0);
+
+    while (i < length && HTML_IsPrescanSpace(data[i]))
+        i++;
+
+    if (i >= length || data[i] != '=') {
+        *pos = i;
+        return true;
+    }
+
+    for (i++; i < length && HTML_IsPrescanSpace(data[i]); i++)
+        ;
+
+    if (i < length && (data[i] == '"' || data[i] == '\'')) {
+        char quote = data[i++];
+
+        for (start = i; i < length && data[i] != quote; i++)
+            ;
+
+        *value = Util_Slice(&data[start], i - start);
+
+        if (i < length)
+            i++;
+    } else {
+        for (start = i; i < length && !HTML_IsPrescanSpace(data[i]) && data[i] != '>'; i++)
+            ;
+
+        *value = Util_Slice(&data[start], i - start);
+    }
+
+    *pos = i;
+    return true;
+}
+
+//
+// HTML_CharsetFromContent
+// -----
+// Picks the charset out of a content type given in a
+// <meta http-equiv> ("text/html; charset=windows-1252").
+// Returns an empty slice if there isn't one.
+//
+static slice_t HTML_CharsetFromContent(slice_t content)
+{
+    const char* text = content.ptr;
+    size_t len = content.len;
+
+    for (size_t i = 0; i + 7 <= len; i++) {
+        if (!Util_FoldEquals(&text[i], 7, "charset", 7))
+            continue;
+
+        size_t j = i + 7;
+        while (j < len && HTML_IsPrescanSpace(text[j]))
+            j++;
+
+        if (j >= len || text[j] != '=')
+            continue;
+
+        for (j++; j < len && HTML_IsPrescanSpace(text[j]); j++)
+            ;
+
+        if (j < len && (text[j] == '"' || text[j] == '\'')) {
+            const char* end = memchr(&text[j + 1], text[j], len - j - 1);
+
+            if (end == NULL)
+                break;
+
+            return Util_Slice(&text[j + 1], end - &text[j + 1]);
+        }
+
+        size_t start = j;
+        while (j < len && !HTML_IsPrescanSpace(text[j]) && text[j] != ';')
+            j++;
+
+        return Util_Slice(&text[start], j - start);
+    }
+
+    return Util_Slice("", 0);
+}
+
+//
+// HTML_PrescanMeta
+// -----
+// Goes through the attributes of a <meta>, with pos just
+// past its name. Returns the charset it gives, or CS_NONE.
+//
+static charsets_t HTML_PrescanMeta(const char* data, size_t length, size_t* pos)
+{
+    slice_t name, value;
+    slice_t charset = Util_Slice("", 0);
+    bool got_pragma = false;
+    bool need_pragma = false;
+
+    while (HTML_PrescanAttribute(data, length, pos, &name, &value)) {
+        if (Util_SliceEqualsNoCase(name, "http-equiv")) {
+            if (Util_SliceEqualsNoCase(value, "content-type"))
+                got_pragma = true;
+        } else if (Util_SliceEqualsNoCase(name, "content")) {
+            if (charset.len == 0) {
+                charset = HTML_CharsetFromContent(value);
+                need_pragma = true;
+            }
+        } else if (Util_SliceEqualsNoCase(name, "charset")) {
+            if (charset.len == 0) {
+                charset = value;
+                need_pragma = false;
+            }
+        }
+    }
+
+    // A content type only counts as part of an http-equiv.
+    if (charset.len == 0 || (need_pragma && !got_pragma))
+        return CS_NONE;
+
+    charsets_t result = HTML_LookupCharset(charset);
+
+    if (result == CS_NONE) {
+        Diag_Report(DIAG_CHARSET, "HTML_PrescanCharset", "Unknown charset %.*s, ignoring it",
+                    SLICE_ARGS(charset));
+    }
+
+    return result;
+}
+
+//
+// HTML_PrescanCharset
+// -----
+// Looks through the start of a document for a <meta> that
+// gives its charset, skipping over comments and the
+// attributes of other tags. Returns CS_NONE if there
+// isn't one.
+//
+charsets_t HTML_PrescanCharset(const char* data, size_t length)
+{
+    size_t i = 0;
+
+    while ((i = Scan_FindAny(data, length, i, &scan_tag_open)) < length) {
+        size_t rest = length - i;
+
+        if (rest >= 4 && memcmp(&data[i], "<!--", 4) == 0) {
+            // "<!-->" is a whole (empty) comment.
+            for (i += 2; i + 3 <= length && memcmp(&data[i], "-->", 3) != 0; i++)
+                ;
+            i += 3;
+            continue;
+        }
+
+        if (rest >= 6 && Util_FoldEquals(&data[i + 1], 4, "meta", 4) &&
+            (HTML_IsPrescanSpace(data[i + 5]) || data[i + 5] == '/')) {
+            i += 5;
+
+            charsets_t charset = HTML_PrescanMeta(data, length, &i);
+            if (charset != CS_NONE)
+                return charset;
+
+            continue;
+        }
+
+        size_t name = i + 1;
+        if (name < length && data[name] == '/')
+            name++;
+
+        // Other tags have their attributes skipped properly,
+        // so a '>' inside a quoted value doesn't end them.
+        if (name < length && ((data[name] | 0x20) >= 'a' && (data[name] | 0x20) <= 'z')) {
+            i = name;
+            while (i < length && !HTML_IsPrescanSpace(data[i]) && data[i] != '>')
+                i++;
+
+            slice_t attribute, value;
+            while (HTML_PrescanAttribute(data, length, &i, &attribute, &value))
+                ;
+
+            continue;
+        }
+
+        // "<!", "<?" and stray "</" run up to the next '>'.
+        if (i + 1 < length && (data[i + 1] == '!' || data[i + 1] == '?' || data[i + 1] == '/'))
+            i = Scan_FindAny(data, length, i, &scan_tag_close);
+        else
+            i++;
+    }
+
+    return CS_NONE;
+}
+
+//
+// HTML_SniffCharset
+// -----
+// Works out what charset a document is in from its byte
+// order mark, or failing that a <meta> in the first
+// HTML_PRESCAN_LEN bytes. bom_len is set to how many bytes
+// at the start are the mark, for skipping it. Returns
+// CS_NONE if the document doesn't say.
+//
+charsets_t HTML_SniffCharset(const char* data, size_t length, size_t* bom_len)
+{
+    const byte* bytes = (const byte*)data;
+    *bom_len = 0;
+
+    if (length >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF) {
+        *bom_len = 3;
+        return CS_UTF8;
+    }
+
+    if (length >= 2 && ((bytes[0] == 0xFE && bytes[1] == 0xFF) || (bytes[0] == 0xFF && bytes[1] == 0xFE))) {
+        Diag_Report(DIAG_CHARSET, "HTML_SniffCharset", "UTF-16 documents aren't supported");
+        return CS_NONE;
+    }
+
+    return HTML_PrescanCharset(data, length < HTML_PRESCAN_LEN ? length : HTML_PRESCAN_LEN);
+}
+
+//
+// HTML_CheckUTF8Sequence
+// -----
+// Checks the multi-byte sequence starting with the
+// non-ASCII byte at s. Returns its length if it's valid.
+// If not, returns 0 and sets bad to how many bytes the
+// broken piece is, so just those can be replaced.
+//
+static size_t HTML_CheckUTF8Sequence(const byte* s, size_t remaining, size_t* bad)
+{
+    byte lead = s[0];
+    byte low = 0x80;
+    byte high = 0xBF;
+    size_t need;
+
+    // The second byte's range rules out overlong forms,
+    // surrogates and anything past U+10FFFF.
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        need = 1;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        need = 2;
+        if (lead == 0xE0)
+            low = 0xA0;
+        else if (lead == 0xED)
+            high = 0x9F;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        need = 3;
+        if (lead == 0xF0)
+            low = 0x90;
+        else if (lead == 0xF4)
+            high = 0x8F;
+    } else {
+        *bad = 1;
+        return 0;
+    }
+
+    for (size_t k = 1; k <= need; k++) {
+        if (k >= remaining || s[k] < low || s[k] > high) {
+            *bad = k;
+            return 0;
+        }
+
+        low = 0x80;
+        high = 0xBF;
+    }
+
+    return need + 1;
+}
+
+//
+// HTML_FindInvalidUTF8
+// -----
+// Returns the position of the first byte at or after start
+// that isn't part of valid UTF-8, or length if it's all
+// valid. Runs of ASCII are skipped with the vector scanner.
+//
+size_t HTML_FindInvalidUTF8(const char* data, size_t length, size_t start)
+{
+    const byte* bytes = (const byte*)data;
+    size_t i = start;
+
+    while ((i = Scan_FindNonASCII(data, length, i)) < length) {
+        // Text in other scripts is non-ASCII for long
+        // stretches, so stay here until it isn't.
+        while (i < length && bytes[i] >= 0x80) {
+            size_t bad;
+            size_t len = HTML_CheckUTF8Sequence(&bytes[i], length - i, &bad);
+
+            if (len == 0)
+                return i;
+
+            i += len;
+        }
+    }
+
+    return length;
+}
+
+//
+// HTML_RepairUTF8
+// -----
+// Copies UTF-8 out with each broken piece replaced by
+// U+FFFD, starting from the first invalid byte at start.
+// With out set to NULL it only works out the length.
+//
+static size_t HTML_RepairUTF8(const char* data, size_t length, size_t start, char* out)
+{
+    size_t write = start;
+    size_t i = start;
+
+    if (out != NULL)
+        memcpy(out, data, start);
+
+    while (i < length) {
+        size_t bad;
+        HTML_CheckUTF8Sequence((const byte*)&data[i], length - i, &bad);
+
+        if (out != NULL)
+            memcpy(&out[write], "\xEF\xBF\xBD", 3);
+
+        write += 3;
+        i += bad;
+
+        size_t next = HTML_FindInvalidUTF8(data, length, i);
+
+        if (out != NULL)
+            memcpy(&out[write], &data[i], next - i);
+
+        write += next - i;
+        i = next;
+    }
+
+    return write;
+}
+
+//
+// HTML_TranscodeWindows1252
+// -----
+// Converts Windows-1252 to UTF-8, starting from the first
+// non-ASCII byte at start. ASCII is copied across a run at
+// a time, everything else goes through the table. With out
+// set to NULL it only works out the length.
+//
+static size_t HTML_TranscodeWindows1252(const char* data, size_t length, size_t start, char* out)
+{
+    const byte* bytes = (const byte*)data;
+    size_t write = start;
+    size_t i = start;
+
+    if (out != NULL)
+        memcpy(out, data, start);
+
+    while (i < length) {
+        for (; i < length && bytes[i] >= 0x80; i++) {
+            const html_utf8char_t* c = &html_windows1252_utf8[bytes[i] - 0x80];
+
+            if (out != NULL)
+                memcpy(&out[write], c->bytes, c->len);
+
+            write += c->len;
+        }
+
+        size_t next = Scan_FindNonASCII(data, length, i);
+
+        if (out != NULL)
+            memcpy(&out[write], &data[i], next - i);
+
+        write += next - i;
+        i = next;
+    }
+
+    return write;
+}
+
+//
+// HTML_DecodeInput
+// -----
+// Gets a document ready for the parser. data has to be
+// writable and NUL terminated, as input->data ends up
+// pointing into it unless the document needed converting.
+// Either way input->data is what should be parsed, and it
+// has to stay around as long as anything parsed from it.
+//
+void HTML_DecodeInput(html_input_t* input, char* data, size_t length)
+{
+    size_t bom_len;
+    charsets_t charset = HTML_SniffCharset(data, length, &bom_len);
+
+    input->data = data + bom_len;
+    input->length = length - bom_len;
+    input->buffer = NULL;
+
+    data = input->data;
+    length = input->length;
+
+    size_t first = Scan_FindNonASCII(data, length, 0);
+
+    if (charset == CS_NONE || charset == CS_UTF8) {
+        size_t invalid = HTML_FindInvalidUTF8(data, length, first);
+
+        if (invalid == length) {
+            input->charset = CS_UTF8;
+            return;
+        }
+
+        if (charset == CS_UTF8) {
+            Diag_Report(DIAG_CHARSET, "HTML_DecodeInput", "Invalid UTF-8 at byte %zu, replacing it",
+                        invalid + bom_len);
+
+            size_t repaired = HTML_RepairUTF8(data, length, invalid, NULL);
+            input->buffer = malloc(repaired + 1);
+            HTML_RepairUTF8(data, length, invalid, input->buffer);
+
+            input->buffer[repaired] = '\0';
+            input->data = input->buffer;
+            input->length = repaired;
+            input->charset = CS_UTF8;
+            return;
+        }
+
+        Diag_Report(DIAG_CHARSET, "HTML_DecodeInput", "No charset given and not UTF-8, "
+                    "reading as Windows-1252");
+        charset = CS_ANSI;
+    }
+
+    input->charset = charset;
+
+    // Plain ASCII reads the same either way.
+    if (first == length)
+        return;
+
+    pthread_once(&html_windows1252_once, HTML_BuildWindows1252Table);
+
+    size_t transcoded = HTML_TranscodeWindows1252(data, length, first, NULL);
+    input->buffer = malloc(transcoded + 1);
+    HTML_TranscodeWindows1252(data, length, first, input->buffer);
+
+    input->buffer[transcoded] = '\0';
+    input->data = input->buffer;
+    input->length = transcoded;
+}
+
+void HTML_FreeInput(html_input_t* input)
+{
+    free(input->buffer);
+    input->buffer = NULL;
+}
@@ -0,0 +1,315 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <util.h>
+#include <arena.h>
+#include <scan.h>
+#include <html/html_entities.h>
+#include <html/html_charset.h>
+
+//
+// Character references (&amp;, &#x2014; and so on) are
+// decoded as text and attribute values are kept, rather
+// than in a pass of their own. Most text has none, and the
+// vector scanner gets through it looking for a '&' without
+// anything being copied. Text that does have some gets
+// decoded in place in its own copy in the arena: the
+// decoded form is never longer than the reference, save
+// for a couple of named ones that get a bigger buffer.
+//
+// Named references are matched against a trie generated
+// from tools/keys/entities.txt by tools/gen_entity_trie.py,
+// taking the longest name that matches, as HTML does for
+// the legacy ones that can go without a ';'.
+//
+#include <html/html_entities_trie.h>
+
+#if HTML_ENTITY_LONGEST > HTML_REFERENCE_LONGEST
+#error "HTML_REFERENCE_LONGEST is shorter than the longest reference name"
+#endif
+
+static const scan_set_t scan_reference = SCAN_SET('&');
+
+// Most bytes a single reference decodes to.
+#define HTML_DECODED_MAX    8
+
+//
+// HTML_FindReference
+// -----
+// Returns the position of the first '&' in text, or len
+// if there isn't one.
+//
+size_t HTML_FindReference(const char* text, size_t len)
+{
+    return Scan_FindAny(text, len, 0, &scan_reference);
+}
+
+//
+// HTML_FindEntityChild
+// -----
+// Binary searches a trie node's children for the one
+// starting with c.
+//
+static const html_entitynode_t* HTML_FindEntityChild(const html_entitynode_t* node, char c)
+{
+    const html_entitynode_t* children = &html_entity_nodes[node->first_child];
+    int low = 0;
+    int high = node->child_count;
+
+    while (low < high) {
+        int middle = (low + high) / 2;
+
+        if (children[middle].c == c)
+            return &children[middle];
+
+        if (children[middle].c < c)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return NULL;
+}
+
+//
+// HTML_MatchNamedReference
+// -----
+// Finds the longest reference name starting at pos. Returns
+// where it ends, or 0 if nothing matched, and sets value to
+// its entry in html_entity_values.
+//
+static size_t HTML_MatchNamedReference(const char* text, size_t len, size_t pos, 
+                                        const char** value)
+{
+    const html_entitynode_t* node = html_entity_nodes;
+    size_t matched = 0;
+
+    while (pos < len) {
+        const html_entitynode_t* child = HTML_FindEntityChild(node, text[pos]);
+
+        if (child == NULL)
+            break;
+
+        // Nothing along a tail can end a name, so it either
+        // matches in full or we're done.
+        const char* tail = &html_entity_tails[child->tail];
+        size_t tail_len = (byte)tail[0];
+
+        if (tail_len > len - pos - 1 || memcmp(&text[pos + 1], &tail[1], tail_len) != 0)
+            break;
+
+        pos += 1 + tail_len;
+        node = child;
+
+        if (node->value != 0) {
+            *value = &html_entity_values[node->value];
+            matched = pos;
+        }
+    }
+
+    return matched;
+}
+
+//
+// HTML_MatchNumericReference
+// -----
+// Reads the number of a "&#..." reference, with pos just
+// past the '#'. Returns where it ends, or 0 if there are
+// no digits, and sets codepoint to what it stands for.
+//
+static size_t HTML_MatchNumericReference(const char* text, size_t len, size_t pos,
+                                            uint32_t* codepoint)
+{
+    int base = 10;
+
+    if (pos < len && (text[pos] == 'x' || text[pos] == 'X')) {
+        base = 16;
+        pos++;
+    }
+
+    size_t digits = pos;
+    uint32_t number = 0;
+
+    for (; pos < len; pos++) {
+        char c = text[pos];
+        int digit;
+
+        if (c >= '0' && c <= '9')
+            digit = c - '0';
+        else if (base == 16 && c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+        else if (base == 16 && c >= 'A' && c <= 'F')
+            digit = c - 'A' + 10;
+        else
+            break;
+
+        // Anything past the last code point is as bad as
+        // any other, so stop counting before overflowing.
+        if (number <= 0x10FFFF)
+            number = number * base + digit;
+    }
+
+    if (pos == digits)
+        return 0;
+
+    if (pos < len && text[pos] == ';')
+        pos++;
+
+    if (number == 0 || number > 0x10FFFF || (number >= 0xD800 && number <= 0xDFFF))
+        number = 0xFFFD;
+    // Pages that use these almost always meant them as
+    // Windows-1252.
+    else if (number >= 0x80 && number <= 0x9F && html_windows1252[number - 0x80] != 0)
+        number = html_windows1252[number - 0x80];
+
+    *codepoint = number;
+
+    return pos;
+}
+
+//
+// HTML_MatchReference
+// -----
+// Decodes the reference at the '&' at pos into decoded.
+// Returns where it ends, or 0 if it isn't one. Legacy
+// names without a ';' are left alone in attribute values
+// when a letter, digit or '=' follows, so query strings
+// like "?a=1&copy=2" survive.
+//
+static size_t HTML_MatchReference(const char* text, size_t len, size_t pos, bool attribute,
+                                    char* decoded, size_t* decoded_len)
+{
+    pos++;
+
+    if (pos < len && text[pos] == '#') {
+        uint32_t codepoint;
+        size_t end = HTML_MatchNumericReference(text, len, pos + 1, &codepoint);
+
+        if (end != 0)
+            *decoded_len = Util_EncodeUTF8(codepoint, decoded);
+
+        return end;
+    }
+
+    const char* value;
+    size_t end = HTML_MatchNamedReference(text, len, pos, &value);
+
+    if (end == 0)
+        return 0;
+
+    if (attribute && text[end - 1] != ';' && end < len) {
+        char next = text[end];
+
+        if (next == '=' || (next >= '0' && next <= '9') || 
+            ((next | 0x20) >= 'a' && (next | 0x20) <= 'z'))
+            return 0;
+    }
+
+    *decoded_len = (byte)value[0];
+    memcpy(decoded, &value[1], *decoded_len);
+
+    return end;
+}
+
+//
+// HTML_DecodeReferences
+// -----
+// Decodes the references in text from the '&' at from
+// on. text has to be writable with room for a terminator
+// after len, as it's decoded in place, and the result is
+// NUL terminated. Returns the decoded text, which is only
+// somewhere other than text when a reference came out
+// longer than it went in.
+//
+slice_t HTML_DecodeReferences(arena_t* arena, char* text, size_t len, size_t from,
+                                bool attribute)
+{
+    char* out = text;
+    size_t read = from;
+    size_t write = from;
+
+    while (read < len) {
+        // Move the text up to the next reference down over
+        // the room earlier ones freed up.
+        size_t amp = Scan_FindAny(text, len, read, &scan_reference);
+
+        if (out != text || write != read)
+            memmove(&out[write], &text[read], amp - read);
+
+        write += amp - read;
+        read = amp;
+
+        if (read == len)
+            break;
+
+        char decoded[HTML_DECODED_MAX];
+        size_t decoded_len;
+        size_t end = HTML_MatchReference(text, len, read, attribute, decoded, &decoded_len);
+
+        // Just a '&'.
+        if (end == 0) {
+            out[write++] = text[read++];
+            continue;
+        }
+
+        // This one would write over text we haven't read
+        // yet. Nothing decodes to more than twice its size,
+        // so finish into a buffer with that much room.
+        if (out == text && write + decoded_len > end) {
+            out = Arena_Alloc(arena, write + (len - read) * 2 + 1);
+            memcpy(out, text, write);
+        }
+
+        memcpy(&out[write], decoded, decoded_len);
+        write += decoded_len;
+        read = end;
+    }
+
+    out[write] = '\0';
+
+    return Util_Slice(out, write);
+}
+
+//
+// HTML_DecodeText
+// -----
+// Returns text with its references decoded. Text without
+// any is handed back as-is, or as a copy in the arena if
+// copy is set. Text with some always ends up in the arena,
+// since the source has to stay as it was for re-parsing
+// and the parse cache.
+//
+slice_t HTML_DecodeText(arena_t* arena, const char* text, size_t len, bool copy, bool attribute)
+{
+    size_t amp = HTML_FindReference(text, len);
+
+    if (amp == len) {
+        if (copy && len > 0)
+            text = Arena_StringFromChunk(arena, text, len);
+
+        return Util_Slice(text, len);
+    }
+
+    char* owned = Arena_StringFromChunk(arena, text, len);
+
+    return HTML_DecodeReferences(arena, owned, len, amp, attribute);
+}
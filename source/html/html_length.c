@@ -0,0 +1,108 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <util.h>
+#include <arena.h>
+#include <html/html_attributeparser.h>
+
+//
+// Resolving relative lengths into pixels. Layout asks for
+// the same few widths over and over (every cell of a table
+// column, say), each against the same context, so the
+// answers are kept in a small direct mapped cache in the
+// document: one hash and one compare on a repeat.
+//
+
+// value * base / (per * LENGTH_ONE), all fixed point.
+static int32_t HTML_ScaleLength(int32_t value, int32_t base, int32_t per)
+{
+    int64_t scaled = (int64_t)value * base / ((int64_t)per * LENGTH_ONE);
+
+    if (scaled > INT32_MAX)
+        return INT32_MAX;
+    if (scaled < INT32_MIN)
+        return INT32_MIN;
+
+    return scaled;
+}
+
+static int32_t HTML_ComputeLength(length_t length, const lengthcontext_t* context)
+{
+    int32_t vmin = context->viewport_width < context->viewport_height ?
+                    context->viewport_width : context->viewport_height;
+    int32_t vmax = context->viewport_width > context->viewport_height ?
+                    context->viewport_width : context->viewport_height;
+
+    switch (length.type) {
+        case LEN_PERCENT:   return HTML_ScaleLength(length.value, context->containing, 100);
+        case LEN_EM:        return HTML_ScaleLength(length.value, context->font_size, 1);
+        // Without font metrics, call an x or a 0 half an em.
+        case LEN_EX:
+        case LEN_CH:        return HTML_ScaleLength(length.value, context->font_size, 2);
+        case LEN_REM:       return HTML_ScaleLength(length.value, context->root_font_size, 1);
+        case LEN_VW:        return HTML_ScaleLength(length.value, context->viewport_width, 100);
+        case LEN_VH:        return HTML_ScaleLength(length.value, context->viewport_height, 100);
+        case LEN_VMIN:      return HTML_ScaleLength(length.value, vmin, 100);
+        case LEN_VMAX:      return HTML_ScaleLength(length.value, vmax, 100);
+        default:            return 0;
+    }
+}
+
+//
+// HTML_ResolveLength
+// -----
+// Returns a length in fixed point pixels. Pixels come back
+// as they are, and "*" lengths as 0, since they only get
+// whatever is left once everything else is laid out.
+//
+int32_t HTML_ResolveLength(html_document_t* document, length_t length,
+                            const lengthcontext_t* context)
+{
+    if (length.type == LEN_PIXEL)
+        return length.value;
+    if (length.type == LEN_RELATIVE)
+        return 0;
+
+    if (document->lengths == NULL) {
+        document->lengths = Arena_Alloc(document->arena,
+                                sizeof(html_resolvedlength_t) * HTML_LENGTH_CACHE_LEN);
+        memset(document->lengths, 0, sizeof(html_resolvedlength_t) * HTML_LENGTH_CACHE_LEN);
+    }
+
+    uint32_t key = (uint32_t)length.value * 0x9E3779B1 ^ length.type;
+    uint32_t context_key = (uint32_t)context->containing ^ (uint32_t)context->font_size * 31 ^
+                            (uint32_t)context->root_font_size * 961 ^
+                            (uint32_t)context->viewport_width * 29791 ^
+                            (uint32_t)context->viewport_height * 923521;
+
+    html_resolvedlength_t* entry =
+        &document->lengths[Util_HashSlot(key, context_key, HTML_LENGTH_CACHE_LEN - 1)];
+
+    if (entry->used && entry->length.value == length.value && entry->length.type == length.type &&
+        memcmp(&entry->context, context, sizeof(lengthcontext_t)) == 0)
+        return entry->resolved;
+
+    entry->length = length;
+    entry->context = *context;
+    entry->resolved = HTML_ComputeLength(length, context);
+    entry->used = true;
+
+    return entry->resolved;
+}
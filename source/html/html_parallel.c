@@ -0,0 +1,283 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+#include <pthread.h>
+
+#include <arena.h>
+#include <intern.h>
+#include <html/html_parser.h>
+#include <html/html_attributeparser.h>
+
+//
+// Parallel parsing of one large document. The cleaned
+// document is cut into chunks at spots that look like the
+// start of a tag, and every chunk is tokenized on its own
+// thread as if it began in plain text. That guess is then
+// checked in order: if the chunk before ran past the cut
+// (the '<' was really inside a comment or an attribute
+// value), the chunk is tokenized again from where the
+// previous one actually stopped. The tokens are fed to the
+// tree builder in order, so the result is the same as
+// HTML_BeginParse.
+//
+
+typedef struct {
+    char*                   html_data;
+    size_t                  length;
+    size_t                  start;          // Where this chunk's tokens begin.
+    size_t                  end;            // Where the next chunk's begin.
+    size_t                  resume;         // Where tokenizing actually stopped.
+    arena_t*                arena;          // Attributes parsed for this chunk.
+    html_token_t*           tokens;
+    size_t                  token_count;
+    size_t                  token_capacity;
+    html_stats_t            stats;          // Counted while tokenizing the chunk.
+    pthread_t               thread;
+    bool                    threaded;       // Whether thread needs joining.
+} html_chunk_t;
+
+//
+// Tokens going to the tree are held back one at a time,
+// so a run of text that was cut between two chunks can be
+// glued back together first.
+//
+typedef struct {
+    html_document_t*        document;
+    html_token_t            pending;
+    bool                    has_pending;
+} html_stitcher_t;
+
+//
+// HTML_FindChunkStart
+// -----
+// Returns the first position at or after pos that looks
+// like the start of a tag, or length if there isn't one.
+//
+static size_t HTML_FindChunkStart(char* html_data, size_t length, size_t pos)
+{
+    for (; pos + 1 < length; pos++) {
+        if (html_data[pos] == '<' &&
+            (isalpha((byte)html_data[pos + 1]) || html_data[pos + 1] == '/'))
+            return pos;
+    }
+
+    return length;
+}
+
+static void HTML_EmitToChunk(void* context, const html_token_t* token)
+{
+    html_chunk_t* chunk = context;
+
+    if (chunk->token_count == chunk->token_capacity) {
+        chunk->token_capacity = chunk->token_capacity ? chunk->token_capacity * 2 : 1024;
+        chunk->tokens = realloc(chunk->tokens, sizeof(html_token_t) * chunk->token_capacity);
+    }
+
+    html_token_t* copy = &chunk->tokens[chunk->token_count++];
+    *copy = *token;
+
+    // Attributes are handed over on the tokenizer's stack,
+    // and these tokens have to outlive it.
+    if (token->type == HTML_TOKEN_START && token->attributes != NULL) {
+        copy->attributes = Arena_Alloc(chunk->arena, sizeof(attribute_t));
+        *copy->attributes = *token->attributes;
+    }
+}
+
+static void* HTML_TokenizeChunk(void* arg)
+{
+    html_chunk_t* chunk = arg;
+
+    // Attribute parsing wants a document to allocate out
+    // of, so give it one backed by the chunk's arena.
+    html_document_t* scratch = HTML_CreateDocumentInArena(chunk->arena);
+
+    chunk->resume = HTML_TokenizeMarkup(scratch, chunk->html_data, chunk->length,
+                                        chunk->start, chunk->end, HTML_EmitToChunk, chunk);
+
+    chunk->stats = scratch->stats;
+    HTML_FreeDocument(scratch);
+
+    return NULL;
+}
+
+//
+// HTML_ReinternAttributes
+// -----
+// Each chunk interns values into its own scratch table, so
+// they only share pointers within that chunk. Move them
+// over to the document's table so that holds across the
+// whole page, like it does for a serial parse.
+//
+static void HTML_ReinternAttributes(html_document_t* document, const uint64_t* atoms,
+                                    attribute_t* attributes)
+{
+    attrpair_t* pairs = HTML_AttributePairs(attributes);
+
+    for (int i = 0; i < attributes->count; i++) {
+        byte id = pairs[i].id;
+
+        if (atoms[id / 64] & ((uint64_t)1 << (id % 64))) {
+            slice_t text = pairs[i].value.text;
+            pairs[i].value.text = Intern_String(document->strings, text.ptr, text.len);
+        }
+    }
+}
+
+static void HTML_StitchToken(void* context, const html_token_t* token)
+{
+    html_stitcher_t* stitcher = context;
+
+    if (token->type == HTML_TOKEN_TEXT) {
+        // Picks up right where the pending text left off.
+        if (stitcher->has_pending && 
+            stitcher->pending.text + stitcher->pending.text_len == token->text) {
+            stitcher->pending.text_len += token->text_len;
+            return;
+        }
+    }
+
+    if (stitcher->has_pending) {
+        HTML_AppendToken(stitcher->document, &stitcher->pending);
+        stitcher->has_pending = false;
+    }
+
+    if (token->type == HTML_TOKEN_TEXT) {
+        stitcher->pending = *token;
+        stitcher->has_pending = true;
+    } else {
+        HTML_AppendToken(stitcher->document, token);
+    }
+}
+
+//
+// HTML_BeginParseParallel
+// -----
+// Like HTML_BeginParse, but tokenizes using up to threads
+// threads. Documents too small to be worth splitting are
+// just parsed normally.
+//
+html_document_t* HTML_BeginParseParallel(char* html_data, size_t length, int threads)
+{
+    if (!HTML_CheckDocumentLength(length))
+        return NULL;
+
+    double start_time = HTML_CLOCK();
+    html_cleaner_t cleaner = {0};
+    length = HTML_CleanDocument(html_data, length, &cleaner);
+
+    html_document_t* document = HTML_CreateDocument();
+    document->source = html_data;
+    document->source_len = length;
+
+    double cleaned = HTML_CLOCK();
+    HTML_COUNT(document, clean_seconds, cleaned - start_time);
+
+    if (threads > HTML_PARALLEL_MAX_THREADS)
+        threads = HTML_PARALLEL_MAX_THREADS;
+    if (threads > length / HTML_PARALLEL_MIN_CHUNK)
+        threads = length / HTML_PARALLEL_MIN_CHUNK;
+
+    if (threads <= 1) {
+        HTML_ParseMarkup(document, html_data, length);
+        HTML_COUNT(document, parse_seconds, HTML_CLOCK() - cleaned);
+        return document;
+    }
+
+    // Cut the document up into roughly even pieces.
+    html_chunk_t* chunks = calloc(threads, sizeof(html_chunk_t));
+    int count = 0;
+    size_t start = 0;
+
+    while (count < threads && start < length) {
+        size_t end = (count == threads - 1) ? length :
+            HTML_FindChunkStart(html_data, length, (length / threads) * (count + 1));
+
+        if (end <= start)
+            end = HTML_FindChunkStart(html_data, length, start + 1);
+
+        chunks[count].html_data = html_data;
+        chunks[count].length = length;
+        chunks[count].start = start;
+        chunks[count].end = end;
+        chunks[count].arena = Arena_Create(ARENA_BLOCK_LEN);
+        count++;
+
+        start = end;
+    }
+
+    // The first chunk is done here while the rest run.
+    // If a thread can't be started, do its chunk here.
+    for (int i = 1; i < count; i++) {
+        chunks[i].threaded = 
+            pthread_create(&chunks[i].thread, NULL, HTML_TokenizeChunk, &chunks[i]) == 0;
+
+        if (!chunks[i].threaded)
+            HTML_TokenizeChunk(&chunks[i]);
+    }
+    HTML_TokenizeChunk(&chunks[0]);
+
+    html_stitcher_t stitcher = { document, {0}, false };
+    size_t resume = 0;
+
+    uint64_t atoms[(HTML_ATTR_COUNT + 63) / 64];
+    HTML_FindAtomAttributes(atoms);
+
+    for (int i = 0; i < count; i++) {
+        html_chunk_t* chunk = &chunks[i];
+
+        if (chunk->threaded)
+            pthread_join(chunk->thread, NULL);
+
+        if (resume > chunk->start) {
+            // The previous chunk ran into this one, so it
+            // started somewhere other than plain text. Redo
+            // it from where the tokens really pick up.
+            resume = HTML_TokenizeMarkup(document, html_data, length, resume,
+                                            chunk->end, HTML_StitchToken, &stitcher);
+            Arena_Destroy(chunk->arena);
+        } else {
+            for (size_t t = 0; t < chunk->token_count; t++) {
+                html_token_t* token = &chunk->tokens[t];
+
+                if (token->type == HTML_TOKEN_START && token->attributes != NULL)
+                    HTML_ReinternAttributes(document, atoms, token->attributes);
+
+                HTML_StitchToken(&stitcher, token);
+            }
+
+            resume = chunk->resume;
+            Arena_Adopt(document->arena, chunk->arena);
+            HTML_AddStats(&document->stats, &chunk->stats);
+        }
+
+        free(chunk->tokens);
+    }
+
+    if (stitcher.has_pending)
+        HTML_AppendToken(document, &stitcher.pending);
+
+    free(chunks);
+
+    HTML_COUNT(document, parse_seconds, HTML_CLOCK() - cleaned);
+
+    return document;
+}
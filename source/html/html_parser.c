@@ -21,289 +21,872 @@
 #include <ctype.h>
 
 #include <util.h>
+#include <diag.h>
+#include <arena.h>
+#include <scan.h>
 #include <html/html_parser.h>
 #include <html/html_attributeparser.h>
 #include <html/html_datatype.h>
 
-extern byte HTML_GetIDFromTagString(char* tag_name);
+static const scan_set_t scan_tag_open = SCAN_SET('<');
+static const scan_set_t scan_tag_close = SCAN_SET('>');
+static const scan_set_t scan_double_quote = SCAN_SET('"');
+static const scan_set_t scan_single_quote = SCAN_SET('\'');
 
-extern void HTML_InitializeAttribute(attribute_t* attr);
+//
+// Tokenizing is one state machine. Each byte is sorted into
+// a class, and the class and the current state look up the
+// next state in html_transitions. Work only gets done when
+// the state changes: a name or value that was being read is
+// finished off, or the markup ends and becomes a token.
+// States that can only be left by one particular byte (text,
+// quoted values, comments) are skipped through with a vector
+// scan rather than a byte at a time.
+//
 
-/*
- * TODO
- * - Add support for the "type" attribute.
- * - Make the DOM Tree.
- */
+// Byte classes.
+#define HTML_CLASS_OTHER        0
+#define HTML_CLASS_ALPHA        1
+#define HTML_CLASS_SPACE        2
+#define HTML_CLASS_SLASH        3
+#define HTML_CLASS_GT           4
+#define HTML_CLASS_EQUALS       5
+#define HTML_CLASS_DQUOTE       6
+#define HTML_CLASS_SQUOTE       7
+#define HTML_CLASS_BANG         8
+#define HTML_CLASS_QUESTION     9
+#define HTML_CLASSES            10
+
+static const byte html_byte_classes[256] = {
+    ['A' ... 'Z']   = HTML_CLASS_ALPHA,
+    ['a' ... 'z']   = HTML_CLASS_ALPHA,
+    [' ']           = HTML_CLASS_SPACE,
+    ['\t']          = HTML_CLASS_SPACE,
+    ['\n']          = HTML_CLASS_SPACE,
+    ['\r']          = HTML_CLASS_SPACE,
+    ['\f']          = HTML_CLASS_SPACE,
+    ['/']           = HTML_CLASS_SLASH,
+    ['>']           = HTML_CLASS_GT,
+    ['=']           = HTML_CLASS_EQUALS,
+    ['"']           = HTML_CLASS_DQUOTE,
+    ['\'']          = HTML_CLASS_SQUOTE,
+    ['!']           = HTML_CLASS_BANG,
+    ['?']           = HTML_CLASS_QUESTION,
+};
+
+// Tokenizer states.
+#define HTML_STATE_DATA                 0
+#define HTML_STATE_TAG_OPEN             1   // Just past a '<'.
+#define HTML_STATE_END_TAG_OPEN         2   // Just past a "</".
+#define HTML_STATE_TAG_NAME             3
+#define HTML_STATE_BEFORE_ATTR_NAME     4
+#define HTML_STATE_ATTR_NAME            5
+#define HTML_STATE_AFTER_ATTR_NAME      6
+#define HTML_STATE_BEFORE_ATTR_VALUE    7
+#define HTML_STATE_ATTR_VALUE_DOUBLE    8
+#define HTML_STATE_ATTR_VALUE_SINGLE    9
+#define HTML_STATE_ATTR_VALUE_UNQUOTED  10
+#define HTML_STATE_MARKUP_DECLARATION   11  // Just past a "<!".
+#define HTML_STATE_COMMENT              12
+#define HTML_STATE_DOCTYPE              13  // Or anything else that's skipped to a '>'.
+#define HTML_STATES                     14
+
+#define DA  HTML_STATE_DATA
+#define TO  HTML_STATE_TAG_OPEN
+#define ET  HTML_STATE_END_TAG_OPEN
+#define TN  HTML_STATE_TAG_NAME
+#define BN  HTML_STATE_BEFORE_ATTR_NAME
+#define AN  HTML_STATE_ATTR_NAME
+#define AA  HTML_STATE_AFTER_ATTR_NAME
+#define BV  HTML_STATE_BEFORE_ATTR_VALUE
+#define VD  HTML_STATE_ATTR_VALUE_DOUBLE
+#define VS  HTML_STATE_ATTR_VALUE_SINGLE
+#define VU  HTML_STATE_ATTR_VALUE_UNQUOTED
+#define MD  HTML_STATE_MARKUP_DECLARATION
+#define CM  HTML_STATE_COMMENT
+#define DT  HTML_STATE_DOCTYPE
+
+// Next state for every state and byte class. A '<' that
+// isn't followed by something that can start markup is
+// just text. Comments only end at a '>' with "--" before
+// it, which is checked on the way out.
+static const byte html_transitions[HTML_STATES][HTML_CLASSES] = {
+    //        other alpha space slash '>'  '='  '"'  '''  '!'  '?'
+    [DA] = {  DA,   DA,   DA,   DA,   DA,  DA,  DA,  DA,  DA,  DA  },
+    [TO] = {  DA,   TN,   DA,   ET,   DA,  DA,  DA,  DA,  MD,  DT  },
+    [ET] = {  DT,   TN,   DT,   DT,   DA,  DT,  DT,  DT,  DT,  DT  },
+    [TN] = {  TN,   TN,   BN,   BN,   DA,  TN,  TN,  TN,  TN,  TN  },
+    [BN] = {  AN,   AN,   BN,   BN,   DA,  AN,  AN,  AN,  AN,  AN  },
+    [AN] = {  AN,   AN,   AA,   BN,   DA,  BV,  AN,  AN,  AN,  AN  },
+    [AA] = {  AN,   AN,   AA,   BN,   DA,  BV,  AN,  AN,  AN,  AN  },
+    [BV] = {  VU,   VU,   BV,   VU,   DA,  VU,  VD,  VS,  VU,  VU  },
+    [VD] = {  VD,   VD,   VD,   VD,   VD,  VD,  BN,  VD,  VD,  VD  },
+    [VS] = {  VS,   VS,   VS,   VS,   VS,  VS,  VS,  BN,  VS,  VS  },
+    [VU] = {  VU,   VU,   BN,   VU,   DA,  VU,  VU,  VU,  VU,  VU  },
+    [MD] = {  DT,   DT,   DT,   DT,   DA,  DT,  DT,  DT,  DT,  DT  },
+    [CM] = {  CM,   CM,   CM,   CM,   DA,  CM,  CM,  CM,  CM,  CM  },
+    [DT] = {  DT,   DT,   DT,   DT,   DA,  DT,  DT,  DT,  DT,  DT  },
+};
+
+// What ends the states that are skipped through.
+static const scan_set_t* const html_state_skips[HTML_STATES] = {
+    [VD] = &scan_double_quote,
+    [VS] = &scan_single_quote,
+    [CM] = &scan_tag_close,
+    [DT] = &scan_tag_close,
+};
+
+#undef DA
+#undef TO
+#undef ET
+#undef TN
+#undef BN
+#undef AN
+#undef AA
+#undef BV
+#undef VD
+#undef VS
+#undef VU
+#undef MD
+#undef CM
+#undef DT
+
+// What a piece of markup turned out to be.
+#define HTML_MARKUP_TEXT        0   // Not markup, the '<' is just text.
+#define HTML_MARKUP_SKIPPED     1   // A comment, DOCTYPE or the like.
+#define HTML_MARKUP_TAG         2   // A start or end tag.
 
-void HTML_ParseUselessLine(char* html_data, int* offset)
+//
+// HTML_MatchesTagName
+// -----
+// Case-insensitively checks if the tag name directly at
+// data matches name, and that the name isn't just the
+// prefix of a longer one (so "pre" won't match "prefix").
+//
+static bool HTML_MatchesTagName(char* data, size_t remaining, const char* name)
 {
-    // First off -- determine if this is a comment.
-    bool line_is_comment;
+    size_t name_len = strlen(name);
 
-    if (html_data[*offset] == '-' && html_data[*offset + 1] == '-')
-        line_is_comment = true;
-    else
-        line_is_comment = false;
-
-    // Just like BeginParse, iterate through the HTML
-    // document.
-    int i;
-    for (i = *offset; i < strlen(html_data); i++) {
-        // Skip to a potential tag end.
-        if (html_data[i] == '>') {
-            if (line_is_comment) {
-                // Iterate backwards to see if the >
-                // had the end-of-comment identifier.
-                if (html_data[i - 1] == '-' && html_data[i - 2] == '-')
-                    break;
-            } else {
-                // Was DOCTYPE, or something else
-                // equally stupid. We can leave.
-                break;
-            }
+    if (remaining < name_len)
+        return false;
+
+    for (size_t i = 0; i < name_len; i++) {
+        if (tolower((unsigned char)data[i]) != name[i])
+            return false;
+    }
+
+    // Reaching the end of the buffer counts as a boundary,
+    // since the rest of the tag may arrive later.
+    if (remaining == name_len)
+        return true;
+
+    // Same as where the tokenizer ends a tag name.
+    byte next = html_byte_classes[(byte)data[name_len]];
+    return (next == HTML_CLASS_GT || next == HTML_CLASS_SLASH || next == HTML_CLASS_SPACE);
+}
+
+// Elements whose content must keep its whitespace.
+static const char* const html_preformatted_tags[] = { "pre", "textarea" };
+
+// What markup does to preformatting.
+#define HTML_PREFORMAT_NONE     0
+#define HTML_PREFORMAT_OPEN     1
+#define HTML_PREFORMAT_CLOSE    2
+#define HTML_PREFORMAT_UNKNOWN  3   // Cut off before it could tell.
+
+//
+// HTML_CheckPreformattedTag
+// -----
+// Looks at the markup starting at the '<' at data, and
+// returns whether it opens or closes a block that keeps
+// its whitespace. If remaining runs out before the end of
+// a name that could be one, there's no telling yet.
+//
+static int HTML_CheckPreformattedTag(char* data, size_t remaining)
+{
+    bool closing = (remaining > 1 && data[1] == '/');
+    size_t name = closing ? 2 : 1;
+
+    for (size_t i = 0; i < sizeof(html_preformatted_tags) / sizeof(html_preformatted_tags[0]); i++) {
+        const char* tag = html_preformatted_tags[i];
+        size_t tag_len = strlen(tag);
+
+        if (remaining > name + tag_len) {
+            if (HTML_MatchesTagName(&data[name], remaining - name, tag))
+                return closing ? HTML_PREFORMAT_CLOSE : HTML_PREFORMAT_OPEN;
+            continue;
         }
+
+        // What's there doesn't reach past the name yet.
+        if (Util_FoldEquals(&data[name], remaining - name, tag, remaining - name))
+            return HTML_PREFORMAT_UNKNOWN;
     }
-    *offset = i;
+
+    return HTML_PREFORMAT_NONE;
 }
 
+//
+// HTML_TrackPreformatted
+// -----
+// Updates whether the cleaner is inside of a preformatted
+// block for the markup at data. A tag cut off by the end
+// of the piece is kept until the next one comes in.
+//
+static void HTML_TrackPreformatted(html_cleaner_t* cleaner, char* data, size_t remaining)
+{
+    switch (HTML_CheckPreformattedTag(data, remaining)) {
+        case HTML_PREFORMAT_OPEN:
+            cleaner->preformatted = true;
+            break;
+        case HTML_PREFORMAT_CLOSE:
+            cleaner->preformatted = false;
+            break;
+        case HTML_PREFORMAT_UNKNOWN:
+            memcpy(cleaner->pending, data, remaining);
+            cleaner->pending_len = remaining;
+            break;
+    }
+}
 
+//
+// Elements whose content isn't markup. <script> and <style>
+// hold raw text, kept as written, while <textarea> and
+// <title> hold text that can only have references in it.
+//
+typedef struct {
+    byte        tag;
+    const char* name;
+    bool        raw;
+} html_rawtext_t;
+
+static const html_rawtext_t html_rawtext_elements[] = {
+    { HTML_ELEM_SCRIPT,     "script",   true },
+    { HTML_ELEM_STYLE,      "style",    true },
+    { HTML_ELEM_TEXTAREA,   "textarea", false },
+    { HTML_ELEM_TITLE,      "title",    false },
+};
+
+#define HTML_RAWTEXT_COUNT  (sizeof(html_rawtext_elements) / sizeof(html_rawtext_elements[0]))
+
+static const html_rawtext_t* HTML_GetRawTextElement(byte tag)
+{
+    for (size_t i = 0; i < HTML_RAWTEXT_COUNT; i++) {
+        if (html_rawtext_elements[i].tag == tag)
+            return &html_rawtext_elements[i];
+    }
 
-void HTML_ParseAttribute(char* html_data, element_t* element, int* offset)
+    return NULL;
+}
+
+bool HTML_IsRawTextElement(byte tag)
 {
-    bool attr_seeking = true;
-
-    while(attr_seeking == true) {
-        // Allocate memory for the attribute name
-        char* attribute_name = malloc(sizeof(char)*MAX_ATTR_NAME_LEN);
-        int attr_offset = 0;
-        bool has_value = true;
-        int i;
-
-        for(i = 0; i < MAX_ATTR_NAME_LEN; i++) {
-            // '>' Indicates we've reached the end of the line.
-            if (html_data[i + *offset] == '>') {
-                attr_seeking = false;
-                has_value = false;
-                i += 1;
-                break;
-            }
-            // Whitespace
-            else if (html_data[i + *offset] == ' ' && i != 0) {
-                // Check to see if this is just a random space
-                // before attribute content
-                if (html_data[i + *offset + 1] != '=') {
-                    has_value = false;
-                    i++;
-                    break;
-                }
-                // It was, so carry on.
-                else {
-                    continue;
-                }
+    return HTML_GetRawTextElement(tag) != NULL;
+}
+
+//
+// HTML_FindRawTextTag
+// -----
+// Returns the name of the raw text element whose start tag
+// begins at data (just past the '<'), or NULL if it isn't
+// one, for callers that haven't looked the tag up.
+//
+const char* HTML_FindRawTextTag(char* data, size_t remaining)
+{
+    for (size_t i = 0; i < HTML_RAWTEXT_COUNT; i++) {
+        if (HTML_MatchesTagName(data, remaining, html_rawtext_elements[i].name))
+            return html_rawtext_elements[i].name;
+    }
+
+    return NULL;
+}
+
+//
+// HTML_FindRawTextEnd
+// -----
+// Returns the position of the '<' of the end tag that closes
+// the raw text element called name, searching from start, or
+// length if the document runs out first. Only a '<' can
+// start one, so most of the content is skipped a vector at
+// a time.
+//
+size_t HTML_FindRawTextEnd(char* html_data, size_t length, size_t start, const char* name)
+{
+    size_t i = start;
+
+    while ((i = Scan_FindAny(html_data, length, i, &scan_tag_open)) < length) {
+        if (i + 1 < length && html_data[i + 1] == '/' &&
+            HTML_MatchesTagName(&html_data[i + 2], length - i - 2, name))
+            return i;
+
+        i++;
+    }
+
+    return length;
+}
+
+//
+// HTML_CleanDocument
+// -----
+// Strips indentation following newlines and collapses runs
+// of spaces down to one, in a single pass over the buffer.
+// Content inside <pre> and <textarea> is left untouched.
+// Returns the new length of the document, and adds the
+// number of removed bytes to cleaner->bytes_saved. The
+// cleaner carries state between calls so a document can
+// be cleaned in pieces.
+//
+size_t HTML_CleanDocument(char* html_data, size_t length, html_cleaner_t* cleaner)
+{
+    // Rather than deleting characters (which shifts the whole
+    // rest of the document each time), keep a read and write
+    // position and only copy characters we want to keep.
+    size_t read = 0;
+    size_t write = 0;
+
+    // The last piece ended partway into a tag name, so see
+    // what it was now that the rest of it is here.
+    if (cleaner->pending_len > 0) {
+        char joined[HTML_CLEANER_PENDING_LEN * 2];
+        size_t take = length < HTML_CLEANER_PENDING_LEN ? length : HTML_CLEANER_PENDING_LEN;
+
+        memcpy(joined, cleaner->pending, cleaner->pending_len);
+        memcpy(&joined[cleaner->pending_len], html_data, take);
+
+        size_t joined_len = cleaner->pending_len + take;
+        cleaner->pending_len = 0;
+        HTML_TrackPreformatted(cleaner, joined, joined_len);
+    }
+
+    // Same for whitespace the last piece ended on.
+    char c = cleaner->last;
+
+    while (true) {
+        if (!cleaner->preformatted) {
+            // We found a newline, skip everything after it
+            // that is a space or a tab.
+            if (c == '\n') {
+                while (read < length && (html_data[read] == ' ' || html_data[read] == '\t'))
+                    read++;
             }
-            // checks if there are multiple tags in one line, this will just end on first occurance
-            else if (html_data[i + *offset] == ' ' && html_data[i + *offset+1] != ' ') {
-                attr_offset = '\0';
-                continue;
+            // We found a standard space (' '), skip any that
+            // immediately follow it.
+            else if (c == ' ') {
+                while (read < length && html_data[read] == ' ')
+                    read++;
             }
-            // Non-boolean attributes will end with '='.
-            else if (html_data[i + *offset] == '=') {
-                i += 2;
-                break;
-            } 
-
-            attribute_name[attr_offset] = html_data[i + *offset];
-            attribute_name[attr_offset + 1] = '\0';
-            attr_offset++;
         }
 
-        // Increment the parsing index.
-        *offset += i;
+        if (read >= length)
+            break;
 
-        // Now that we have the name we can begin parsing the content
-        HTML_ParseAttributeContent(html_data, attribute_name, has_value, 
-                                    &element->attributes, offset);
+        c = html_data[read];
 
-        // Free Buffer
-        free(attribute_name);
+        // Track whether we're entering or leaving a block
+        // that needs its whitespace preserved.
+        if (c == '<')
+            HTML_TrackPreformatted(cleaner, &html_data[read], length - read);
 
-        if (html_data[*offset] == '>') {
-            attr_seeking = false;
-            break;
-        }
+        html_data[write++] = c;
+        read++;
     }
+
+    if (write < length)
+        html_data[write] = '\0';
+
+    if (write > 0)
+        cleaner->last = html_data[write - 1];
+
+    cleaner->bytes_saved += read - write;
+
+    return write;
 }
 
 //
-// HTML_ParseStartTag
+// HTML_LexAttribute
 // -----
-// Identifies the element name in a starting tag of an
-// HTML document. Returns 0 if there are no attributes
-// and 1 if it identifies a potential attribute.
+// Adds an attribute read by the tokenizer to the tag's
+// attributes, setting them up on the first one.
 //
-element_t HTML_ParseStartTag(char* html_data, int* offset)
+static void HTML_LexAttribute(html_tokenstate_t* state, attribute_t* attributes, 
+                                bool* has_attributes, slice_t name, slice_t value)
 {
-    // Element data structure to return.
-    element_t new_element;
-    new_element.has_attributes = false;
-
-    // Allocate memory for the string that holds the
-    // tag name.
-    char* tag_name = malloc(sizeof(char)*MAX_TAG_LEN);
-
-    // Store the offset index for the tag parsing.
-    int tag_offset = 0;
-
-    // Just like BeginParse, iterate through the HTML
-    // document.
-    int i;
-    for (i = 0; i < MAX_TAG_LEN; i++) {
-        // End of tag, break off.
-        if (html_data[i + *offset] == '>')
-            break;
-        // Space -- element name is over, attributes
-        // potentially follow.
-        if (html_data[i + *offset] == ' ') {
-            new_element.has_attributes = true;
+    if (!state->parse_attributes)
+        return;
+
+    if (!*has_attributes) {
+        HTML_InitializeAttribute(attributes);
+        *has_attributes = true;
+    }
+
+    HTML_AddAttribute(state->document, attributes, name, value);
+}
+
+//
+// HTML_LexMarkup
+// -----
+// Runs the state machine over the markup that scan starts
+// at, up to its '>'. Tags are written to token, with their
+// attributes in attributes. markup_end is set to just past
+// the '>', or to 0 if the markup runs past length. What's
+// there of it is still tokenized then, as if it was closed
+// at length. With no state nothing gets tokenized, and only
+// where the markup ends is worked out. A scan that ran out
+// that way can be carried on with more data.
+//
+static int HTML_LexMarkup(html_tokenstate_t* state, char* data, size_t length, html_markupscan_t* scan,
+                            html_token_t* token, attribute_t* attributes, size_t* markup_end)
+{
+    size_t start = scan->start;
+    byte current = scan->state;
+    bool closing = false;
+    bool has_name = false;
+    bool has_attributes = false;
+    bool ran_out = false;
+    slice_t name = Util_Slice("", 0);
+    size_t mark = start;
+    size_t undecided = 0;
+    byte tag = HTML_ELEM_ERROR;
+    size_t i = scan->pos;
+
+    // Picking back up inside of something skipped through.
+    if (html_state_skips[current] != NULL)
+        i = Scan_FindAny(data, length, i, html_state_skips[current]);
+
+    for (; ; i++) {
+        byte next;
+
+        // Running out ends whatever was going on.
+        if (i >= length) {
+            ran_out = true;
+            next = HTML_STATE_DATA;
+        } else {
+            next = html_transitions[current][html_byte_classes[(byte)data[i]]];
+
+            if (next == current)
+                continue;
+
+            // Only "-->" ends a comment, keep looking.
+            if (current == HTML_STATE_COMMENT && (data[i - 1] != '-' || data[i - 2] != '-')) {
+                i = Scan_FindAny(data, length, i + 1, &scan_tag_close) - 1;
+                continue;
+            }
+        }
+
+        // Leaving a state finishes off what it was reading.
+        if (state != NULL) {
+            switch (current) {
+                case HTML_STATE_TAG_NAME:
+                    tag = HTML_GetIDFromTagChunk(&data[mark], i - mark);
+                    break;
+                case HTML_STATE_ATTR_NAME:
+                    name = Util_Slice(&data[mark], i - mark);
+                    has_name = true;
+                    break;
+                case HTML_STATE_ATTR_VALUE_DOUBLE:
+                case HTML_STATE_ATTR_VALUE_SINGLE:
+                case HTML_STATE_ATTR_VALUE_UNQUOTED:
+                    // End tags can't have attributes.
+                    if (!closing)
+                        HTML_LexAttribute(state, attributes, &has_attributes, name, 
+                                            Util_Slice(&data[mark], i - mark));
+                    has_name = false;
+                    break;
+            }
+        }
+
+        if (next == HTML_STATE_DATA)
             break;
+
+        // Entering one starts on the next thing.
+        switch (next) {
+            case HTML_STATE_TAG_NAME:
+                closing = (current == HTML_STATE_END_TAG_OPEN);
+                mark = i;
+                break;
+            case HTML_STATE_ATTR_NAME:
+                // The last attribute didn't have a value.
+                if (state != NULL && has_name && !closing)
+                    HTML_LexAttribute(state, attributes, &has_attributes, name, Util_Slice("", 0));
+                has_name = false;
+                mark = i;
+                break;
+            case HTML_STATE_ATTR_VALUE_DOUBLE:
+            case HTML_STATE_ATTR_VALUE_SINGLE:
+                mark = i + 1;
+                break;
+            case HTML_STATE_ATTR_VALUE_UNQUOTED:
+                mark = i;
+                break;
+            case HTML_STATE_MARKUP_DECLARATION:
+                // "<!--" starts a comment, anything else is
+                // skipped to the next '>'. If the data ends
+                // before that's clear, carrying on has to
+                // decide again from the '!'.
+                if (i + 2 < length && data[i + 1] == '-' && data[i + 2] == '-')
+                    next = HTML_STATE_COMMENT;
+                else
+                    next = HTML_STATE_DOCTYPE;
+
+                if (i + 2 >= length && (i + 1 >= length || data[i + 1] == '-'))
+                    undecided = i;
+                break;
         }
 
-        // Otherwise, append to tag name.
-        tag_name[tag_offset] = html_data[i + *offset];
-        tag_name[tag_offset + 1] = '\0';
-        tag_offset++;
+        current = next;
+
+        if (html_state_skips[current] != NULL)
+            i = Scan_FindAny(data, length, i + 1, html_state_skips[current]) - 1;
+    }
+
+    *markup_end = ran_out ? 0 : i + 1;
+
+    if (ran_out) {
+        scan->pos = undecided != 0 ? undecided : length;
+        scan->state = undecided != 0 ? HTML_STATE_TAG_OPEN : current;
+    }
+
+    // Without a state, all that matters is where it ended,
+    // and a '<' right at the end may yet start something.
+    if (state == NULL)
+        return (current == HTML_STATE_TAG_OPEN && !ran_out) ? HTML_MARKUP_TEXT : HTML_MARKUP_SKIPPED;
+
+    if (current == HTML_STATE_TAG_OPEN || (current == HTML_STATE_END_TAG_OPEN && ran_out))
+        return HTML_MARKUP_TEXT;
+
+    if (current == HTML_STATE_COMMENT || current == HTML_STATE_DOCTYPE) {
+        HTML_COUNT(state->document, declarations, 1);
+        return HTML_MARKUP_SKIPPED;
     }
 
-    // Create an element from the tag char*.
-    new_element.tag = HTML_GetIDFromTagString(tag_name);
+    // "</>" is dropped.
+    if (current == HTML_STATE_END_TAG_OPEN)
+        return HTML_MARKUP_SKIPPED;
+
+    if (has_name && !closing)
+        HTML_LexAttribute(state, attributes, &has_attributes, name, Util_Slice("", 0));
 
-    *offset += i + 1;
+    token->type = closing ? HTML_TOKEN_END : HTML_TOKEN_START;
+    token->tag = tag;
+    token->offset = start;
+    token->attributes = has_attributes ? attributes : NULL;
+
+    if (closing)
+        HTML_COUNT(state->document, end_tags, 1);
+    else
+        HTML_COUNT(state->document, start_tags, 1);
+    HTML_COUNT(state->document, unknown_elements, tag == HTML_ELEM_ERROR);
 
-    return new_element;
+    return HTML_MARKUP_TAG;
 }
 
-void HTML_ParseEndTag(char* html_data, int* offset)
+void HTML_BeginMarkupScan(html_markupscan_t* scan, size_t start)
 {
-    // Allocate memory for the string that holds the
-    // tag name.
-    char* tag_name = malloc(sizeof(char)*MAX_TAG_LEN);
-
-    // Store the offset index for the tag parsing.
-    int tag_offset = 0;
-
-    // Just like BeginParse, iterate through the HTML
-    // document.
-    int i;
-    for (i = 0; i < MAX_TAG_LEN; i++) {
-        // End of tag, break off.
-        if (html_data[i + *offset] == '>')
-            break;
+    scan->start = start;
+    scan->pos = start + 1;
+    scan->state = HTML_STATE_TAG_OPEN;
+}
+
+//
+// HTML_ContinueMarkupScan
+// -----
+// Looks for the end of the markup scan started at, from
+// wherever it left off. Returns the position just past its
+// end, scan->start + 1 if it's only text, or 0 if it isn't
+// over by length, in which case it can be called again once
+// there's more data. The tokenizer's own states decide, so
+// this always agrees with it.
+//
+size_t HTML_ContinueMarkupScan(char* data, size_t length, html_markupscan_t* scan)
+{
+    size_t markup_end;
+
+    if (HTML_LexMarkup(NULL, data, length, scan, NULL, NULL, &markup_end) == HTML_MARKUP_TEXT)
+        return scan->start + 1;
+
+    return markup_end;
+}
+
+//
+// HTML_FindMarkupEnd
+// -----
+// Same as above, for the markup starting at the '<' at
+// start, all of which is there to look at.
+//
+size_t HTML_FindMarkupEnd(char* data, size_t length, size_t start)
+{
+    html_markupscan_t scan;
+
+    HTML_BeginMarkupScan(&scan, start);
+    return HTML_ContinueMarkupScan(data, length, &scan);
+}
+
+static void HTML_TextToken(html_token_t* token, char* data, size_t from, size_t to)
+{
+    token->type = HTML_TOKEN_TEXT;
+    token->offset = from;
+    token->text = &data[from];
+    token->text_len = to - from;
+}
+
+//
+// HTML_LexRawText
+// -----
+// There's no markup inside of raw text elements, so after
+// one's start tag jump straight to its end tag and hand the
+// content over in one piece. Like a tag, that can run past
+// end. Returns where tokenizing picks back up.
+//
+static size_t HTML_LexRawText(html_tokenstate_t* state, byte tag, size_t body, 
+                                html_token_t* tokens, size_t* count)
+{
+    const html_rawtext_t* rawtext = HTML_GetRawTextElement(tag);
+
+    if (rawtext == NULL)
+        return body;
 
-        // Otherwise, append to tag name.
-        tag_name[tag_offset] = html_data[i + *offset];
-        tag_name[tag_offset + 1] = '\0';
-        tag_offset++;
+    char* data = state->data;
+    size_t close = HTML_FindRawTextEnd(data, state->length, body, rawtext->name);
+
+    if (close > body) {
+        html_token_t* token = &tokens[(*count)++];
+        HTML_TextToken(token, data, body, close);
+
+        if (rawtext->raw)
+            token->type = HTML_TOKEN_RAWTEXT;
     }
 
-    // Create an element from the tag char*.
-    element_t elem;
-    elem.tag = HTML_GetIDFromTagString(tag_name);
+    HTML_COUNT(state->document, raw_text_bytes, close - body);
+
+    if (close == state->length)
+        return close;
+
+    // The name was already matched, whatever else is in the
+    // end tag doesn't matter.
+    html_token_t* token = &tokens[(*count)++];
+    token->type = HTML_TOKEN_END;
+    token->tag = rawtext->tag;
+    token->offset = close;
 
-    *offset += i;
+    HTML_COUNT(state->document, end_tags, 1);
+
+    size_t markup_end = HTML_FindMarkupEnd(data, state->length, close);
+    return markup_end != 0 ? markup_end : state->length;
 }
 
-char* HTML_CleanDocument(char* html_data)
+//
+// HTML_BeginTokens
+// -----
+// Sets up state for tokenizing the markup that starts
+// between start and end in an already cleaned, NUL
+// terminated document of the given length.
+//
+void HTML_BeginTokens(html_tokenstate_t* state, html_document_t* document, char* html_data,
+                        size_t length, size_t start, size_t end)
 {
-    int i = 0;
-    bool scrubbing = true;
-
-    while(scrubbing) {
-        // We found a newline.
-        if (html_data[i] == '\n') {
-            // Iterate over to get first character
-            // of the new line.
-            i++;
-
-            // While everything after the new line is a space
-            // or a tab, re-build the document data without it.
-            while(html_data[i] == ' ' || html_data[i] == '\t') {
-                Util_CharDeleteAtIndex(html_data, i);
-            }
-        } 
-        // We found a standard space (' ')
-        else if (html_data[i] == ' ') {
-            // Increment the index by one.
-            i++;
-
-            bool multiple_spaces = true;
-            while(multiple_spaces) {
-                // Is this slot a space, too?
-                if (html_data[i] == ' ') {
-                    Util_CharDeleteAtIndex(html_data, i);
-                } 
-                // It wasn't, stop trying to scrub.
-                else {
-                    multiple_spaces = false;
-                }
-            }
-        } else {
-            // Increment the index, look at next character.
-            i++;
+    state->document = document;
+    state->data = html_data;
+    state->length = length;
+    state->start = start;
+    state->end = end;
+    state->pos = start;
+    state->text_start = start;
+    state->parse_attributes = true;
+    state->finished = false;
+}
+
+//
+// HTML_NextTokens
+// -----
+// Tokenizes into the caller's buffer, which has room for
+// capacity (at least HTML_TOKEN_MIN_BATCH) tokens, each with
+// attribute storage at the same index in attributes. Every
+// text token is a slice of the document, and a start tag's
+// attributes point into attributes, so a batch has to be
+// used up before asking for the next. Returns how many
+// tokens were written, 0 once there are none left.
+//
+size_t HTML_NextTokens(html_tokenstate_t* state, html_token_t* tokens, attribute_t* attributes,
+                        size_t capacity)
+{
+    char* data = state->data;
+    size_t count = 0;
+
+    while (count + HTML_TOKEN_MIN_BATCH <= capacity && state->pos < state->end) {
+        // Skip straight over the text to the next '<'.
+        size_t i = Scan_FindAny(data, state->end, state->pos, &scan_tag_open);
+
+        if (i >= state->end) {
+            state->pos = state->end;
+            break;
+        }
+
+        // The tag goes after the text that comes before it,
+        // if there is any.
+        bool has_text = (i > state->text_start);
+        html_token_t* tag = &tokens[count + has_text];
+        html_markupscan_t scan;
+        size_t markup_end;
+
+        HTML_BeginMarkupScan(&scan, i);
+        int kind = HTML_LexMarkup(state, data, state->length, &scan, tag, &attributes[count + has_text], 
+                                    &markup_end);
+
+        if (kind == HTML_MARKUP_TEXT) {
+            state->pos = i + 1;
+            continue;
         }
 
-        // EoF? Leave.
-        if (i >= strlen(html_data) || html_data[i] == '\0') {
-            scrubbing = false;
+        // It's markup, so the text before it is complete.
+        if (has_text)
+            HTML_TextToken(&tokens[count++], data, state->text_start, i);
+
+        size_t next = markup_end != 0 ? markup_end : state->length;
+
+        if (kind == HTML_MARKUP_TAG) {
+            count++;
+
+            if (tag->type == HTML_TOKEN_START && markup_end != 0)
+                next = HTML_LexRawText(state, tag->tag, next, tokens, &count);
         }
+
+        state->pos = next;
+        state->text_start = next;
     }
 
-    return html_data;
+    if (state->pos < state->end || state->finished || count == capacity)
+        return count;
+
+    // Whatever is left over at the end is text too.
+    if (state->text_start < state->end)
+        HTML_TextToken(&tokens[count++], data, state->text_start, state->end);
+
+    // Count what was actually looked at, including a tag
+    // that ran past end, so the pieces of a parallel parse
+    // add up to the whole.
+    HTML_COUNT(state->document, bytes, 
+                (state->text_start > state->end ? state->text_start : state->end) - state->start);
+
+    state->finished = true;
+
+    return count;
 }
 
-void HTML_BeginParse(char* html_data)
+//
+// HTML_TokenizeMarkup
+// -----
+// Tokenizes the tags that start between start and end in an
+// already cleaned, NUL terminated document of the given
+// length, handing each token to emit. A tag that starts
+// before end is followed to its '>' even if that's past
+// end. Returns the end of the last piece of markup, or
+// start if there wasn't any. That's only past end when the
+// last tag ran over it, and then it's where tokenizing the
+// rest of the document has to pick up from.
+//
+size_t HTML_TokenizeMarkup(html_document_t* document, char* html_data, size_t length,
+                            size_t start, size_t end, html_tokenemit_t emit, void* context)
 {
-    // Scrub the document of any trailing/leading whitespace.
-    html_data = HTML_CleanDocument(html_data);
-
-    // Start by iterating through the data character by
-    // character.
-    for (int i = 0; i < strlen(html_data); i++) {
-        // Document has a start-of-tag identifier.
-        if (html_data[i] == '<') {
-            // First off, is this actually a tag?
-            // Tags will not have a space following
-            // the start identifier.
-            if (html_data[i + 1] == ' ') {
-                // It's not a tag. Continue.
-                continue;
-            }
-            // Is this a '!' style tag (DOCTYPE or
-            // comment)? If so, also ignore it.
-            else if (html_data[i + 1] == '!') {
-                i += 2;
-                HTML_ParseUselessLine(html_data, &i);
-            }
-            // Next, is this the start of a tag or
-            // an end? Tag ends will follow with a
-            // forward slash (/).
-            else if (html_data[i + 1] == '/') {
-                i += 2;
-                HTML_ParseEndTag(html_data, &i);
-            }
-            // Make a (good!) assumption this is the
-            // beginning of an element.
-            else {
-                i += 1;
-
-                element_t new_element = HTML_ParseStartTag(html_data, &i);
-
-                // We identified that there is potential for there to
-                // be attributes, so try and parse them.
-                if (new_element.has_attributes == true) {
-                    HTML_InitializeAttribute(&new_element.attributes);
-                    HTML_ParseAttribute(html_data, &new_element, &i);
-                }
-            }
-        }
+    html_tokenstate_t state;
+    html_token_t tokens[HTML_TOKEN_BATCH];
+    attribute_t attributes[HTML_TOKEN_BATCH];
+    size_t count;
+
+    HTML_BeginTokens(&state, document, html_data, length, start, end);
+
+    while ((count = HTML_NextTokens(&state, tokens, attributes, HTML_TOKEN_BATCH)) > 0) {
+        for (size_t i = 0; i < count; i++)
+            emit(context, &tokens[i]);
     }
+
+    return state.text_start;
+}
+
+static void HTML_EmitToTree(void* context, const html_token_t* token)
+{
+    HTML_AppendToken(context, token);
+}
+
+//
+// HTML_ParseMarkup
+// -----
+// Walks an already cleaned chunk of the document and parses
+// every tag inside of it. The chunk must be NUL terminated
+// and must not end partway through a tag.
+//
+void HTML_ParseMarkup(html_document_t* document, char* html_data, size_t length)
+{
+    HTML_TokenizeMarkup(document, html_data, length, 0, length, HTML_EmitToTree, document);
+}
+
+//
+// HTML_ParseDocument
+// -----
+// Cleans and parses a whole document in one go.
+//
+static html_document_t* HTML_ParseDocument(html_document_t* document, char* html_data, size_t length)
+{
+    // Text nodes point straight into html_data, so it has to
+    // stay around for as long as the document does.
+
+    // Scrub the document of any trailing/leading whitespace.
+    double start = HTML_CLOCK();
+    html_cleaner_t cleaner = {0};
+    length = HTML_CleanDocument(html_data, length, &cleaner);
+
+    document->source = html_data;
+    document->source_len = length;
+
+    double cleaned = HTML_CLOCK();
+    HTML_ParseMarkup(document, html_data, length);
+
+    HTML_COUNT(document, clean_seconds, cleaned - start);
+    HTML_COUNT(document, parse_seconds, HTML_CLOCK() - cleaned);
+
+    return document;
+}
+
+//
+// HTML_CheckDocumentLength
+// -----
+// Nodes keep where they came from and how long their text
+// is in 32 bits, so longer documents are turned away rather
+// than having those wrap around.
+//
+bool HTML_CheckDocumentLength(size_t length)
+{
+    if (length <= HTML_DOCUMENT_MAX_LEN)
+        return true;
+
+    Diag_Report(DIAG_TOO_LARGE, "HTML_CheckDocumentLength", "Document is %zu bytes, "
+    "longer than the %zu the parser can take", length, (size_t)HTML_DOCUMENT_MAX_LEN);
+    return false;
+}
+
+//
+// HTML_BeginParse
+// -----
+// Parses a whole document, or returns NULL if it's too
+// long to parse.
+//
+html_document_t* HTML_BeginParse(char* html_data, size_t length)
+{
+    if (!HTML_CheckDocumentLength(length))
+        return NULL;
+
+    return HTML_ParseDocument(HTML_CreateDocument(), html_data, length);
+}
+
+//
+// HTML_BeginParseInArena
+// -----
+// Parses into a caller-provided arena. Nothing here touches
+// global state, so separate threads can each parse their
+// own documents with their own arenas.
+//
+html_document_t* HTML_BeginParseInArena(arena_t* arena, char* html_data, size_t length)
+{
+    if (!HTML_CheckDocumentLength(length))
+        return NULL;
+
+    return HTML_ParseDocument(HTML_CreateDocumentInArena(arena), html_data, length);
 }
@@ -0,0 +1,522 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arena.h>
+#include <diag.h>
+#include <scan.h>
+#include <html/html_cache.h>
+#include <html/html_parser.h>
+
+//
+// Incremental re-parsing after an edit. Every node knows
+// where its token started in the source, so the nodes
+// before the edit can be kept as they are. Tokenizing picks
+// up at a node shortly before the edit, with
+// the tree builder put back to how it was right before
+// that node was added. Past the edit, each node produced is
+// checked against the old tree: once one starts at the
+// same (shifted) spot under the same open element as an
+// old node did, everything from there on would come out
+// the same, so the old nodes are kept instead of being
+// parsed again.
+//
+// None of that should cost more than the part that gets
+// tokenized. The nodes from where re-parsing starts on sit
+// after the gap in the node array, so new nodes go in ahead
+// of them and the ones caught up with stay where they are,
+// with the shift in their offsets added on lazily (see
+// HTML_NodeOffset). The source has a gap of its own at the
+// last edit. Moving either gap costs the distance since the
+// last edit, so edits close together stay cheap.
+//
+
+static const scan_set_t scan_tag_open = SCAN_SET('<');
+
+// Element that was open when the first re-parsed node was
+// added, along with the links that got cut to drop it.
+typedef struct {
+    nodeid_t                element;
+    nodeid_t                last_child;     // Its last child before the edit.
+    nodeid_t                next;           // Next sibling of its child on the way down.
+} html_openelement_t;
+
+typedef struct {
+    html_document_t*        document;
+    nodeid_t                first;          // Where the re-parsed nodes started going.
+    nodeid_t                tail_count;     // Old nodes after the gap.
+    nodeid_t                next;           // Tail node to compare against next.
+    size_t                  edit_end;       // End of the inserted text.
+    int64_t                 shift;          // How far the source after the edit moved.
+    html_token_t            pending;        // Text held back in case it continues.
+    bool                    has_pending;
+    bool                    synced;         // Caught up with the old tree at the next tail node.
+} html_reparse_t;
+
+//
+// HTML_MoveSourceGap
+// -----
+// An edited document keeps the unused part of its source
+// buffer as a gap at the last place it was changed, so
+// edits close to each other only move the bytes between
+// them. Moves the gap to offset.
+//
+static void HTML_MoveSourceGap(html_document_t* document, size_t offset)
+{
+    char* source = document->source;
+    size_t gap = document->source_gap;
+    size_t gap_len = document->source_gap_len;
+
+    if (offset < gap)
+        memmove(&source[offset + gap_len], &source[offset], gap - offset);
+    else if (offset > gap)
+        memmove(&source[gap], &source[gap + gap_len], offset - gap);
+
+    document->source_gap = offset;
+}
+
+//
+// HTML_EditSource
+// -----
+// Applies the edit to the document's source. The first
+// edit makes the document its own copy, leaving the
+// original buffer alone since nodes still point into it.
+// The gap never closes up all the way, so there's always
+// room for a '\0' where it starts.
+//
+static void HTML_EditSource(html_document_t* document, const html_edit_t* edit)
+{
+    size_t length = document->source_len - edit->removed + edit->text_len;
+    size_t room = HTML_SOURCE_GAP_LEN + length / 8 + edit->text_len;
+
+    if (document->source_capacity == 0) {
+        size_t capacity = document->source_len + room + 1;
+        char* source = malloc(capacity);
+
+        memcpy(source, document->source, edit->offset);
+        memcpy(&source[edit->offset + room], &document->source[edit->offset], 
+                document->source_len - edit->offset);
+        source[capacity - 1] = '\0';
+
+        document->source = source;
+        document->source_capacity = capacity;
+        document->source_gap = edit->offset;
+        document->source_gap_len = room;
+    } else {
+        HTML_MoveSourceGap(document, edit->offset);
+    }
+
+    document->source_gap_len += edit->removed;
+
+    if (document->source_gap_len <= edit->text_len) {
+        size_t gap_end = document->source_gap + document->source_gap_len;
+        size_t rest = document->source_capacity - gap_end;
+
+        document->source = realloc(document->source, document->source_capacity + room);
+        memmove(&document->source[gap_end + room], &document->source[gap_end], rest);
+
+        document->source_capacity += room;
+        document->source_gap_len += room;
+    }
+
+    memcpy(&document->source[edit->offset], edit->text, edit->text_len);
+    document->source_gap += edit->text_len;
+    document->source_gap_len -= edit->text_len;
+    document->source_len = length;
+}
+
+//
+// HTML_DocumentSource
+// -----
+// Returns the document's source in one piece, ending in a
+// '\0', by moving the gap an edit leaves to the end of it.
+//
+char* HTML_DocumentSource(html_document_t* document)
+{
+    if (document->source_gap_len != 0) {
+        HTML_MoveSourceGap(document, document->source_len);
+        document->source[document->source_len] = '\0';
+    }
+
+    return document->source;
+}
+
+//
+// HTML_MarkupFits
+// -----
+// Whether all of the markup starting between pos and end,
+// along with the content of raw text elements, ends before
+// length. Tokenizing it can't tell what comes after
+// length, so this is where it'd come out differently.
+//
+static bool HTML_MarkupFits(char* data, size_t length, size_t pos, size_t end)
+{
+    size_t i = pos;
+
+    while ((i = Scan_FindAny(data, end, i, &scan_tag_open)) < end) {
+        size_t markup_end = HTML_FindMarkupEnd(data, length, i);
+
+        if (markup_end == 0)
+            return false;
+
+        const char* name = NULL;
+        if (markup_end > i + 1)
+            name = HTML_FindRawTextTag(&data[i + 1], length - i - 1);
+
+        if (name != NULL) {
+            size_t close = HTML_FindRawTextEnd(data, length, markup_end, name);
+            if (close == length)
+                return false;
+
+            markup_end = HTML_FindMarkupEnd(data, length, close);
+            if (markup_end == 0)
+                return false;
+        }
+
+        i = markup_end;
+    }
+
+    return true;
+}
+
+//
+// HTML_ReadySource
+// -----
+// Gets the source ready to tokenize from pos up to end:
+// moves the gap past it, far enough that whatever starts
+// before end is there in one piece. Returns where the gap
+// is, which the tokenizer takes for the end of the data.
+//
+static size_t HTML_ReadySource(html_document_t* document, size_t pos, size_t end)
+{
+    size_t ahead = HTML_REPARSE_WINDOW;
+
+    while (true) {
+        size_t ready = end + ahead;
+        if (ready > document->source_len)
+            ready = document->source_len;
+
+        if (document->source_gap < ready)
+            HTML_MoveSourceGap(document, ready);
+
+        size_t length = document->source_gap;
+        document->source[length] = '\0';
+
+        if (length == document->source_len || HTML_MarkupFits(document->source, length, pos, end))
+            return length;
+
+        ahead *= 2;
+    }
+}
+
+//
+// HTML_NodeAt
+// -----
+// The node at position index in document order, from
+// before or after the gap.
+//
+static nodeid_t HTML_NodeAt(html_document_t* document, uint32_t index)
+{
+    return index < document->node_gap ? index : index + document->node_gap_len;
+}
+
+//
+// HTML_FindReparseStart
+// -----
+// Returns the node to start re-parsing from, or 0 if the
+// whole document has to be parsed again. The last node that
+// starts before offset could have its token changed by the
+// edit, and that token could turn into text that joins up
+// with whitespace before it (which never got a node), so
+// go back one more to the node before it. Tokenizing can't
+// start in the middle of a raw text element, so that never
+// is its content.
+//
+static nodeid_t HTML_FindReparseStart(html_document_t* document, size_t offset)
+{
+    html_node_t* nodes = document->nodes;
+    uint32_t low = 1;
+    uint32_t high = document->node_count - document->node_gap_len;
+
+    // Searching by position in the tree, stepping over the
+    // gap to get to the node at one.
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+
+        if (HTML_NodeOffset(document, HTML_NodeAt(document, middle)) < offset)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    // low - 1 is the last node starting before offset.
+    nodeid_t start = low > 2 ? HTML_NodeAt(document, low - 2) : 0;
+
+    if (start != 0 && nodes[start].type == HTML_NODE_TEXT &&
+        HTML_IsRawTextElement(nodes[nodes[start].parent].tag))
+        start = nodes[start].parent;
+
+    return start;
+}
+
+//
+// HTML_MatchesOldTree
+// -----
+// Whether a node starting at offset under the current
+// element would be the same as one from the old tree. Only
+// old nodes under elements that were kept can match, as
+// the re-parsed ones have all been replaced.
+//
+static bool HTML_MatchesOldTree(html_reparse_t* reparse, size_t offset)
+{
+    html_document_t* document = reparse->document;
+    nodeid_t tail = document->node_gap + document->node_gap_len;
+    int64_t old = (int64_t)offset - reparse->shift;
+
+    while (reparse->next < reparse->tail_count && 
+           HTML_NodeOffset(document, tail + reparse->next) < old)
+        reparse->next++;
+
+    if (reparse->next == reparse->tail_count)
+        return false;
+
+    nodeid_t id = tail + reparse->next;
+    html_node_t* node = &document->nodes[id];
+
+    return HTML_NodeOffset(document, id) == old && node->parent < reparse->first &&
+           node->parent == document->current;
+}
+
+static void HTML_EmitReparse(void* context, const html_token_t* token)
+{
+    html_reparse_t* reparse = context;
+
+    // Tokens that come after catching up are already in
+    // the old tree.
+    if (reparse->synced)
+        return;
+
+    if (token->type == HTML_TOKEN_TEXT) {
+        // Text cut off by the end of a window.
+        if (reparse->has_pending && 
+            reparse->pending.text + reparse->pending.text_len == token->text) {
+            reparse->pending.text_len += token->text_len;
+            return;
+        }
+    }
+
+    if (token->type != HTML_TOKEN_END && token->offset >= reparse->edit_end &&
+        HTML_MatchesOldTree(reparse, token->offset)) {
+        reparse->synced = true;
+        return;
+    }
+
+    if (reparse->has_pending) {
+        HTML_AppendToken(reparse->document, &reparse->pending);
+        reparse->has_pending = false;
+    }
+
+    if (token->type == HTML_TOKEN_TEXT) {
+        reparse->pending = *token;
+        reparse->has_pending = true;
+    } else {
+        HTML_AppendToken(reparse->document, token);
+    }
+}
+
+//
+// HTML_ReparseEdit
+// -----
+// Applies an edit to a document's source and updates the
+// tree to match, giving the same tree a full parse of the
+// edited source would. Only the part of the document around
+// the edit gets tokenized again. Offsets are into the
+// cleaned source (see HTML_DocumentSource), and the inserted
+// text is used as is, without being cleaned. Returns false
+// if the document can't be edited.
+//
+bool HTML_ReparseEdit(html_document_t* document, const html_edit_t* edit)
+{
+    if (document->source == NULL) {
+        Diag_Report(DIAG_EDIT, "HTML_ReparseEdit", "Document has no source to edit");
+        return false;
+    }
+
+    if (edit->offset > document->source_len || 
+        edit->removed > document->source_len - edit->offset) {
+        Diag_Report(DIAG_EDIT, "HTML_ReparseEdit", "Edit at %zu (%zu bytes) is outside of the document",
+                edit->offset, edit->removed);
+        return false;
+    }
+
+    // The nodes are about to change, so they can't stay in
+    // a parse cache file.
+    HTML_DetachCache(document);
+
+    // Everything from the start node on is the old tail, so
+    // put the gap right in front of it.
+    nodeid_t start_node = HTML_FindReparseStart(document, edit->offset);
+    size_t pos = start_node != 0 ? HTML_NodeOffset(document, start_node) : 0;
+
+    HTML_MoveNodeGap(document, start_node != 0 ? start_node : HTML_NodeAt(document, 1));
+    HTML_EditSource(document, edit);
+
+    // The source moves around with every edit now, so new
+    // nodes can't point into it.
+    document->copy_text = true;
+
+    html_node_t* nodes = document->nodes;
+    nodeid_t first = document->node_gap;
+    nodeid_t tail = first + document->node_gap_len;
+
+    html_reparse_t reparse = {0};
+    reparse.document = document;
+    reparse.first = first;
+    reparse.tail_count = document->node_count - tail;
+    reparse.edit_end = edit->offset + edit->text_len;
+    reparse.shift = (int64_t)edit->text_len - (int64_t)edit->removed;
+
+    // Unhook the old nodes from the elements that were open
+    // at the time.
+    html_openelement_t* open = NULL;
+    size_t open_count = 0;
+    nodeid_t old_current = document->current;
+
+    if (reparse.tail_count > 0) {
+        for (nodeid_t id = nodes[tail].parent; id != HTML_NODE_NONE; id = nodes[id].parent)
+            open_count++;
+        open = malloc(sizeof(html_openelement_t) * open_count);
+
+        nodeid_t child = tail;
+        for (size_t i = 0; i < open_count; i++) {
+            nodeid_t element = nodes[child].parent;
+
+            open[i].element = element;
+            open[i].last_child = nodes[element].last_child;
+            open[i].next = HTML_NODE_NONE;
+
+            if (child == tail) {
+                // Find the sibling before it by climbing
+                // up from the node before it.
+                nodeid_t prev = first - 1;
+                while (prev != element && nodes[prev].parent != element)
+                    prev = nodes[prev].parent;
+
+                if (prev == element) {
+                    nodes[element].first_child = HTML_NODE_NONE;
+                    prev = HTML_NODE_NONE;
+                } else {
+                    nodes[prev].next_sibling = HTML_NODE_NONE;
+                }
+                nodes[element].last_child = prev;
+            } else {
+                open[i].next = nodes[child].next_sibling;
+                nodes[child].next_sibling = HTML_NODE_NONE;
+                nodes[element].last_child = child;
+            }
+
+            child = element;
+        }
+
+        document->current = nodes[tail].parent;
+    }
+
+    document->text_continues = false;
+
+    // Tokenize a window at a time until the new nodes line
+    // up with the old ones again.
+    while (!reparse.synced && pos < document->source_len) {
+        size_t end = pos + HTML_REPARSE_WINDOW;
+        if (end > document->source_len)
+            end = document->source_len;
+
+        size_t length = HTML_ReadySource(document, pos, end);
+        size_t resume = HTML_TokenizeMarkup(document, document->source, length,
+                                            pos, end, HTML_EmitReparse, &reparse);
+        pos = resume > end ? resume : end;
+    }
+
+    if (reparse.has_pending)
+        HTML_AppendToken(document, &reparse.pending);
+
+    // Running out of gap moves the tail up, and the links
+    // set aside into it along with it.
+    nodes = document->nodes;
+    nodeid_t moved = document->node_gap + document->node_gap_len - tail;
+    tail += moved;
+
+    for (size_t i = 0; i < open_count; i++) {
+        if (open[i].last_child != HTML_NODE_NONE && open[i].last_child >= first)
+            open[i].last_child += moved;
+        if (open[i].next != HTML_NODE_NONE && open[i].next >= first)
+            open[i].next += moved;
+    }
+
+    if (old_current != HTML_NODE_NONE && old_current >= first)
+        old_current += moved;
+
+    if (reparse.synced) {
+        // The old nodes that were parsed again join the gap,
+        // and the rest stay where they are.
+        nodeid_t sync = tail + reparse.next;
+
+        document->node_gap_len += reparse.next;
+        document->offset_shift += (uint32_t)reparse.shift;
+
+        // Hook the old nodes back onto the elements that
+        // were still open when they were added.
+        nodeid_t parent = nodes[sync].parent;
+        for (nodeid_t element = parent; element != HTML_NODE_NONE; element = nodes[element].parent) {
+            html_openelement_t* entry = NULL;
+            for (size_t i = 0; i < open_count && entry == NULL; i++) {
+                if (open[i].element == element)
+                    entry = &open[i];
+            }
+
+            if (entry == NULL || entry->last_child == HTML_NODE_NONE || entry->last_child < sync)
+                continue;
+
+            nodeid_t after = (element == parent) ? sync : entry->next;
+            if (after == HTML_NODE_NONE)
+                continue;
+
+            nodeid_t last = nodes[element].last_child;
+            if (last == HTML_NODE_NONE)
+                nodes[element].first_child = after;
+            else
+                nodes[last].next_sibling = after;
+
+            nodes[element].last_child = entry->last_child;
+        }
+
+        document->current = old_current;
+    } else {
+        // None of the old tree was left, so the gap runs to
+        // the end.
+        document->node_count = document->node_gap;
+        document->node_gap_len = 0;
+        document->offset_shift = 0;
+    }
+
+    free(open);
+
+    return true;
+}
@@ -0,0 +1,105 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include <diag.h>
+#include <arena.h>
+#include <html/html_attributeparser.h>
+#include <html/html_document.h>
+
+double HTML_StatsSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//
+// HTML_AddStats
+// -----
+// Adds other's counts into stats, for putting together
+// the pieces of a document that was parsed in parts.
+//
+void HTML_AddStats(html_stats_t* stats, const html_stats_t* other)
+{
+    stats->bytes += other->bytes;
+    stats->start_tags += other->start_tags;
+    stats->end_tags += other->end_tags;
+    stats->declarations += other->declarations;
+    stats->raw_text_bytes += other->raw_text_bytes;
+    stats->unknown_elements += other->unknown_elements;
+    stats->unknown_attributes += other->unknown_attributes;
+    stats->duplicate_attributes += other->duplicate_attributes;
+    stats->clean_seconds += other->clean_seconds;
+    stats->parse_seconds += other->parse_seconds;
+    stats->load_seconds += other->load_seconds;
+
+    for (int i = 0; i < HTML_ATTR_COUNT; i++)
+        stats->attributes[i] += other->attributes[i];
+}
+
+//
+// HTML_WriteStats
+// -----
+// Writes the document's counters out as JSON. Allocation
+// counts come from the arena, so they cover everything
+// else sharing it too. The diagnostics are process-wide
+// totals rather than just this document's.
+//
+void HTML_WriteStats(html_document_t* document, FILE* file)
+{
+    html_stats_t* stats = &document->stats;
+
+    fprintf(file, "{\n  \"enabled\": %s,\n", HTML_STATS ? "true" : "false");
+    fprintf(file, "  \"bytes\": %llu,\n  \"nodes\": %u,\n", 
+        (unsigned long long)stats->bytes, document->node_count - document->node_gap_len);
+    fprintf(file, "  \"start_tags\": %llu,\n  \"end_tags\": %llu,\n  \"declarations\": %llu,\n",
+        (unsigned long long)stats->start_tags, (unsigned long long)stats->end_tags,
+        (unsigned long long)stats->declarations);
+    fprintf(file, "  \"raw_text_bytes\": %llu,\n", (unsigned long long)stats->raw_text_bytes);
+    fprintf(file, "  \"unknown_elements\": %llu,\n  \"unknown_attributes\": %llu,\n"
+        "  \"duplicate_attributes\": %llu,\n", (unsigned long long)stats->unknown_elements,
+        (unsigned long long)stats->unknown_attributes, 
+        (unsigned long long)stats->duplicate_attributes);
+    fprintf(file, "  \"allocations\": %zu,\n  \"arena_bytes\": %zu,\n", 
+        document->arena->allocations, document->arena->bytes);
+
+    // Only the attributes that showed up.
+    fprintf(file, "  \"attributes\": {");
+    bool first = true;
+    for (int i = 0; i < HTML_ATTR_COUNT; i++) {
+        if (stats->attributes[i] == 0)
+            continue;
+
+        fprintf(file, "%s\n    \"%s\": %llu", first ? "" : ",", 
+            HTML_GetAttributeStringFromID(i), (unsigned long long)stats->attributes[i]);
+        first = false;
+    }
+    fprintf(file, "%s},\n", first ? "" : "\n  ");
+
+    fprintf(file, "  \"seconds\": {\"clean\": %.6f, \"parse\": %.6f, \"load\": %.6f},\n",
+        stats->clean_seconds, stats->parse_seconds, stats->load_seconds);
+
+    fprintf(file, "  \"diagnostics\": {");
+    for (int i = 0; i < DIAG_KINDS; i++) {
+        fprintf(file, "%s\"%s\": %llu", i > 0 ? ", " : "", Diag_KindName(i), 
+            (unsigned long long)Diag_Count(i));
+    }
+    fprintf(file, "}\n}\n");
+}
@@ -0,0 +1,259 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <ctype.h>
+
+#include <scan.h>
+#include <html/html_parser.h>
+#include <html/html_tokenizer.h>
+#include <html/html_entities.h>
+
+//
+// The streaming tokenizer lets a document be handed to the
+// parser in pieces of any size. Every time data is fed in,
+// we parse as much of the window as forms complete markup,
+// and keep whatever tag, attribute or comment was cut off
+// around until the rest of it shows up.
+//
+
+static const scan_set_t scan_tag_open = SCAN_SET('<');
+
+html_tokenizer_t* HTML_TokenizerCreate(void)
+{
+    html_tokenizer_t* tok = malloc(sizeof(html_tokenizer_t));
+
+    tok->window = malloc(sizeof(char)*TOKENIZER_WINDOW_LEN);
+    tok->length = 0;
+    tok->capacity = TOKENIZER_WINDOW_LEN;
+    tok->scanned = 0;
+    tok->boundary = 0;
+    tok->in_markup = false;
+    tok->raw_name = NULL;
+    tok->cleaner.preformatted = false;
+    tok->cleaner.bytes_saved = 0;
+    tok->cleaner.last = '\0';
+    tok->cleaner.pending_len = 0;
+    tok->document = HTML_CreateDocument();
+
+    // The window gets reused, so text can't point into it.
+    tok->document->copy_text = true;
+
+    return tok;
+}
+
+//
+// HTML_TokenizerFindBoundary
+// -----
+// Returns how much of the window can safely be parsed:
+// everything up to the last complete piece of markup,
+// plus any text after it if that's grown too long to keep
+// buffering. split_text is set if a run of text got cut.
+// Looking picks up where the last call stopped, so a long
+// piece of markup that comes in over many chunks is only
+// gone through once.
+//
+static size_t HTML_TokenizerFindBoundary(html_tokenizer_t* tok, bool* split_text)
+{
+    char* data = tok->window;
+    size_t length = tok->length;
+
+    *split_text = false;
+
+    while (true) {
+        // The content of raw text elements isn't markup, and
+        // it's tokenized along with the start tag, so hold on
+        // to both until the whole end tag shows up.
+        if (tok->raw_name != NULL && !tok->in_markup) {
+            size_t close = HTML_FindRawTextEnd(data, length, tok->scanned, tok->raw_name);
+
+            // Whatever is right at the end could still be the
+            // start of the end tag, so look at that again.
+            if (close == length) {
+                size_t tail = strlen(tok->raw_name) + 2;
+                if (length - tok->scanned > tail)
+                    tok->scanned = length - tail;
+                return tok->boundary;
+            }
+
+            HTML_BeginMarkupScan(&tok->markup, close);
+            tok->in_markup = true;
+        }
+
+        if (!tok->in_markup) {
+            size_t i = Scan_FindAny(data, length, tok->scanned, &scan_tag_open);
+
+            if (i >= length) {
+                tok->scanned = length;
+                break;
+            }
+
+            HTML_BeginMarkupScan(&tok->markup, i);
+            tok->in_markup = true;
+        }
+
+        size_t start = tok->markup.start;
+        size_t end = HTML_ContinueMarkupScan(data, length, &tok->markup);
+
+        // Markup was cut off, wait for more data. The text
+        // before it stays too, in case the '<' turns out to
+        // be more text.
+        if (end == 0)
+            return tok->boundary;
+
+        tok->in_markup = false;
+        tok->scanned = end;
+
+        if (tok->raw_name != NULL) {
+            // Until the whole tag was there, "</script" could
+            // still have turned out to be "</scripts".
+            if (HTML_FindRawTextEnd(data, length, start, tok->raw_name) != start) {
+                tok->scanned = start + 1;
+                continue;
+            }
+
+            tok->raw_name = NULL;
+            tok->boundary = end;
+            continue;
+        }
+
+        // Just a '<' in the text, which goes on past it.
+        if (end == start + 1)
+            continue;
+
+        // A raw text element's start tag waits for its content.
+        tok->raw_name = HTML_FindRawTextTag(&data[start + 1], length - start - 1);
+        if (tok->raw_name == NULL)
+            tok->boundary = end;
+    }
+
+    // Hold on to trailing text so it ends up in one piece,
+    // unless there's so much of it we'd rather split it.
+    // Even then keep any whitespace at the very end, since
+    // whether it gets collapsed depends on the next chunk.
+    size_t boundary = tok->boundary;
+
+    if (length - boundary <= TOKENIZER_WINDOW_LEN)
+        return boundary;
+
+    size_t i;
+    for (i = length; i > boundary; i--) {
+        char c = data[i - 1];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+            break;
+    }
+
+    // Don't cut a character reference in half either, the
+    // pieces are decoded separately.
+    for (size_t j = i; j > boundary && i - j <= HTML_REFERENCE_LONGEST + 1; j--) {
+        char c = data[j - 1];
+
+        if (c == '&') {
+            i = j - 1;
+            break;
+        }
+
+        if (c != '#' && !isalnum((byte)c))
+            break;
+    }
+
+    *split_text = (i > boundary);
+
+    return i;
+}
+
+//
+// HTML_TokenizerParseWindow
+// -----
+// Cleans and parses the first 'amount' bytes of the window,
+// then shifts the rest of it to the front.
+//
+static void HTML_TokenizerParseWindow(html_tokenizer_t* tok, size_t amount)
+{
+    if (amount == 0)
+        return;
+
+    // The parser needs the chunk NUL terminated, so hang
+    // on to the byte we're replacing.
+    char saved = tok->window[amount];
+    tok->window[amount] = '\0';
+
+    double start = HTML_CLOCK();
+    size_t cleaned = HTML_CleanDocument(tok->window, amount, &tok->cleaner);
+
+    double parse_start = HTML_CLOCK();
+    HTML_ParseMarkup(tok->document, tok->window, cleaned);
+
+    HTML_COUNT(tok->document, clean_seconds, parse_start - start);
+    HTML_COUNT(tok->document, parse_seconds, HTML_CLOCK() - parse_start);
+
+    tok->window[amount] = saved;
+
+    // Move the leftovers to the front.
+    tok->length -= amount;
+    memmove(tok->window, &tok->window[amount], tok->length);
+}
+
+void HTML_TokenizerFeed(html_tokenizer_t* tok, char* buf, size_t len)
+{
+    // Make room for the new data (plus a terminator).
+    if (tok->length + len + 1 > tok->capacity) {
+        size_t new_capacity = tok->capacity;
+        while (tok->length + len + 1 > new_capacity)
+            new_capacity *= 2;
+
+        tok->window = realloc(tok->window, sizeof(char)*new_capacity);
+        tok->capacity = new_capacity;
+    }
+
+    memcpy(&tok->window[tok->length], buf, len);
+    tok->length += len;
+    tok->window[tok->length] = '\0';
+
+    bool split_text;
+    size_t boundary = HTML_TokenizerFindBoundary(tok, &split_text);
+
+    HTML_TokenizerParseWindow(tok, boundary);
+
+    // What's left moved to the front of the window.
+    tok->scanned -= boundary;
+    tok->boundary = 0;
+    if (tok->in_markup) {
+        tok->markup.start -= boundary;
+        tok->markup.pos -= boundary;
+    }
+
+    // The rest of the text arrives with the next chunk.
+    if (split_text)
+        tok->document->text_continues = true;
+}
+
+html_document_t* HTML_TokenizerFinish(html_tokenizer_t* tok)
+{
+    // There's nothing else coming, so whatever is left
+    // has to be parsed as-is.
+    HTML_TokenizerParseWindow(tok, tok->length);
+
+    html_document_t* document = tok->document;
+
+    free(tok->window);
+    free(tok);
+
+    return document;
+}
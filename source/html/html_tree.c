@@ -0,0 +1,623 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include <util.h>
+#include <arena.h>
+#include <intern.h>
+#include <html/html_document.h>
+#include <html/html_cache.h>
+#include <html/html_entities.h>
+
+//
+// HTML_CreateDocument
+// -----
+// Sets up an empty document with just its root node.
+// Everything allocated while parsing it, including the
+// document itself, comes out of its arena. The node array
+// lives on the heap since it has to grow in place.
+//
+html_document_t* HTML_CreateDocument(void)
+{
+    html_document_t* document = HTML_CreateDocumentInArena(Arena_Create(ARENA_BLOCK_LEN));
+    document->owns_arena = true;
+
+    return document;
+}
+
+//
+// HTML_CreateDocumentInArena
+// -----
+// Same as above, but allocates out of an arena the caller
+// already has. Freeing the document leaves the arena alone,
+// so one can be reset and reused across many documents.
+//
+html_document_t* HTML_CreateDocumentInArena(arena_t* arena)
+{
+    html_document_t* document = Arena_Alloc(arena, sizeof(html_document_t));
+    document->arena = arena;
+    document->owns_arena = false;
+    document->strings = Intern_Create(arena);
+    document->nodes = malloc(sizeof(html_node_t) * HTML_NODES_LEN);
+    document->node_count = 1;
+    document->node_capacity = HTML_NODES_LEN;
+    document->node_gap = 1;
+    document->node_gap_len = 0;
+    document->offset_shift = 0;
+    document->current = HTML_NODE_ROOT;
+    document->copy_text = false;
+    document->text_continues = false;
+    document->source = NULL;
+    document->source_len = 0;
+    document->source_capacity = 0;
+    document->source_gap = 0;
+    document->source_gap_len = 0;
+    document->mapping = NULL;
+    document->mapping_size = 0;
+    document->cached_attributes = NULL;
+    memset(&document->stats, 0, sizeof(document->stats));
+    document->lengths = NULL;
+
+    html_node_t* root = &document->nodes[HTML_NODE_ROOT];
+    root->type = HTML_NODE_DOCUMENT;
+    root->tag = HTML_ELEM_ERROR;
+    root->parent = HTML_NODE_NONE;
+    root->first_child = HTML_NODE_NONE;
+    root->last_child = HTML_NODE_NONE;
+    root->next_sibling = HTML_NODE_NONE;
+    root->text_len = 0;
+    root->offset = 0;
+    root->attributes = NULL;
+
+    return document;
+}
+
+//
+// HTML_NodesMapped
+// -----
+// Whether the node array is still the one in the parse
+// cache file the document was loaded from.
+//
+bool HTML_NodesMapped(html_document_t* document)
+{
+    char* nodes = (char*)document->nodes;
+    char* mapping = document->mapping;
+
+    return mapping != NULL && nodes >= mapping && nodes < mapping + document->mapping_size;
+}
+
+void HTML_FreeDocument(html_document_t* document)
+{
+    if (!HTML_NodesMapped(document))
+        free(document->nodes);
+
+    free(document->cached_attributes);
+    Intern_Destroy(document->strings);
+
+    // Documents loaded from the parse cache point into it.
+    if (document->mapping != NULL)
+        munmap(document->mapping, document->mapping_size);
+
+    // Edited documents keep their own copy of the source.
+    if (document->source_capacity != 0)
+        free(document->source);
+
+    // The document lives in its own arena, so this takes
+    // it out along with everything else.
+    if (document->owns_arena)
+        Arena_Destroy(document->arena);
+}
+
+html_node_t* HTML_GetNode(html_document_t* document, nodeid_t id)
+{
+    if (id >= document->node_count || 
+        (id >= document->node_gap && id - document->node_gap < document->node_gap_len))
+        return NULL;
+
+    return &document->nodes[id];
+}
+
+//
+// HTML_NodeText
+// -----
+// The text of a text node, which for one still in the
+// parse cache file is at an offset into it.
+//
+const char* HTML_NodeText(html_document_t* document, nodeid_t id)
+{
+    html_node_t* node = &document->nodes[id];
+
+    if (!HTML_NodesMapped(document))
+        return node->text;
+
+    return (const char*)document->mapping + (uintptr_t)node->text;
+}
+
+//
+// HTML_NodeAttributes
+// -----
+// The attributes of an element, or NULL if it has none.
+// Ones still in the parse cache file get made into the
+// real thing the first time they're asked for.
+//
+attribute_t* HTML_NodeAttributes(html_document_t* document, nodeid_t id)
+{
+    html_node_t* node = &document->nodes[id];
+
+    if (node->type != HTML_NODE_ELEMENT || node->attributes == NULL)
+        return NULL;
+
+    if (!HTML_NodesMapped(document))
+        return node->attributes;
+
+    return HTML_CachedAttributes(document, (uintptr_t)node->attributes);
+}
+
+//
+// HTML_NodeOffset
+// -----
+// Where a node's token starts in the source. Edits only
+// shift the nodes after the gap, so rather than going over
+// all of them each time, the shift is kept aside until they
+// move in front of the gap.
+//
+uint32_t HTML_NodeOffset(html_document_t* document, nodeid_t id)
+{
+    uint32_t offset = document->nodes[id].offset;
+
+    if (id >= document->node_gap + document->node_gap_len)
+        offset += document->offset_shift;
+
+    return offset;
+}
+
+//
+// HTML_ShiftNodes
+// -----
+// Moves the nodes from first up to last by distance places
+// and fixes up the links to them. Other nodes only link
+// forward into the range from the elements above before
+// (the node ahead of it in document order), and back into
+// it from the children its elements have past last.
+//
+static void HTML_ShiftNodes(html_document_t* document, nodeid_t first, nodeid_t last, nodeid_t before,
+                            nodeid_t distance)
+{
+    html_node_t* nodes = document->nodes;
+
+    if (first == last || distance == 0)
+        return;
+
+    for (nodeid_t id = first; id < last; id++) {
+        if (nodes[id].last_child == HTML_NODE_NONE || nodes[id].last_child < last)
+            continue;
+
+        for (nodeid_t child = nodes[id].first_child; child != HTML_NODE_NONE; child = nodes[child].next_sibling) {
+            if (child >= last)
+                nodes[child].parent = id + distance;
+        }
+    }
+
+    for (nodeid_t id = before; id != HTML_NODE_NONE; id = nodes[id].parent) {
+        nodeid_t* links[] = { &nodes[id].first_child, &nodes[id].last_child, &nodes[id].next_sibling };
+        for (int l = 0; l < 3; l++) {
+            if (*links[l] >= first && *links[l] < last)
+                *links[l] += distance;
+        }
+    }
+
+    for (nodeid_t id = first; id < last; id++) {
+        nodeid_t* links[] = { &nodes[id].parent, &nodes[id].first_child, 
+                                &nodes[id].last_child, &nodes[id].next_sibling };
+        for (int l = 0; l < 4; l++) {
+            if (*links[l] >= first && *links[l] < last)
+                *links[l] += distance;
+        }
+    }
+
+    if (document->current >= first && document->current < last)
+        document->current += distance;
+
+    memmove(&nodes[first + distance], &nodes[first], sizeof(html_node_t) * (last - first));
+}
+
+//
+// HTML_MoveNodeGap
+// -----
+// Moves the gap to just before node id, or to the end for
+// node_count, so that new nodes added to the tree go in
+// there. Only the nodes between where the gap was and where
+// it goes get moved, taking the shift in their offsets
+// with them. The root always stays in front of it.
+//
+void HTML_MoveNodeGap(html_document_t* document, nodeid_t id)
+{
+    html_node_t* nodes = document->nodes;
+    nodeid_t gap = document->node_gap;
+    nodeid_t gap_end = gap + document->node_gap_len;
+
+    if (id < gap) {
+        for (nodeid_t i = id; i < gap; i++)
+            nodes[i].offset -= document->offset_shift;
+
+        HTML_ShiftNodes(document, id, gap, id - 1, document->node_gap_len);
+        document->node_gap = id;
+    } else if (id > gap_end) {
+        for (nodeid_t i = gap_end; i < id; i++)
+            nodes[i].offset += document->offset_shift;
+
+        HTML_ShiftNodes(document, gap_end, id, gap - 1, -document->node_gap_len);
+        document->node_gap = gap + (id - gap_end);
+    }
+}
+
+//
+// HTML_WidenNodeGap
+// -----
+// Makes more room in a gap that ran out, moving the nodes
+// after it up. The room grows with the document so that
+// adding many nodes in the middle costs the same per node
+// as adding them at the end.
+//
+static void HTML_WidenNodeGap(html_document_t* document)
+{
+    nodeid_t gap_end = document->node_gap + document->node_gap_len;
+    uint32_t room = document->node_count / 4;
+
+    if (room < HTML_NODES_LEN)
+        room = HTML_NODES_LEN;
+
+    HTML_ReserveNodes(document, document->node_count + room);
+    HTML_ShiftNodes(document, gap_end, document->node_count, document->node_gap - 1, room);
+
+    document->node_count += room;
+    document->node_gap_len += room;
+}
+
+//
+// HTML_CompactNodes
+// -----
+// Closes up the gap, leaving all of the nodes one after
+// another with their offsets up to date.
+//
+void HTML_CompactNodes(html_document_t* document)
+{
+    HTML_MoveNodeGap(document, document->node_count);
+
+    document->node_count = document->node_gap;
+    document->node_gap_len = 0;
+    document->offset_shift = 0;
+}
+
+//
+// HTML_IsVoidElement
+// -----
+// Elements that can never have content, and so never
+// get an end tag.
+//
+bool HTML_IsVoidElement(byte tag)
+{
+    switch(tag) {
+        case HTML_ELEM_AREA:
+        case HTML_ELEM_BASE:
+        case HTML_ELEM_BASEFONT:
+        case HTML_ELEM_BR:
+        case HTML_ELEM_COL:
+        case HTML_ELEM_FRAME:
+        case HTML_ELEM_HR:
+        case HTML_ELEM_IMG:
+        case HTML_ELEM_INPUT:
+        case HTML_ELEM_ISINDEX:
+        case HTML_ELEM_LINK:
+        case HTML_ELEM_META:
+        case HTML_ELEM_PARAM:
+        // We can't know what to expect from elements we
+        // don't recognize, so don't let them swallow
+        // everything after them.
+        case HTML_ELEM_ERROR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+//
+// HTML_ReserveNodes
+// -----
+// Grows the node array until it holds at least count
+// nodes. Ones loaded from the parse cache sit in a file
+// mapping, so the first growth moves them out of it.
+//
+void HTML_ReserveNodes(html_document_t* document, uint32_t count)
+{
+    if (count <= document->node_capacity)
+        return;
+
+    uint32_t capacity = document->node_capacity;
+    while (capacity < count)
+        capacity *= 2;
+
+    HTML_DetachCache(document);
+
+    document->nodes = realloc(document->nodes, sizeof(html_node_t) * capacity);
+    document->node_capacity = capacity;
+}
+
+//
+// HTML_AppendNode
+// -----
+// Adds a blank node as the last child of the current
+// element and returns its index. New nodes go in the gap,
+// which is at the end unless the document was edited.
+//
+static nodeid_t HTML_AppendNode(html_document_t* document, byte type)
+{
+    nodeid_t id = document->node_gap;
+
+    if (document->node_gap_len == 0) {
+        if (id == document->node_count) {
+            HTML_ReserveNodes(document, document->node_count + 1);
+            document->node_count++;
+            document->node_gap_len++;
+        } else {
+            HTML_WidenNodeGap(document);
+        }
+    }
+
+    document->node_gap++;
+    document->node_gap_len--;
+
+    nodeid_t parent = document->current;
+
+    html_node_t* node = &document->nodes[id];
+    node->type = type;
+    node->tag = HTML_ELEM_ERROR;
+    node->parent = parent;
+    node->first_child = HTML_NODE_NONE;
+    node->last_child = HTML_NODE_NONE;
+    node->next_sibling = HTML_NODE_NONE;
+    node->text_len = 0;
+    node->offset = 0;
+    node->attributes = NULL;
+
+    // Link it in after its parent's last child.
+    html_node_t* parent_node = &document->nodes[parent];
+    if (parent_node->last_child == HTML_NODE_NONE)
+        parent_node->first_child = id;
+    else
+        document->nodes[parent_node->last_child].next_sibling = id;
+    parent_node->last_child = id;
+
+    return id;
+}
+
+//
+// HTML_AppendElement
+// -----
+// Adds an element to the tree. Unless it's a void element,
+// everything that follows becomes its content until it's
+// closed. The attributes are copied into the arena.
+//
+nodeid_t HTML_AppendElement(html_document_t* document, byte tag, attribute_t* attributes)
+{
+    nodeid_t id = HTML_AppendNode(document, HTML_NODE_ELEMENT);
+    html_node_t* node = &document->nodes[id];
+
+    node->tag = tag;
+
+    if (attributes != NULL && attributes->count > 0) {
+        node->attributes = Arena_Alloc(document->arena, sizeof(attribute_t));
+        *node->attributes = *attributes;
+    }
+
+    if (!HTML_IsVoidElement(tag))
+        document->current = id;
+
+    return id;
+}
+
+//
+// HTML_CloseElement
+// -----
+// Handles an end tag by closing the nearest open element
+// with the same tag, along with anything still open inside
+// of it. End tags that don't match anything are ignored.
+//
+void HTML_CloseElement(html_document_t* document, byte tag)
+{
+    if (tag == HTML_ELEM_ERROR)
+        return;
+
+    nodeid_t id = document->current;
+
+    while (id != HTML_NODE_ROOT) {
+        html_node_t* node = &document->nodes[id];
+
+        if (node->tag == tag) {
+            document->current = node->parent;
+            return;
+        }
+
+        id = node->parent;
+    }
+}
+
+//
+// HTML_KeepsWhitespace
+// -----
+// Whether the current element is, or is inside of, one
+// where whitespace is content rather than indentation.
+//
+static bool HTML_KeepsWhitespace(html_document_t* document)
+{
+    for (nodeid_t id = document->current; id != HTML_NODE_ROOT; id = document->nodes[id].parent) {
+        byte tag = document->nodes[id].tag;
+
+        if (tag == HTML_ELEM_PRE || tag == HTML_ELEM_TEXTAREA)
+            return true;
+    }
+
+    return false;
+}
+
+//
+// HTML_AppendText
+// -----
+// Adds a run of text to the current element. Runs that are
+// nothing but whitespace (indentation between tags) are
+// dropped to keep the tree small, except where whitespace
+// is kept as written anyway. Raw text is kept as
+// written, with no references decoded. Returns the new
+// node, or HTML_NODE_NONE if there wasn't one.
+//
+nodeid_t HTML_AppendText(html_document_t* document, const char* text, size_t len, bool raw)
+{
+    // The streaming tokenizer had to split a long run of text,
+    // so glue this piece onto the end of the last one.
+    if (document->text_continues) {
+        document->text_continues = false;
+
+        nodeid_t last = document->nodes[document->current].last_child;
+        if (last != HTML_NODE_NONE && document->nodes[last].type == HTML_NODE_TEXT) {
+            html_node_t* node = &document->nodes[last];
+            char* joined = Arena_Alloc(document->arena, node->text_len + len + 1);
+
+            memcpy(joined, node->text, node->text_len);
+            memcpy(&joined[node->text_len], text, len);
+            joined[node->text_len + len] = '\0';
+
+            // The last piece was already decoded, so only
+            // decode this one.
+            slice_t decoded = Util_Slice(joined, node->text_len + len);
+            size_t amp = HTML_FindReference(text, len);
+            if (amp != len) {
+                decoded = HTML_DecodeReferences(document->arena, joined, decoded.len, 
+                                                node->text_len + amp, false);
+            }
+
+            node->text = decoded.ptr;
+            node->text_len = decoded.len;
+            return HTML_NODE_NONE;
+        }
+    }
+
+    size_t i;
+    for (i = 0; i < len; i++) {
+        if (text[i] != ' ' && text[i] != '\t' && text[i] != '\n' && text[i] != '\r')
+            break;
+    }
+
+    if (i == len && (len == 0 || !HTML_KeepsWhitespace(document)))
+        return HTML_NODE_NONE;
+
+    nodeid_t id = HTML_AppendNode(document, HTML_NODE_TEXT);
+    html_node_t* node = &document->nodes[id];
+
+    // When the source buffer won't outlive the parse (the
+    // streaming tokenizer reuses its window), keep a copy.
+    // Text with references in it gets one either way.
+    slice_t decoded = Util_Slice(text, len);
+    if (!raw)
+        decoded = HTML_DecodeText(document->arena, text, len, document->copy_text, false);
+    else if (document->copy_text)
+        decoded.ptr = Arena_StringFromChunk(document->arena, text, len);
+
+    node->text = decoded.ptr;
+    node->text_len = decoded.len;
+
+    return id;
+}
+
+//
+// HTML_AppendToken
+// -----
+// Adds whatever a token from the tokenizer describes to
+// the tree, remembering where in the source it came from.
+//
+void HTML_AppendToken(html_document_t* document, const html_token_t* token)
+{
+    nodeid_t id = HTML_NODE_NONE;
+
+    // A run of text the streaming tokenizer split only goes
+    // on if the next piece of input starts with more of it.
+    if (token->offset != 0)
+        document->text_continues = false;
+
+    switch (token->type) {
+        case HTML_TOKEN_START:
+            id = HTML_AppendElement(document, token->tag, token->attributes);
+            break;
+        case HTML_TOKEN_END:
+            HTML_CloseElement(document, token->tag);
+            break;
+        case HTML_TOKEN_TEXT:
+            id = HTML_AppendText(document, token->text, token->text_len, false);
+            break;
+        case HTML_TOKEN_RAWTEXT:
+            id = HTML_AppendText(document, token->text, token->text_len, true);
+            break;
+    }
+
+    if (id != HTML_NODE_NONE)
+        document->nodes[id].offset = token->offset;
+}
+
+//
+// HTML_DumpTree
+// -----
+// Prints the tree with one node per line, indented by
+// depth. Handy for debugging the parser.
+//
+void HTML_DumpTree(html_document_t* document)
+{
+    int depth = 0;
+    nodeid_t id = document->nodes[HTML_NODE_ROOT].first_child;
+
+    while (id != HTML_NODE_NONE) {
+        html_node_t* node = &document->nodes[id];
+
+        if (node->type == HTML_NODE_TEXT) {
+            printf("%*s\"%.*s\"\n", depth * 2, "", (int)node->text_len, HTML_NodeText(document, id));
+        } else {
+            attribute_t* attributes = HTML_NodeAttributes(document, id);
+
+            printf("%*s<%s>", depth * 2, "", HTML_GetTagStringFromID(node->tag));
+            if (attributes != NULL)
+                printf(" (%d attributes)", attributes->count);
+            printf("\n");
+        }
+
+        // Depth first: children, then siblings, then
+        // back up until we find an unvisited sibling.
+        if (node->first_child != HTML_NODE_NONE) {
+            id = node->first_child;
+            depth++;
+            continue;
+        }
+
+        while (id != HTML_NODE_NONE && document->nodes[id].next_sibling == HTML_NODE_NONE) {
+            id = document->nodes[id].parent;
+            depth--;
+        }
+
+        if (id != HTML_NODE_NONE)
+            id = document->nodes[id].next_sibling;
+    }
+}
@@ -0,0 +1,162 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <util.h>
+#include <intern.h>
+
+//
+// A string interning table. Attribute values like class
+// names and input types repeat constantly across a page,
+// so they get stored once here and every attribute with
+// that value shares the one copy.
+//
+
+static intern_entry_t* Intern_NewEntries(uint32_t capacity)
+{
+    intern_entry_t* entries = calloc(capacity, sizeof(intern_entry_t));
+
+    if (entries == NULL) {
+        printf("Intern_NewEntries: Out of memory allocating %u entries\n", capacity);
+        exit(1);
+    }
+
+    return entries;
+}
+
+intern_table_t* Intern_Create(arena_t* arena)
+{
+    intern_table_t* table = Arena_Alloc(arena, sizeof(intern_table_t));
+
+    table->arena = arena;
+    table->entries = Intern_NewEntries(INTERN_TABLE_LEN);
+    table->count = 0;
+    table->capacity = INTERN_TABLE_LEN;
+
+    return table;
+}
+
+//
+// Intern_FindSlot
+// -----
+// Linear probe for str, stopping at either its entry or
+// the empty slot it belongs in.
+//
+static intern_entry_t* Intern_FindSlot(intern_table_t* table, const char* str,
+                                        size_t len, uint32_t hash)
+{
+    uint32_t mask = table->capacity - 1;
+
+    for (uint32_t slot = hash & mask;; slot = (slot + 1) & mask) {
+        intern_entry_t* entry = &table->entries[slot];
+
+        if (entry->ptr == NULL)
+            return entry;
+
+        if (entry->hash == hash && entry->len == len && memcmp(entry->ptr, str, len) == 0)
+            return entry;
+    }
+}
+
+static void Intern_Grow(intern_table_t* table)
+{
+    intern_entry_t* old = table->entries;
+    uint32_t old_capacity = table->capacity;
+
+    table->capacity *= 2;
+    table->entries = Intern_NewEntries(table->capacity);
+
+    uint32_t mask = table->capacity - 1;
+
+    for (uint32_t i = 0; i < old_capacity; i++) {
+        if (old[i].ptr == NULL)
+            continue;
+
+        uint32_t slot = old[i].hash & mask;
+        while (table->entries[slot].ptr != NULL)
+            slot = (slot + 1) & mask;
+
+        table->entries[slot] = old[i];
+    }
+
+    free(old);
+}
+
+//
+// Intern_Insert
+// -----
+// Finds str's entry, adding it if it isn't there
+// yet. copy says whether the table keeps its own copy.
+//
+static intern_entry_t* Intern_Insert(intern_table_t* table, const char* str, size_t len,
+                                      bool copy)
+{
+    // Keep the load under 3/4 so probes stay short.
+    if ((table->count + 1) * 4 > table->capacity * 3)
+        Intern_Grow(table);
+
+    uint32_t hash = Util_HashFold(str, len);
+    intern_entry_t* entry = Intern_FindSlot(table, str, len, hash);
+
+    if (entry->ptr == NULL) {
+        entry->ptr = copy ? Arena_StringFromChunk(table->arena, str, len) : str;
+        entry->len = len;
+        entry->hash = hash;
+        table->count++;
+    }
+
+    return entry;
+}
+
+//
+// Intern_String
+// -----
+// Returns the table's copy of str, adding it first if it
+// isn't there yet. The copy lives as long as the arena.
+//
+slice_t Intern_String(intern_table_t* table, const char* str, size_t len)
+{
+    if (len == 0)
+        return Util_Slice("", 0);
+
+    intern_entry_t* entry = Intern_Insert(table, str, len, true);
+    return Util_Slice(entry->ptr, entry->len);
+}
+
+//
+// Intern_Keep
+// -----
+// Adds str as it is, without copying it, for strings that
+// are already shared elsewhere (like the ones in a mapped
+// parse cache). It has to outlive the table.
+//
+void Intern_Keep(intern_table_t* table, const char* str, size_t len)
+{
+    if (len == 0)
+        return;
+
+    Intern_Insert(table, str, len, false);
+}
+
+void Intern_Destroy(intern_table_t* table)
+{
+    // The strings belong to the arena.
+    free(table->entries);
+    table->entries = NULL;
+}
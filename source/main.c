@@ -16,15 +16,132 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
 
+#include <util.h>
+#include <diag.h>
+#include <batch.h>
 #include <html/html_parser.h>
+#include <html/html_cache.h>
+#include <html/html_charset.h>
 #include <prtcl/protocol.h>
 
+static void Main_PrintUsage(void)
+{
+    printf("Usage: pantomime [-q] [-c dir] [-p threads] [-s stats] <uri>\n"
+    "       pantomime -b [-q] [-c dir] [-j threads] [-l list] [uri ...]\n"
+    "Example: pantomime file://tests/simple_document.html\n"
+    "Batch mode (-b) parses every URI given, plus one per line\n"
+    "of the list file, or of stdin if neither is given ('-l -'\n"
+    "also reads stdin). -p splits a single large document\n"
+    "across threads. -c keeps parsed documents in dir and\n"
+    "loads them from there instead of parsing them again.\n"
+    "-q hides parser diagnostics, -s writes the parser's\n"
+    "counters to stats as JSON ('-s -' for stdout).\n");
+}
+
+//
+// Main_RunBatch
+// -----
+// Collects the URIs for batch mode from wherever they were
+// given and hands them to the worker pool.
+//
+static int Main_RunBatch(int argc, char *argv[], int first_uri, const char* list_path, int threads,
+                            const char* cache_dir)
+{
+    batch_list_t list;
+    Batch_InitList(&list);
+
+    for (int i = first_uri; i < argc; i++)
+        Batch_AddURI(&list, argv[i]);
+
+    if (list_path != NULL && strcmp(list_path, "-") != 0) {
+        FILE* file = fopen(list_path, "r");
+
+        if (file == NULL) {
+            printf("Fatal: Couldn't open URI list '%s'.\n", list_path);
+            Batch_FreeList(&list);
+            return 1;
+        }
+
+        Batch_ReadList(&list, file);
+        fclose(file);
+    } else if (list_path != NULL || list.count == 0) {
+        Batch_ReadList(&list, stdin);
+    }
+
+    int failed = Batch_Run(&list, threads, cache_dir);
+    Batch_FreeList(&list);
+
+    return failed > 0;
+}
+
+static void Main_WriteStats(html_document_t* html, const char* stats_path)
+{
+    if (strcmp(stats_path, "-") == 0) {
+        HTML_WriteStats(html, stdout);
+        return;
+    }
+
+    FILE* file = fopen(stats_path, "w");
+
+    if (file == NULL) {
+        printf("Couldn't open '%s' to write stats to.\n", stats_path);
+        return;
+    }
+
+    HTML_WriteStats(html, file);
+    fclose(file);
+}
+
 int main(int argc, char *argv[])
 {
+    bool batch = false;
+    const char* list_path = NULL;
+    const char* cache_dir = NULL;
+    const char* stats_path = NULL;
+    int threads = BATCH_DEFAULT_THREADS;
+    int parse_threads = 1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "bc:j:l:p:qs:h")) != -1) {
+        switch (opt) {
+            case 'b':
+                batch = true;
+                break;
+            case 'c':
+                cache_dir = optarg;
+                break;
+            case 'j':
+                threads = atoi(optarg);
+                break;
+            case 'l':
+                list_path = optarg;
+                batch = true;
+                break;
+            case 'p':
+                parse_threads = atoi(optarg);
+                break;
+            case 'q':
+                Diag_SetSink(NULL, NULL);
+                break;
+            case 's':
+                stats_path = optarg;
+                break;
+            default:
+                Main_PrintUsage();
+                return 0;
+        }
+    }
+
+    if (batch)
+        return Main_RunBatch(argc, argv, optind, list_path, threads, cache_dir);
+
     // If there aren't any args specified, just close and report
     // an error, change this when we have an interface.
-    if (argc < 2) {
+    if (optind >= argc) {
         printf("Fatal: Pantomime requires a file to be specified "
         "as a command line argument. \nExample: "
         "pantomime file://tests/simple_document.html\n"
@@ -32,14 +149,50 @@ int main(int argc, char *argv[])
         return 0;
     }
 
-    // Have the protocol manager send us the HTML document as
-    // a char*
-    char* html_data = NULL;
-    html_data = PRTCL_RetrieveDocument(argv[1]);
+    // Have the protocol manager send us the HTML document.
+    prtcl_document_t* document = PRTCL_RetrieveDocument(argv[optind]);
+
+    if (document != NULL) {
+        html_document_t* html = NULL;
+        html_input_t input = {0};
+        uint64_t hash = 0;
+
+        // Seen this exact document before? Skip parsing it.
+        // It's hashed before parsing, which changes it.
+        if (cache_dir != NULL) {
+            hash = Util_HashData(document->data, document->length);
+            html = HTML_CreateDocument();
+
+            if (!HTML_LoadCache(html, cache_dir, hash, document->length)) {
+                HTML_FreeDocument(html);
+                html = NULL;
+            }
+        }
+
+        // Send it off to the HTML Parser, as UTF-8.
+        if (html == NULL) {
+            HTML_DecodeInput(&input, document->data, document->length);
+
+            if (parse_threads > 1)
+                html = HTML_BeginParseParallel(input.data, input.length, parse_threads);
+            else
+                html = HTML_BeginParse(input.data, input.length);
+
+            if (html != NULL && cache_dir != NULL)
+                HTML_SaveCache(html, cache_dir, hash, document->length);
+        }
+
+        if (html != NULL) {
+            if (stats_path != NULL)
+                Main_WriteStats(html, stats_path);
+
+            HTML_FreeDocument(html);
+        } else {
+            printf("Something went wrong, could not parse the document.\n");
+        }
 
-    if (html_data != NULL) {
-        // Send it off to the HTML Parser
-        HTML_BeginParse(html_data);
+        HTML_FreeInput(&input);
+        PRTCL_ReleaseDocument(document);
     } else {
         printf("Something went wrong, could not start HTML parser.\n");
     }
@@ -16,36 +16,110 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
-char* PRTCL_RetrieveFile(char* file_path)
+#include <prtcl/protocol_file.h>
+
+//
+// PRTCL_ReadDescriptor
+// -----
+// Fallback for anything we can't map (pipes, character
+// devices, page-aligned files): read the whole thing into
+// a single heap buffer, growing it as needed.
+//
+static prtcl_document_t* PRTCL_ReadDescriptor(int fd, size_t size_hint)
 {
-    // Open the document through standard FIO
-    FILE* document;
-    document = fopen(file_path, "r");
+    size_t capacity = size_hint + 1;
+    if (capacity < PRTCL_READ_CHUNK_LEN)
+        capacity = PRTCL_READ_CHUNK_LEN;
+
+    char* buffer = malloc(sizeof(char)*capacity);
+    size_t length = 0;
+
+    while (true) {
+        // Always leave room for the terminator.
+        if (length + 1 >= capacity) {
+            capacity *= 2;
+            buffer = realloc(buffer, sizeof(char)*capacity);
+        }
+
+        ssize_t amount = read(fd, &buffer[length], capacity - length - 1);
+
+        if (amount < 0) {
+            printf("PRTCL_RetrieveFile: Failed reading document\n");
+            free(buffer);
+            return NULL;
+        }
+
+        if (amount == 0)
+            break;
+
+        length += amount;
+    }
+
+    buffer[length] = '\0';
 
-    if (document == NULL) {
+    prtcl_document_t* document = malloc(sizeof(prtcl_document_t));
+    document->data = buffer;
+    document->length = length;
+    document->mapped = false;
+    document->map_size = 0;
+
+    return document;
+}
+
+prtcl_document_t* PRTCL_RetrieveFile(char* file_path)
+{
+    int fd = open(file_path, O_RDONLY);
+
+    if (fd < 0) {
         printf("PRTCL_RetrieveFile: No such file '%s'\n", file_path);
         return NULL;
     }
 
-    // Seek to the end of the file to get its size.
-    fseek(document, 0, SEEK_END);
-    int document_size = ftell(document);
-    fseek(document, 0, SEEK_SET);
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        printf("PRTCL_RetrieveFile: Could not stat '%s'\n", file_path);
+        close(fd);
+        return NULL;
+    }
+
+    size_t size = info.st_size;
+    long page_size = sysconf(_SC_PAGESIZE);
+
+    // Map regular files straight into memory instead of
+    // copying them. The parser expects a NUL after the
+    // document, which we get for free from the zero-filled
+    // tail of the last page -- unless the file ends exactly
+    // on a page boundary, in which case just read it.
+    // The mapping is private, so the in-place whitespace
+    // pass only copies the pages it actually writes to and
+    // the file on disk is never touched.
+    if (S_ISREG(info.st_mode) && size > 0 && size % page_size != 0) {
+        char* data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
 
-    // Toss the HTML data into a char[].
-    char html_doc[document_size];
-    fread(html_doc, document_size + 1, 1, document);
+        if (data != MAP_FAILED) {
+            close(fd);
 
-    // Close file pointer.
-    fclose(document);
+            // We read the document front to back.
+            madvise(data, size, MADV_SEQUENTIAL);
 
-    // Now convert HTML data from char[] to char*.
-    char* html_data = malloc(sizeof(char)*document_size);
-    for(int i = 0; i < document_size; i++) {
-        html_data[i] = html_doc[i];
-        html_data[i + 1] = '\0';
+            prtcl_document_t* document = malloc(sizeof(prtcl_document_t));
+            document->data = data;
+            document->length = size;
+            document->mapped = true;
+            document->map_size = size;
+
+            return document;
+        }
     }
 
-    return html_data;
-}
\ No newline at end of file
+    prtcl_document_t* document = PRTCL_ReadDescriptor(fd, S_ISREG(info.st_mode) ? size : 0);
+    close(fd);
+
+    return document;
+}
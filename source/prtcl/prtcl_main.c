@@ -15,13 +15,17 @@
 //
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 
 #include <util.h>
 #include <prtcl/protocol_file.h>
 
-char* PRTCL_RetrieveDocument(char* req_uri)
+prtcl_document_t* PRTCL_RetrieveDocument(char* req_uri)
 {
+    prtcl_document_t* document;
+
     // Check the protocol identifier so we know
     // how to handle retrieving the document.
     // file://
@@ -29,13 +33,26 @@ char* PRTCL_RetrieveDocument(char* req_uri)
     req_uri[2] == 'l' && req_uri[3] == 'e' && 
     req_uri[4] == ':' && req_uri[5] == '/' &&
     req_uri[6] == '/') {
-        // Build a new string omitting the protocol
-        char* file_path = Util_BuildStringFromChunk(req_uri, 
-                                        7, strlen(req_uri));
-        return PRTCL_RetrieveFile(file_path);
+        // The path is just everything after the protocol.
+        document = PRTCL_RetrieveFile(&req_uri[7]);
     } else {
         printf("PTRCL_RetrieveDocument: Unknown protocol "
         "in provided URI '%s'\n", req_uri);
         return NULL;
     }
-}
\ No newline at end of file
+
+    return document;
+}
+
+void PRTCL_ReleaseDocument(prtcl_document_t* document)
+{
+    if (document == NULL)
+        return;
+
+    if (document->mapped)
+        munmap(document->data, document->map_size);
+    else
+        free(document->data);
+
+    free(document);
+}
@@ -0,0 +1,233 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software 
+// for any purpose with or without fee is hereby granted.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL 
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED 
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL 
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR 
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM 
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT, 
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN 
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include <types.h>
+#include <scan.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCAN_HAVE_X86
+#endif
+
+//
+// Most of a document is text between tags, so rather than
+// look at it a character at a time, delimiter searches go
+// through here and compare 16 or 32 bytes at once. The
+// widest version the CPU supports is picked the first time
+// a scan is done.
+//
+
+typedef size_t (*scan_func_t)(const char* data, size_t length, size_t start, const scan_set_t* set);
+typedef size_t (*scan_ascii_func_t)(const char* data, size_t length, size_t start);
+
+//
+// Scan_FindAnyScalar
+// -----
+// Plain C version, used for the tails of the vector
+// versions and on CPUs without them.
+//
+static size_t Scan_FindAnyScalar(const char* data, size_t length, size_t start, const scan_set_t* set)
+{
+    for (size_t i = start; i < length; i++) {
+        for (int k = 0; k < set->count; k++) {
+            if (data[i] == set->chars[k])
+                return i;
+        }
+    }
+
+    return length;
+}
+
+static size_t Scan_FindNonASCIIScalar(const char* data, size_t length, size_t start)
+{
+    for (size_t i = start; i < length; i++) {
+        if ((byte)data[i] >= 0x80)
+            return i;
+    }
+
+    return length;
+}
+
+#ifdef SCAN_HAVE_X86
+
+__attribute__((target("sse2")))
+static size_t Scan_FindAnySSE2(const char* data, size_t length, size_t start, const scan_set_t* set)
+{
+    __m128i needles[SCAN_SET_MAX];
+    for (int k = 0; k < set->count; k++)
+        needles[k] = _mm_set1_epi8(set->chars[k]);
+
+    size_t i = start;
+    for (; i + 16 <= length; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)&data[i]);
+        __m128i hits = _mm_setzero_si128();
+
+        for (int k = 0; k < set->count; k++)
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, needles[k]));
+
+        unsigned int mask = _mm_movemask_epi8(hits);
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+
+    return Scan_FindAnyScalar(data, length, i, set);
+}
+
+__attribute__((target("avx2")))
+static size_t Scan_FindAnyAVX2(const char* data, size_t length, size_t start, const scan_set_t* set)
+{
+    __m256i needles[SCAN_SET_MAX];
+    for (int k = 0; k < set->count; k++)
+        needles[k] = _mm256_set1_epi8(set->chars[k]);
+
+    size_t i = start;
+    for (; i + 32 <= length; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)&data[i]);
+        __m256i hits = _mm256_setzero_si256();
+
+        for (int k = 0; k < set->count; k++)
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, needles[k]));
+
+        unsigned int mask = _mm256_movemask_epi8(hits);
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+
+    return Scan_FindAnySSE2(data, length, i, set);
+}
+
+//
+// The same again for bytes with their top bit set, which is
+// just a movemask of the block itself.
+//
+__attribute__((target("sse2")))
+static size_t Scan_FindNonASCIISSE2(const char* data, size_t length, size_t start)
+{
+    size_t i = start;
+    for (; i + 16 <= length; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)&data[i]);
+
+        unsigned int mask = _mm_movemask_epi8(block);
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+
+    return Scan_FindNonASCIIScalar(data, length, i);
+}
+
+__attribute__((target("avx2")))
+static size_t Scan_FindNonASCIIAVX2(const char* data, size_t length, size_t start)
+{
+    size_t i = start;
+    for (; i + 32 <= length; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)&data[i]);
+
+        unsigned int mask = _mm256_movemask_epi8(block);
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+
+    return Scan_FindNonASCIISSE2(data, length, i);
+}
+
+#endif // SCAN_HAVE_X86
+
+// These are set once and then only read, so parsers on
+// different threads can share them.
+static scan_func_t scan_func = NULL;
+static scan_ascii_func_t scan_ascii_func = NULL;
+static const char* scan_name = NULL;
+static pthread_once_t scan_once = PTHREAD_ONCE_INIT;
+
+//
+// Scan_Resolve
+// -----
+// Picks the best scanner for the CPU we're running on.
+//
+static void Scan_Resolve(void)
+{
+#ifdef SCAN_HAVE_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        scan_name = "avx2";
+        scan_func = Scan_FindAnyAVX2;
+        scan_ascii_func = Scan_FindNonASCIIAVX2;
+        return;
+    }
+
+    if (__builtin_cpu_supports("sse2")) {
+        scan_name = "sse2";
+        scan_func = Scan_FindAnySSE2;
+        scan_ascii_func = Scan_FindNonASCIISSE2;
+        return;
+    }
+#endif
+
+    scan_name = "scalar";
+    scan_func = Scan_FindAnyScalar;
+    scan_ascii_func = Scan_FindNonASCIIScalar;
+}
+
+//
+// Scan_FindAny
+// -----
+// Returns the position of the first character at or after
+// start that is in set, or length if there isn't one.
+//
+size_t Scan_FindAny(const char* data, size_t length, size_t start, const scan_set_t* set)
+{
+    pthread_once(&scan_once, Scan_Resolve);
+
+    if (start >= length)
+        return length;
+
+    return scan_func(data, length, start, set);
+}
+
+//
+// Scan_FindNonASCII
+// -----
+// Returns the position of the first byte at or after start
+// that isn't ASCII, or length if there isn't one.
+//
+size_t Scan_FindNonASCII(const char* data, size_t length, size_t start)
+{
+    pthread_once(&scan_once, Scan_Resolve);
+
+    if (start >= length)
+        return length;
+
+    return scan_ascii_func(data, length, start);
+}
+
+//
+// Scan_Implementation
+// -----
+// Name of the scanner in use, for benchmarks and such.
+//
+const char* Scan_Implementation(void)
+{
+    pthread_once(&scan_once, Scan_Resolve);
+
+    return scan_name;
+}
@@ -17,10 +17,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <limits.h>
 
 #include <types.h>
-
-#define MAX_TEMP_STR_LEN    512
+#include <util.h>
 
 void Util_CharDeleteAtIndex(char* src, int index)
 {
@@ -40,16 +42,7 @@ void Util_CharDeleteAtIndex(char* src, int index)
 
 char* Util_BuildStringFromChunk(char* str, int start, int end)
 {
-    // Ensure the string isn't too big
-    if (start >= MAX_TEMP_STR_LEN || end >= MAX_TEMP_STR_LEN) {
-        printf("Util_BuildStringFromChunk: Received "
-        "a string that is above the max length. "
-        "Returning 'nil'.\n");
-
-        return "nil";
-    }
-
-    // Or that we aren't trying some weird
+    // Make sure we aren't trying some weird
     // backwards junk.
     if (start > end) {
         printf("Util_BuildStringFromChunk: Start position "
@@ -58,26 +51,154 @@ char* Util_BuildStringFromChunk(char* str, int start, int end)
         return "nil";
     }
 
-    // Fill a large char* with the chunk'd string.
-    char* bloaty_chunk = malloc(sizeof(char)*MAX_TEMP_STR_LEN);
+    char* chunk = malloc(sizeof(char)*(end - start + 1));
+    memcpy(chunk, &str[start], end - start);
+    chunk[end - start] = '\0';
+
+    return chunk;
+}
 
-    int ofs;
-    for (ofs = 0; ofs < end - start; ofs++) {
-        bloaty_chunk[ofs] = str[ofs + start];
-        bloaty_chunk[ofs + 1] = '\0';
+//
+// Util_SliceTrim
+// -----
+// Returns the slice without any leading or trailing
+// whitespace.
+//
+slice_t Util_SliceTrim(slice_t slice)
+{
+    while (slice.len > 0 && isspace((byte)slice.ptr[0])) {
+        slice.ptr++;
+        slice.len--;
     }
 
-    // Now that we have our messy string, let's have it
-    // occupy less memory.
-    char* real_chunk = malloc(sizeof(char)*(ofs + 1));
+    while (slice.len > 0 && isspace((byte)slice.ptr[slice.len - 1]))
+        slice.len--;
 
-    // Copy the data to the optimized char*.
-    for (int i = 0; i < ofs + 1; i++) {
-        real_chunk[i] = bloaty_chunk[i];
+    return slice;
+}
+
+bool Util_SliceEqualsNoCase(slice_t slice, const char* str)
+{
+    return strlen(str) == slice.len && strncasecmp(slice.ptr, str, slice.len) == 0;
+}
+
+//
+// Util_SliceToInt
+// -----
+// atoi() for slices: optional whitespace and sign, then
+// as many digits as there are.
+//
+int Util_SliceToInt(slice_t slice)
+{
+    slice = Util_SliceTrim(slice);
+
+    size_t i = 0;
+    bool negative = false;
+
+    if (i < slice.len && (slice.ptr[i] == '-' || slice.ptr[i] == '+')) {
+        negative = slice.ptr[i] == '-';
+        i++;
     }
 
-    // Free the bloaty one.
-    free(bloaty_chunk);
+    long value = 0;
+    for (; i < slice.len && slice.ptr[i] >= '0' && slice.ptr[i] <= '9'; i++) {
+        if (value < INT_MAX)
+            value = value * 10 + (slice.ptr[i] - '0');
+    }
 
-    return real_chunk;
-}
\ No newline at end of file
+    if (value > INT_MAX)
+        value = INT_MAX;
+
+    return negative ? -value : value;
+}
+
+//
+// Util_SliceToDouble
+// -----
+// strtod() for slices. Numbers are short, so copy it
+// somewhere we can terminate it.
+//
+double Util_SliceToDouble(slice_t slice)
+{
+    char number[64];
+    size_t len = slice.len < sizeof(number) - 1 ? slice.len : sizeof(number) - 1;
+
+    memcpy(number, slice.ptr, len);
+    number[len] = '\0';
+
+    return strtod(number, NULL);
+}
+
+//
+// Util_HashData
+// -----
+// A quick 64-bit hash of a whole buffer, eight bytes at a
+// time, for telling documents apart. Not meant to stand up
+// to anyone trying to make it collide.
+//
+uint64_t Util_HashData(const void* data, size_t len)
+{
+    const byte* bytes = data;
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (len * 0xC2B2AE3D27D4EB4FULL);
+    size_t i = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        uint64_t word;
+        memcpy(&word, &bytes[i], sizeof(word));
+
+        hash ^= word * 0x87C37B91114253D5ULL;
+        hash = (hash << 31) | (hash >> 33);
+        hash *= 0x4CF5AD432745937FULL;
+    }
+
+    uint64_t tail = 0;
+    for (size_t shift = 0; i < len; i++, shift += 8)
+        tail |= (uint64_t)bytes[i] << shift;
+
+    hash ^= tail * 0x87C37B91114253D5ULL;
+
+    // splitmix64's finalizer, so every input bit reaches
+    // every output bit.
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+
+    return hash;
+}
+
+//
+// Util_EncodeUTF8
+// -----
+// Writes a code point out as UTF-8 and returns how many
+// bytes that took, at most 4. The caller is expected to
+// have already replaced anything that isn't a valid
+// code point.
+//
+size_t Util_EncodeUTF8(uint32_t codepoint, char* out)
+{
+    if (codepoint < 0x80) {
+        out[0] = codepoint;
+        return 1;
+    }
+
+    if (codepoint < 0x800) {
+        out[0] = 0xC0 | (codepoint >> 6);
+        out[1] = 0x80 | (codepoint & 0x3F);
+        return 2;
+    }
+
+    if (codepoint < 0x10000) {
+        out[0] = 0xE0 | (codepoint >> 12);
+        out[1] = 0x80 | ((codepoint >> 6) & 0x3F);
+        out[2] = 0x80 | (codepoint & 0x3F);
+        return 3;
+    }
+
+    out[0] = 0xF0 | (codepoint >> 18);
+    out[1] = 0x80 | ((codepoint >> 12) & 0x3F);
+    out[2] = 0x80 | ((codepoint >> 6) & 0x3F);
+    out[3] = 0x80 | (codepoint & 0x3F);
+    return 4;
+}
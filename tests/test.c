@@ -0,0 +1,492 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <ctype.h>
+
+#include <html/html_parser.h>
+#include <html/html_attributeparser.h>
+
+#include "test.h"
+
+#define TEST_COUNT(a)   (sizeof(a) / sizeof((a)[0]))
+
+static int test_checks;
+static int test_failures;
+
+// Pieces the random documents are made of. They lean
+// towards the awkward cases: references, stray '<'s,
+// quotes left open, markup inside of raw text and so on.
+static const char* test_elements[] = {
+    "p", "div", "b", "i", "em", "span", "a", "font", "h1", "form", "table", "tr",
+    "td", "ul", "li", "br", "img", "input", "hr", "html", "head", "body", "select",
+    "option", "pre", "textarea", "title", "script", "style", "custom-el", "blink",
+};
+
+static const char* test_attributes[] = {
+    "class", "id", "href", "style", "title", "width", "height", "align", "bgcolor",
+    "checked", "color", "cols", "colspan", "rowspan", "border", "size", "type",
+    "lang", "dir", "nowrap", "coords", "charset", "accesskey", "content", "value",
+    "onclick", "data-x",
+};
+
+static const char* test_values[] = {
+    "a", "two words", "100", "50%", "*", "3*,2*", "#ff0000", "red", "x&amp;y",
+    "&lt;", "&#65;", "a=1&copy=2", "&notit;", "javascript:f(1)", "1,2,3,4",
+    "text/html; charset=utf-8", "", "it's", "a>b", "  spaced  out  ", "\xC3\xA9t\xC3\xA9",
+    "rtl", "x",
+};
+
+static const char* test_words[] = {
+    "hello", "world", "&amp;", "&lt;b&gt;", "&copy", "&notin;", "&notit;", "&#x263A;",
+    "&#128;", "&#0;", "&", "&ampx", "&#;", "a < b", "x<3", "<<", "<>", "< p>", "</>",
+    "\xC3\xA9", "\xE6\x97\xA5\xE6\x9C\xAC", "--", "->", "'", "\"", "=",
+};
+
+static const char* test_spaces[] = {
+    " ", " ", " ", "  ", "\n", "\n    ", "\t", " \n\n  ", "",
+};
+
+static const char* test_declarations[] = {
+    "<!DOCTYPE html>", "<!doctype HTML PUBLIC \"-//W3C//DTD HTML 4.01//EN\">",
+    "<?xml version=\"1.0\"?>", "<!x>", "<!>", "<!-->", "<!--->", "<!---->",
+    "<!-- a comment -->", "<!-- <p>not a tag</p> -->", "<!-- a -- b -- >-->",
+    "<!--\n  spread\n  out\n-->", "<!-- - ->",
+};
+
+static const char* test_raw_content[] = {
+    "", "x = 1;", "if (a < b) c = '</scr' + 'ipt>';", "<b>not a tag</b>",
+    "</scripts>", "</style x", "\n    indented\n    lines\n", "<!-- hidden -->",
+    "a &amp; b", "</textareas>",
+};
+
+static const char* test_raw_elements[] = {
+    "script", "style", "title", "textarea", "SCRIPT",
+};
+
+static const char* test_junk[] = {
+    "<", "< ", "</ >", "<a", "<p class=\"open", "=\"", ">", "<p class='x>", "</",
+    "<br/>", "<img src=x/>", "<p\n  class=\"a\"\n>", "<td nowrap>", "<a href=x>",
+};
+
+//
+// Test_Check
+// -----
+// Counts a check, printing the message if it didn't pass.
+// Returns whether it did.
+//
+bool Test_Check(bool passed, const char* format, ...)
+{
+    test_checks++;
+
+    if (passed)
+        return true;
+
+    test_failures++;
+
+    va_list args;
+    va_start(args, format);
+    printf("  FAIL: ");
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+
+    return false;
+}
+
+// Prints how a test program did, returns its exit code.
+int Test_Finish(const char* name)
+{
+    if (test_failures == 0)
+        printf("%s: %d checks passed\n", name, test_checks);
+    else
+        printf("%s: %d of %d checks failed\n", name, test_failures, test_checks);
+
+    return test_failures == 0 ? 0 : 1;
+}
+
+uint32_t Test_Random(uint32_t* seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return (*seed >> 8) & 0xFFFFFF;
+}
+
+static const char* Test_Pick(uint32_t* seed, const char** list, size_t count)
+{
+    return list[Test_Random(seed) % count];
+}
+
+//
+// Test_Append
+// -----
+// Adds text to the document being built, growing it as
+// needed. With mix_case set, letters come out in upper
+// case every so often.
+//
+static void Test_Append(char** doc, size_t* len, size_t* capacity, const char* text,
+                        uint32_t* seed, bool mix_case)
+{
+    size_t text_len = strlen(text);
+
+    while (*len + text_len + 1 > *capacity) {
+        *capacity *= 2;
+        *doc = realloc(*doc, *capacity);
+    }
+
+    for (size_t i = 0; i < text_len; i++) {
+        char c = text[i];
+
+        if (mix_case && Test_Random(seed) % 4 == 0)
+            c = toupper((unsigned char)c);
+
+        (*doc)[(*len)++] = c;
+    }
+
+    (*doc)[*len] = '\0';
+}
+
+static void Test_AppendStartTag(char** doc, size_t* len, size_t* capacity, uint32_t* seed,
+                                const char* name)
+{
+    Test_Append(doc, len, capacity, "<", seed, false);
+    Test_Append(doc, len, capacity, name, seed, true);
+
+    int attributes = Test_Random(seed) % 4;
+    for (int i = 0; i < attributes; i++) {
+        Test_Append(doc, len, capacity, Test_Random(seed) % 8 == 0 ? "\n  " : " ", seed, false);
+        Test_Append(doc, len, capacity, Test_Pick(seed, test_attributes, TEST_COUNT(test_attributes)),
+                    seed, true);
+
+        const char* value = Test_Pick(seed, test_values, TEST_COUNT(test_values));
+
+        switch (Test_Random(seed) % 5) {
+            case 0:
+                break;
+            case 1:
+                Test_Append(doc, len, capacity, "='", seed, false);
+                Test_Append(doc, len, capacity, value, seed, false);
+                Test_Append(doc, len, capacity, "'", seed, false);
+                break;
+            case 2:
+                // Unquoted, so only the first word of it.
+                Test_Append(doc, len, capacity, "=", seed, false);
+                Test_Append(doc, len, capacity, strchr(value, ' ') == NULL ? value : "x", seed, false);
+                break;
+            default:
+                Test_Append(doc, len, capacity, Test_Random(seed) % 2 ? "=\"" : " = \"", seed, false);
+                Test_Append(doc, len, capacity, value, seed, false);
+                Test_Append(doc, len, capacity, "\"", seed, false);
+                break;
+        }
+    }
+
+    Test_Append(doc, len, capacity, Test_Random(seed) % 10 == 0 ? " />" : ">", seed, false);
+}
+
+//
+// Test_BuildDocument
+// -----
+// Makes up a document of about target_size bytes from
+// the pieces above. The same seed always gives the same
+// document. It's rarely well formed, which is the point:
+// every way of parsing it has to agree anyway.
+//
+char* Test_BuildDocument(uint32_t seed, size_t target_size, size_t* out_length)
+{
+    size_t capacity = 4096;
+    size_t len = 0;
+    char* doc = malloc(capacity);
+
+    doc[0] = '\0';
+
+    while (len < target_size) {
+        uint32_t roll = Test_Random(&seed) % 100;
+
+        if (roll < 25) {
+            Test_AppendStartTag(&doc, &len, &capacity, &seed,
+                                Test_Pick(&seed, test_elements, TEST_COUNT(test_elements)));
+        } else if (roll < 42) {
+            Test_Append(&doc, &len, &capacity, "</", &seed, false);
+            Test_Append(&doc, &len, &capacity, Test_Pick(&seed, test_elements, TEST_COUNT(test_elements)),
+                        &seed, true);
+            Test_Append(&doc, &len, &capacity, Test_Random(&seed) % 8 == 0 ? " >" : ">", &seed, false);
+        } else if (roll < 72) {
+            int words = 1 + Test_Random(&seed) % 8;
+            for (int i = 0; i < words; i++) {
+                Test_Append(&doc, &len, &capacity, Test_Pick(&seed, test_words, TEST_COUNT(test_words)),
+                            &seed, false);
+                Test_Append(&doc, &len, &capacity, Test_Pick(&seed, test_spaces, TEST_COUNT(test_spaces)),
+                            &seed, false);
+            }
+        } else if (roll < 80) {
+            Test_Append(&doc, &len, &capacity,
+                        Test_Pick(&seed, test_declarations, TEST_COUNT(test_declarations)), &seed, false);
+        } else if (roll < 88) {
+            const char* name = Test_Pick(&seed, test_raw_elements, TEST_COUNT(test_raw_elements));
+
+            Test_AppendStartTag(&doc, &len, &capacity, &seed, name);
+            Test_Append(&doc, &len, &capacity,
+                        Test_Pick(&seed, test_raw_content, TEST_COUNT(test_raw_content)), &seed, false);
+
+            // Leave it open now and then, which swallows the
+            // rest of the document.
+            if (Test_Random(&seed) % 20 != 0) {
+                Test_Append(&doc, &len, &capacity, "</", &seed, false);
+                Test_Append(&doc, &len, &capacity, name, &seed, true);
+                Test_Append(&doc, &len, &capacity, Test_Random(&seed) % 4 == 0 ? " >" : ">", &seed, false);
+            }
+        } else if (roll < 93) {
+            Test_Append(&doc, &len, &capacity, "<pre>\n   two  spaces\n\tand a tab\n", &seed, false);
+            Test_Append(&doc, &len, &capacity, Test_Pick(&seed, test_spaces, TEST_COUNT(test_spaces)),
+                        &seed, false);
+            Test_Append(&doc, &len, &capacity, Test_Random(&seed) % 2 ? "<b> x  </b>  </pre>" : "</PRE>",
+                        &seed, false);
+        } else {
+            Test_Append(&doc, &len, &capacity, Test_Pick(&seed, test_junk, TEST_COUNT(test_junk)),
+                        &seed, false);
+        }
+    }
+
+    *out_length = len;
+    return doc;
+}
+
+// A NUL terminated copy of data, for parsers that change it.
+char* Test_CopyString(const char* data, size_t length)
+{
+    char* copy = malloc(length + 1);
+
+    memcpy(copy, data, length);
+    copy[length] = '\0';
+
+    return copy;
+}
+
+//
+// Test_ParseSerial
+// -----
+// The tree everything else is checked against: a copy of
+// data cleaned and parsed in one go. Free it with
+// Test_FreeSerial, which frees the copy too.
+//
+html_document_t* Test_ParseSerial(const char* data, size_t length)
+{
+    return HTML_BeginParse(Test_CopyString(data, length), length);
+}
+
+void Test_FreeSerial(html_document_t* document)
+{
+    char* source = document->source;
+
+    HTML_FreeDocument(document);
+    free(source);
+}
+
+//
+// Test_CompareNodes
+// -----
+// Checks what two nodes hold, leaving where they sit in
+// their trees to the caller.
+//
+static bool Test_CompareNodes(const uint64_t* text_attributes, html_document_t* expected_document,
+                                nodeid_t a, html_document_t* actual_document, nodeid_t b, size_t index,
+                                bool offsets)
+{
+    html_node_t* x = &expected_document->nodes[a];
+    html_node_t* y = &actual_document->nodes[b];
+
+    if (x->type != y->type || x->tag != y->tag) {
+        printf("  node %zu: type %d tag %d, expected type %d tag %d\n", index, y->type, y->tag,
+                x->type, x->tag);
+        return false;
+    }
+
+    uint32_t x_offset = HTML_NodeOffset(expected_document, a);
+    uint32_t y_offset = HTML_NodeOffset(actual_document, b);
+
+    if (offsets && x_offset != y_offset) {
+        printf("  node %zu: offset %u, expected %u\n", index, y_offset, x_offset);
+        return false;
+    }
+
+    if (x->type == HTML_NODE_TEXT) {
+        const char* x_text = HTML_NodeText(expected_document, a);
+        const char* y_text = HTML_NodeText(actual_document, b);
+
+        if (x->text_len != y->text_len || memcmp(x_text, y_text, x->text_len) != 0) {
+            printf("  node %zu: text \"%.*s\", expected \"%.*s\"\n", index, (int)y->text_len, y_text,
+                    (int)x->text_len, x_text);
+            return false;
+        }
+
+        return true;
+    }
+
+    if (x->type != HTML_NODE_ELEMENT)
+        return true;
+
+    attribute_t* x_attributes = HTML_NodeAttributes(expected_document, a);
+    attribute_t* y_attributes = HTML_NodeAttributes(actual_document, b);
+
+    int count = x_attributes != NULL ? x_attributes->count : 0;
+    if (count != (y_attributes != NULL ? y_attributes->count : 0)) {
+        printf("  node %zu: attribute count differs\n", index);
+        return false;
+    }
+
+    if (count == 0)
+        return true;
+
+    attrpair_t* expected = HTML_AttributePairs(x_attributes);
+    attrpair_t* actual = HTML_AttributePairs(y_attributes);
+
+    for (int i = 0; i < count; i++) {
+        if (expected[i].id != actual[i].id) {
+            printf("  node %zu: attribute %d is %s, expected %s\n", index, i,
+                    HTML_GetAttributeStringFromID(actual[i].id), HTML_GetAttributeStringFromID(expected[i].id));
+            return false;
+        }
+
+        byte id = expected[i].id;
+        if (!((text_attributes[id / 64] >> (id % 64)) & 1))
+            continue;
+
+        slice_t a = expected[i].value.text;
+        slice_t b = actual[i].value.text;
+
+        if (a.len != b.len || memcmp(a.ptr, b.ptr, a.len) != 0) {
+            printf("  node %zu: %s is \"%.*s\", expected \"%.*s\"\n", index,
+                    HTML_GetAttributeStringFromID(id), SLICE_ARGS(b), SLICE_ARGS(a));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//
+// Test_NextNode
+// -----
+// Steps to the next node in document order by following
+// the links, rather than going through the array, since
+// not every way of building a tree numbers the nodes the
+// same.
+//
+static nodeid_t Test_NextNode(html_document_t* document, nodeid_t id)
+{
+    html_node_t* nodes = document->nodes;
+
+    if (nodes[id].first_child != HTML_NODE_NONE)
+        return nodes[id].first_child;
+
+    while (id != HTML_NODE_NONE && nodes[id].next_sibling == HTML_NODE_NONE)
+        id = nodes[id].parent;
+
+    return id != HTML_NODE_NONE ? nodes[id].next_sibling : HTML_NODE_NONE;
+}
+
+// Where a link leads, as a position in document order.
+static size_t Test_LinkIndex(const size_t* index, nodeid_t id)
+{
+    return id == HTML_NODE_NONE ? SIZE_MAX : index[id];
+}
+
+//
+// Test_CompareTrees
+// -----
+// Walks both trees in document order and checks that they
+// hold the same nodes, linked up the same way. Offsets are
+// only compared if asked, as the streaming tokenizer's are
+// into its window. Prints the first difference found.
+//
+bool Test_CompareTrees(html_document_t* expected, html_document_t* actual, bool offsets)
+{
+    uint64_t text_attributes[(HTML_ATTR_COUNT + 63) / 64];
+    HTML_FindTextAttributes(text_attributes);
+
+    html_document_t* documents[2] = { expected, actual };
+    size_t* index[2];
+    nodeid_t* order[2];
+    size_t count = 0;
+
+    for (int d = 0; d < 2; d++) {
+        index[d] = malloc(sizeof(size_t) * documents[d]->node_count);
+        order[d] = malloc(sizeof(nodeid_t) * documents[d]->node_count);
+
+        for (uint32_t i = 0; i < documents[d]->node_count; i++)
+            index[d][i] = SIZE_MAX;
+    }
+
+    nodeid_t a = HTML_NODE_ROOT;
+    nodeid_t b = HTML_NODE_ROOT;
+    bool same = true;
+
+    while (same && (a != HTML_NODE_NONE || b != HTML_NODE_NONE)) {
+        if (a == HTML_NODE_NONE || b == HTML_NODE_NONE) {
+            printf("  node %zu: %s\n", count, a == HTML_NODE_NONE ? "is extra" : "is missing");
+            same = false;
+            break;
+        }
+
+        if (count >= expected->node_count || count >= actual->node_count ||
+            index[0][a] != SIZE_MAX || index[1][b] != SIZE_MAX) {
+            printf("  node %zu: links loop back around\n", count);
+            same = false;
+            break;
+        }
+
+        index[0][a] = count;
+        index[1][b] = count;
+        order[0][count] = a;
+        order[1][count] = b;
+
+        same = Test_CompareNodes(text_attributes, expected, a, actual, b, count, offsets);
+        count++;
+
+        a = Test_NextNode(expected, a);
+        b = Test_NextNode(actual, b);
+    }
+
+    // Now that every node has a position, check each one's
+    // links lead to the same places.
+    for (size_t i = 0; same && i < count; i++) {
+        html_node_t* x = &expected->nodes[order[0][i]];
+        html_node_t* y = &actual->nodes[order[1][i]];
+
+        same = Test_LinkIndex(index[0], x->parent) == Test_LinkIndex(index[1], y->parent) &&
+                Test_LinkIndex(index[0], x->first_child) == Test_LinkIndex(index[1], y->first_child) &&
+                Test_LinkIndex(index[0], x->last_child) == Test_LinkIndex(index[1], y->last_child) &&
+                Test_LinkIndex(index[0], x->next_sibling) == Test_LinkIndex(index[1], y->next_sibling);
+
+        if (!same)
+            printf("  node %zu: links differ\n", i);
+    }
+
+    if (same && Test_LinkIndex(index[0], expected->current) != Test_LinkIndex(index[1], actual->current)) {
+        printf("  current element differs\n");
+        same = false;
+    }
+
+    for (int d = 0; d < 2; d++) {
+        free(index[d]);
+        free(order[d]);
+    }
+
+    return same;
+}
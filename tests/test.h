@@ -0,0 +1,29 @@
+#ifndef _TEST_H_
+#define _TEST_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <html/html_document.h>
+
+//
+// Shared bits of the programs run by "make test". Each one
+// checks a way of building a tree (streaming, in parallel,
+// re-parsing, loading from the parse cache) against a plain
+// serial parse of the same document, or goes through a
+// table of cases, and exits non-zero if anything differs.
+//
+
+extern bool Test_Check(bool passed, const char* format, ...)
+    __attribute__((format(printf, 2, 3)));
+extern int Test_Finish(const char* name);
+
+extern uint32_t Test_Random(uint32_t* seed);
+extern char* Test_BuildDocument(uint32_t seed, size_t target_size, size_t* out_length);
+extern char* Test_CopyString(const char* data, size_t length);
+extern html_document_t* Test_ParseSerial(const char* data, size_t length);
+extern void Test_FreeSerial(html_document_t* document);
+extern bool Test_CompareTrees(html_document_t* expected, html_document_t* actual, bool offsets);
+
+#endif // _TEST_H_
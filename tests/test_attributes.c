@@ -0,0 +1,220 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <diag.h>
+#include <html/html_attributeparser.h>
+
+#include "test.h"
+
+//
+// Attribute values with more to them than a string: colors
+// in each of the ways pages write them, content types and
+// the charsets given with them, and what's kept of the ones
+// that can't be made sense of.
+//
+
+#define TEST_COUNT(a)   (sizeof(a) / sizeof((a)[0]))
+
+typedef struct {
+    const char*     input;
+    bool            used;       // False when it isn't a color, which is reported.
+    byte            r, g, b;
+} test_color_t;
+
+static const test_color_t test_colors[] = {
+    // Hex, short and long, with and without alpha.
+    { "#fff",                       true,   255, 255, 255 },
+    { "#FFF",                       true,   255, 255, 255 },
+    { "#abcd",                      true,   0xaa, 0xbb, 0xcc },
+    { "#aabbcc",                    true,   0xaa, 0xbb, 0xcc },
+    { "#AaBbCc",                    true,   0xaa, 0xbb, 0xcc },
+    { "#aabbccdd",                  true,   0xaa, 0xbb, 0xcc },
+    { "#12345",                     false,  0, 0, 0 },
+    { "#123456789",                 false,  0, 0, 0 },
+    { "#",                          false,  0, 0, 0 },
+    { "#ggg",                       false,  0, 0, 0 },
+    { "#12345g",                    false,  0, 0, 0 },
+
+    // Hex without the '#', only when 3 or 6 digits long.
+    { "fff",                        true,   255, 255, 255 },
+    { "aabbcc",                     true,   0xaa, 0xbb, 0xcc },
+    { "abcd",                       false,  0, 0, 0 },
+
+    // rgb(), percentages and clamping.
+    { "rgb(1,2,3)",                 true,   1, 2, 3 },
+    { "rgb( 1 , 2 , 3 )",           true,   1, 2, 3 },
+    { "rgb(1 2 3)",                 true,   1, 2, 3 },
+    { "RGB(1,2,3)",                 true,   1, 2, 3 },
+    { "rgb(300,-5,0)",              true,   255, 0, 0 },
+    { "rgb(100%,50%,0%)",           true,   255, 128, 0 },
+    { "rgb(150%,-10%,0)",           true,   255, 0, 0 },
+    { "rgb(1.4,1.6,+2)",            true,   1, 2, 2 },
+    { "rgba(1,2,3,0.5)",            true,   1, 2, 3 },
+    { "rgba(1,2,3,50%)",            true,   1, 2, 3 },
+    { "rgb(1 2 3 / 0.5)",           true,   1, 2, 3 },
+
+    // hsl(), with commas or spaces and a slash.
+    { "hsl(120,100%,50%)",          true,   0, 255, 0 },
+    { "hsl(0 100% 50%)",            true,   255, 0, 0 },
+    { "hsl(0 100% 50% / 0.5)",      true,   255, 0, 0 },
+    { "hsla(240,100%,50%,0.5)",     true,   0, 0, 255 },
+    { "hsl(-120,100%,50%)",         true,   0, 0, 255 },
+    { "hsl(480,100%,50%)",          true,   0, 255, 0 },
+    { "hsl(120deg,100%,50%)",       true,   0, 255, 0 },
+    { "hsl(240, 100%, 25%)",        true,   0, 0, 128 },
+    { "hsl(0,0%,50%)",              true,   128, 128, 128 },
+    { "hsl(0,200%,150%)",           true,   255, 255, 255 },
+
+    // Wrong numbers of arguments, or ones that aren't numbers.
+    { "rgb()",                      false,  0, 0, 0 },
+    { "rgb(1,2)",                   false,  0, 0, 0 },
+    { "rgb(1,2,3,4,5)",             false,  0, 0, 0 },
+    { "rgb(1,,2,3)",                false,  0, 0, 0 },
+    { "rgb(1,2,3,)",                false,  0, 0, 0 },
+    { "rgb(1,2,3 x)",               false,  0, 0, 0 },
+    { "rgb(a,b,c)",                 false,  0, 0, 0 },
+    { "rgb(1,2,3",                  false,  0, 0, 0 },
+    { "cmyk(1,2,3)",                false,  0, 0, 0 },
+    { "hsl(1,2)",                   false,  0, 0, 0 },
+
+    // Names, in any case and with space around them.
+    { "red",                        true,   255, 0, 0 },
+    { "RED",                        true,   255, 0, 0 },
+    { "  red  ",                    true,   255, 0, 0 },
+    { "\tNavy\n",                   true,   0, 0, 128 },
+    { "gray",                       true,   128, 128, 128 },
+    { "grey",                       true,   128, 128, 128 },
+    { "darkslategrey",              true,   47, 79, 79 },
+    { "fuchsia",                    true,   255, 0, 255 },
+    { "magenta",                    true,   255, 0, 255 },
+    { "notacolor",                  false,  0, 0, 0 },
+    { "re d",                       false,  0, 0, 0 },
+    { "",                           false,  0, 0, 0 },
+    { "   ",                        false,  0, 0, 0 },
+};
+
+typedef struct {
+    const char*     input;
+    int             type;
+    charsets_t      charset;
+    bool            reported;
+} test_contenttype_t;
+
+static const test_contenttype_t test_contenttypes[] = {
+    { "text/html",                                  CTYPE_TXT_HTML,     CS_NONE,        false },
+    { "TEXT/HTML",                                  CTYPE_TXT_HTML,     CS_NONE,        false },
+    { "  application/xhtml+xml  ",                  CTYPE_APP_XHTMLXML, CS_NONE,        false },
+    { "text/html; charset=utf-8",                   CTYPE_TXT_HTML,     CS_UTF8,        false },
+    { "Text/Html;CHARSET=UTF-8",                    CTYPE_TXT_HTML,     CS_UTF8,        false },
+    { "text/html ;charset=latin1",                  CTYPE_TXT_HTML,     CS_ISO8859,     false },
+    { "text/html; charset=\"ISO-8859-1\"",          CTYPE_TXT_HTML,     CS_ISO8859,     false },
+    { "text/html; charset='us-ascii'",              CTYPE_TXT_HTML,     CS_ASCII,       false },
+    { "text/html; charset= utf-8 ",                 CTYPE_TXT_HTML,     CS_UTF8,        false },
+    { "text/html; foo=bar; charset=windows-1252",   CTYPE_TXT_HTML,     CS_ANSI,        false },
+    { "text/html; charset=utf-8; foo=bar",          CTYPE_TXT_HTML,     CS_UTF8,        false },
+    { "text/css, text/html; charset=utf-8",         CTYPE_TXT_CSS,      CS_NONE,        false },
+
+    // A missing type is text/plain without a fuss.
+    { "",                                           CTYPE_TXT_PLAIN,    CS_NONE,        false },
+    { ";charset=utf-8",                             CTYPE_TXT_PLAIN,    CS_UTF8,        false },
+    { "  ; charset=cp1252",                         CTYPE_TXT_PLAIN,    CS_ANSI,        false },
+
+    // Types and charsets that nearly match aren't taken.
+    { "text/htmlx",                                 CTYPE_TXT_PLAIN,    CS_NONE,        true },
+    { "text/htm",                                   CTYPE_TXT_PLAIN,    CS_NONE,        true },
+    { "text / html",                                CTYPE_TXT_PLAIN,    CS_NONE,        true },
+    { "text/html; charset=bogus",                   CTYPE_TXT_HTML,     CS_NONE,        true },
+    { "text/html; charset=\"utf-8",                 CTYPE_TXT_HTML,     CS_NONE,        true },
+    { "text/html; charset=",                        CTYPE_TXT_HTML,     CS_NONE,        false },
+    { "text/html; charsets=utf-8",                  CTYPE_TXT_HTML,     CS_NONE,        false },
+};
+
+typedef struct {
+    const char*     input;
+    charsets_t      charset;
+    bool            reported;
+} test_charsets_t;
+
+static const test_charsets_t test_charsets[] = {
+    { "UTF-8",              CS_UTF8,        false },
+    { "utf8",               CS_UTF8,        false },
+    { " latin1 ",           CS_ISO8859,     false },
+    { "Windows-1252",       CS_ANSI,        false },
+    { "US-ASCII",           CS_ASCII,       false },
+
+    // Anything else is read as UTF-8.
+    { "bogus",              CS_UTF8,        true },
+    { "utf-88",             CS_UTF8,        true },
+    { "",                   CS_UTF8,        true },
+};
+
+static void Test_ParsingColors(void)
+{
+    for (size_t i = 0; i < TEST_COUNT(test_colors); i++) {
+        const test_color_t* test = &test_colors[i];
+        uint64_t reported = Diag_Count(DIAG_BAD_VALUE);
+        color_t color = HTML_ParseColorAttribute(Util_Slice(test->input, strlen(test->input)));
+
+        Test_Check(color.used == test->used, "\"%s\" %s a color", test->input,
+                    test->used ? "is" : "isn't");
+        Test_Check(color.r == test->r && color.g == test->g && color.b == test->b,
+                    "\"%s\" is %d,%d,%d, not %d,%d,%d", test->input, test->r, test->g, test->b,
+                    color.r, color.g, color.b);
+        Test_Check((Diag_Count(DIAG_BAD_VALUE) > reported) == !test->used,
+                    "\"%s\" %s reported", test->input, test->used ? "isn't" : "is");
+    }
+}
+
+static void Test_ParsingContentTypes(void)
+{
+    for (size_t i = 0; i < TEST_COUNT(test_contenttypes); i++) {
+        const test_contenttype_t* test = &test_contenttypes[i];
+        uint64_t reported = Diag_Count(DIAG_BAD_VALUE);
+        contenttype_t content_type = HTML_ParseContentTypesAttribute(Util_Slice(test->input, 
+                                        strlen(test->input)));
+
+        Test_Check(content_type.type == test->type && content_type.charset == test->charset,
+                    "\"%s\" is type %d with charset %d, not %d and %d", test->input, test->type,
+                    test->charset, content_type.type, content_type.charset);
+        Test_Check((Diag_Count(DIAG_BAD_VALUE) > reported) == test->reported,
+                    "\"%s\" %s reported", test->input, test->reported ? "is" : "isn't");
+    }
+
+    for (size_t i = 0; i < TEST_COUNT(test_charsets); i++) {
+        const test_charsets_t* test = &test_charsets[i];
+        uint64_t reported = Diag_Count(DIAG_BAD_VALUE);
+        charsets_t charset = HTML_ParseCharsetsAttribute(Util_Slice(test->input, strlen(test->input)));
+
+        Test_Check(charset == test->charset, "\"%s\" is charset %d, not %d", test->input,
+                    test->charset, charset);
+        Test_Check((Diag_Count(DIAG_BAD_VALUE) > reported) == test->reported,
+                    "\"%s\" %s reported", test->input, test->reported ? "is" : "isn't");
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Diag_SetSink(NULL, NULL);
+
+    Test_ParsingColors();
+    Test_ParsingContentTypes();
+
+    return Test_Finish("test_attributes");
+}
@@ -0,0 +1,294 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <dirent.h>
+
+#include <diag.h>
+#include <util.h>
+#include <html/html_parser.h>
+#include <html/html_cache.h>
+
+#include "test.h"
+
+//
+// Saves documents to the parse cache and loads them back,
+// checking the loaded tree against the one that was saved,
+// and that a loaded document can still be edited. Cache
+// files that were cut short or scribbled over have to be
+// turned away rather than loaded.
+//
+
+#define TEST_DOCUMENTS      12
+#define TEST_DOCUMENT_LEN   20000
+
+static char test_dir[] = "/tmp/pantomime-test-XXXXXX";
+
+static void Test_CachePath(char* path, size_t size, uint64_t hash)
+{
+    snprintf(path, size, "%s/%016llx.tree", test_dir, (unsigned long long)hash);
+}
+
+static html_document_t* Test_Load(uint64_t hash, size_t length)
+{
+    html_document_t* loaded = HTML_CreateDocument();
+
+    if (HTML_LoadCache(loaded, test_dir, hash, length))
+        return loaded;
+
+    HTML_FreeDocument(loaded);
+    return NULL;
+}
+
+static html_cacheheader_t Test_ReadHeader(uint64_t hash)
+{
+    html_cacheheader_t header;
+    char path[PATH_MAX];
+    FILE* file;
+
+    memset(&header, 0, sizeof(header));
+    Test_CachePath(path, sizeof(path), hash);
+
+    if ((file = fopen(path, "rb")) != NULL) {
+        if (fread(&header, sizeof(header), 1, file) != 1)
+            memset(&header, 0, sizeof(header));
+        fclose(file);
+    }
+
+    return header;
+}
+
+//
+// Test_EditLoaded
+// -----
+// Edits a document that came out of the cache, which has
+// to move it out of the mapping first.
+//
+static void Test_EditLoaded(html_document_t* loaded, const char* name)
+{
+    html_edit_t edit = { loaded->source_len / 2, 0, "<b class=\"new\">edited</b>", 25 };
+
+    if (!Test_Check(HTML_ReparseEdit(loaded, &edit), "%s loaded can be edited", name))
+        return;
+
+    html_document_t* parsed = HTML_CreateDocument();
+    char* copy = Test_CopyString(HTML_DocumentSource(loaded), loaded->source_len);
+
+    HTML_ParseMarkup(parsed, copy, loaded->source_len);
+    Test_Check(Test_CompareTrees(parsed, loaded, true), "%s loaded and edited", name);
+
+    HTML_FreeDocument(parsed);
+    free(copy);
+}
+
+//
+// Test_Corrupt
+// -----
+// Overwrites size bytes at offset in a cache file, or cuts
+// it off there if data is NULL, and checks it won't load.
+//
+static void Test_Corrupt(uint64_t hash, size_t length, long offset, const void* data, size_t size,
+                            const char* what)
+{
+    char path[PATH_MAX];
+    Test_CachePath(path, sizeof(path), hash);
+
+    FILE* file = fopen(path, "r+b");
+    if (!Test_Check(file != NULL, "cache file for %s is there", what))
+        return;
+
+    if (data != NULL) {
+        fseek(file, offset, SEEK_SET);
+        fwrite(data, 1, size, file);
+        fclose(file);
+    } else {
+        fclose(file);
+        Test_Check(truncate(path, offset) == 0, "cache file for %s cut short", what);
+    }
+
+    html_document_t* loaded = Test_Load(hash, length);
+    Test_Check(loaded == NULL, "cache file with %s is turned away", what);
+
+    if (loaded != NULL)
+        HTML_FreeDocument(loaded);
+}
+
+static void Test_CacheDocument(const char* data, size_t length, const char* name)
+{
+    html_document_t* serial = Test_ParseSerial(data, length);
+    uint64_t hash = Util_HashData(data, length);
+
+    if (!Test_Check(HTML_SaveCache(serial, test_dir, hash, length), "%s saves", name)) {
+        Test_FreeSerial(serial);
+        return;
+    }
+
+    html_document_t* loaded = Test_Load(hash, length);
+
+    if (Test_Check(loaded != NULL, "%s loads", name)) {
+        Test_Check(Test_CompareTrees(serial, loaded, true), "%s round trip", name);
+        Test_Check(HTML_NodesMapped(loaded), "%s is read in place", name);
+        Test_Check(loaded->source_len == serial->source_len &&
+                    memcmp(loaded->source, serial->source, serial->source_len) == 0,
+                    "%s source round trip", name);
+
+        Test_EditLoaded(loaded, name);
+        HTML_FreeDocument(loaded);
+    }
+
+    loaded = Test_Load(hash, length + 1);
+    Test_Check(loaded == NULL, "%s isn't loaded for a different length", name);
+    if (loaded != NULL)
+        HTML_FreeDocument(loaded);
+
+    Test_FreeSerial(serial);
+}
+
+//
+// Test_CorruptFiles
+// -----
+// Saves one document over and over, spoiling the file a
+// different way each time. Its nodes are the root, <p>,
+// "text ", <b> and "bold".
+//
+static void Test_CorruptFiles(void)
+{
+    const char* data = "<p class=\"a\" id=\"b\" title=\"c\">text <b>bold</b></p>";
+    size_t length = strlen(data);
+    uint64_t hash = Util_HashData(data, length);
+    html_document_t* serial = Test_ParseSerial(data, length);
+    uint32_t huge = 0x7FFFFFFF;
+    byte tag = HTML_ELEM_COUNT;
+    nodeid_t back = 2;
+
+    HTML_SaveCache(serial, test_dir, hash, length);
+    Test_Corrupt(hash, length, 0, "XXXXXXXX", 8, "a bad magic");
+
+    HTML_SaveCache(serial, test_dir, hash, length);
+    Test_Corrupt(hash, length, sizeof(html_cacheheader_t) / 2, NULL, 0, "its header cut off");
+
+    HTML_SaveCache(serial, test_dir, hash, length);
+    Test_Corrupt(hash, length, sizeof(html_cacheheader_t) + 8, NULL, 0, "its nodes cut off");
+
+    HTML_SaveCache(serial, test_dir, hash, length);
+    Test_Corrupt(hash, length, offsetof(html_cacheheader_t, node_count), &huge, sizeof(huge),
+                    "too many nodes");
+
+    HTML_SaveCache(serial, test_dir, hash, length);
+    uint64_t nodes = Test_ReadHeader(hash).nodes;
+
+    Test_Corrupt(hash, length, nodes + sizeof(html_node_t) * 3 + offsetof(html_node_t, tag), &tag, 
+                    sizeof(tag), "an unknown tag");
+
+    HTML_SaveCache(serial, test_dir, hash, length);
+    Test_Corrupt(hash, length, nodes + sizeof(html_node_t) * 3 + offsetof(html_node_t, next_sibling), &back,
+                    sizeof(back), "siblings that go around in a circle");
+
+    HTML_SaveCache(serial, test_dir, hash, length);
+    Test_Corrupt(hash, length, nodes + sizeof(html_node_t) * 1 + offsetof(html_node_t, parent), &back,
+                    sizeof(back), "a parent after its child");
+
+    // Attributes aren't looked at until they're used, and
+    // then damaged ones come out as none.
+    HTML_SaveCache(serial, test_dir, hash, length);
+    html_cacheheader_t header = Test_ReadHeader(hash);
+    char path[PATH_MAX];
+    byte count = 200;
+
+    Test_CachePath(path, sizeof(path), hash);
+    FILE* file = fopen(path, "r+b");
+
+    if (Test_Check(file != NULL, "cache file for damaged attributes is there")) {
+        fseek(file, header.attributes + offsetof(attribute_t, count), SEEK_SET);
+        fwrite(&count, 1, sizeof(count), file);
+        fclose(file);
+
+        uint64_t reported = Diag_Count(DIAG_CACHE);
+        html_document_t* loaded = Test_Load(hash, length);
+
+        if (Test_Check(loaded != NULL, "cache file with damaged attributes loads")) {
+            Test_Check(HTML_NodeAttributes(loaded, 1) == NULL && Diag_Count(DIAG_CACHE) > reported,
+                        "damaged attributes are reported and left off");
+            HTML_FreeDocument(loaded);
+        }
+    }
+
+    Test_FreeSerial(serial);
+}
+
+static void Test_RemoveDirectory(void)
+{
+    DIR* dir = opendir(test_dir);
+    struct dirent* entry;
+
+    while (dir != NULL && (entry = readdir(dir)) != NULL) {
+        char path[PATH_MAX];
+
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            continue;
+
+        snprintf(path, sizeof(path), "%s/%s", test_dir, entry->d_name);
+        unlink(path);
+    }
+
+    if (dir != NULL)
+        closedir(dir);
+
+    rmdir(test_dir);
+}
+
+int main(int argc, char *argv[])
+{
+    Diag_SetSink(NULL, NULL);
+
+    if (mkdtemp(test_dir) == NULL) {
+        printf("test_cache: could not make a directory for the cache\n");
+        return 1;
+    }
+
+    const char* cases[] = {
+        "",
+        "just text",
+        "<td class=a id=b width=1 height=2 align=left bgcolor=red nowrap title=\"t &amp; t\">x</td>",
+        "<p class=\"same\">a</p><p class=\"same\">b</p><p class=\"same\">c</p>",
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        char name[64];
+        snprintf(name, sizeof(name), "case %zu", i);
+        Test_CacheDocument(cases[i], strlen(cases[i]), name);
+    }
+
+    for (uint32_t seed = 1; seed <= TEST_DOCUMENTS; seed++) {
+        size_t length;
+        char* data = Test_BuildDocument(seed, TEST_DOCUMENT_LEN, &length);
+        char name[64];
+
+        snprintf(name, sizeof(name), "document %u", seed);
+        Test_CacheDocument(data, length, name);
+
+        free(data);
+    }
+
+    Test_CorruptFiles();
+    Test_RemoveDirectory();
+
+    return Test_Finish("test_cache");
+}
@@ -0,0 +1,196 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <diag.h>
+#include <html/html_charset.h>
+
+#include "test.h"
+
+//
+// The input stage: working out a document's charset from
+// its byte order mark or a <meta>, finding broken UTF-8,
+// and what comes out of repairing or transcoding it.
+//
+
+#define TEST_COUNT(a)   (sizeof(a) / sizeof((a)[0]))
+
+typedef struct {
+    const char*     input;
+    size_t          length;     // 0 to use strlen.
+    charsets_t      charset;
+    size_t          bom_len;
+} test_sniff_t;
+
+typedef struct {
+    const char*     input;
+    size_t          invalid;    // Where the first broken byte is, SIZE_MAX if none.
+} test_utf8_t;
+
+typedef struct {
+    const char*     input;
+    const char*     expected;
+    charsets_t      charset;
+    bool            in_place;   // Whether the input could be used where it was.
+} test_decode_t;
+
+static const test_sniff_t test_sniffs[] = {
+    { "\xEF\xBB\xBF<p>x</p>",                                   0,  CS_UTF8,    3 },
+    { "\xEF\xBB\xBF<meta charset=windows-1252>",                0,  CS_UTF8,    3 },
+    { "\xFE\xFF\x00<",                                          4,  CS_NONE,    0 },
+    { "\xFF\xFE<\x00",                                          4,  CS_NONE,    0 },
+    { "<p>no charset here</p>",                                 0,  CS_NONE,    0 },
+    { "<meta charset=\"utf-8\">",                               0,  CS_UTF8,    0 },
+    { "<meta charset=windows-1252>",                            0,  CS_ANSI,    0 },
+    { "<META CHARSET='ISO-8859-1'>",                            0,  CS_ISO8859, 0 },
+    { "<meta charset = \" utf8 \">",                            0,  CS_UTF8,    0 },
+    { "<meta/charset=cp1252>",                                  0,  CS_ANSI,    0 },
+    { "<meta http-equiv=\"Content-Type\" "
+        "content=\"text/html; charset=us-ascii\">",             0,  CS_ASCII,   0 },
+    { "<meta content=\"text/html; charset='latin1'\" "
+        "http-equiv=content-type>",                             0,  CS_ISO8859, 0 },
+    { "<meta content=\"text/html; charset=latin1\">",           0,  CS_NONE,    0 },
+    { "<meta charset=bogus><meta charset=ansi>",                0,  CS_ANSI,    0 },
+    { "<metadata charset=cp1252>",                              0,  CS_NONE,    0 },
+    { "<!-- <meta charset=cp1252> --><meta charset=utf-8>",     0,  CS_UTF8,    0 },
+    { "<!--><meta charset=cp1252>",                             0,  CS_ANSI,    0 },
+    { "<p title=\"<meta charset=cp1252>\"><meta charset=utf8>", 0,  CS_UTF8,    0 },
+    { "<?xml <meta charset=cp1252>?><meta charset=utf8>",       0,  CS_UTF8,    0 },
+};
+
+static const test_utf8_t test_utf8[] = {
+    { "plain ascii",                            SIZE_MAX },
+    { "caf\xC3\xA9",                            SIZE_MAX },
+    { "\xF0\x9F\x98\x80 ok \xE2\x82\xAC",       SIZE_MAX },
+    { "\xF4\x8F\xBF\xBF",                       SIZE_MAX },
+    { "\xC3",                                   0 },
+    { "ab\xC0\xAF",                             2 },
+    { "\xE0\x80\xAF",                           0 },
+    { "\xED\xA0\x80",                           0 },
+    { "\xF4\x90\x80\x80",                       0 },
+    { "\xF5\x80\x80\x80",                       0 },
+    { "x\x80",                                  1 },
+    { "\xC3\xA9\xFF",                           2 },
+    { "0123456789012345678901234567890123456789\xFE", 40 },
+    { "0123456789012345678901234567890123456789\xC3\xA9\xE2\x82", 42 },
+};
+
+static const test_decode_t test_decodes[] = {
+    { "plain",                                  "plain",                                CS_UTF8,    true },
+    { "caf\xC3\xA9",                            "caf\xC3\xA9",                          CS_UTF8,    true },
+    { "\xEF\xBB\xBFx\xC3\xA9",                  "x\xC3\xA9",                            CS_UTF8,    true },
+
+    // Said to be UTF-8 but isn't: each broken piece
+    // becomes one U+FFFD.
+    { "\xEF\xBB\xBF" "a\xC3" "b",               "a\xEF\xBF\xBD" "b",                    CS_UTF8,    false },
+    { "<meta charset=utf-8>a\xFF\xFE" "b",      "<meta charset=utf-8>a\xEF\xBF\xBD\xEF\xBF\xBD" "b",
+                                                                                        CS_UTF8,    false },
+    { "<meta charset=utf-8>x\xE2\x82",          "<meta charset=utf-8>x\xEF\xBF\xBD",    CS_UTF8,    false },
+    { "<meta charset=utf-8>\xE2\x82x",          "<meta charset=utf-8>\xEF\xBF\xBDx",    CS_UTF8,    false },
+    { "<meta charset=utf-8>\xED\xA0\x80!",      "<meta charset=utf-8>\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD!",
+                                                                                        CS_UTF8,    false },
+
+    // Not saying and not UTF-8 means Windows-1252.
+    { "caf\xE9 \x80",                           "caf\xC3\xA9 \xE2\x82\xAC",             CS_ANSI,    false },
+    { "<meta charset=iso-8859-1>\x93hi\x94",    "<meta charset=iso-8859-1>\xE2\x80\x9Chi\xE2\x80\x9D",
+                                                                                        CS_ISO8859, false },
+    { "<meta charset=windows-1252>\x81",        "<meta charset=windows-1252>\xC2\x81",  CS_ANSI,    false },
+    { "<meta charset=windows-1252>caf\xC3\xA9", "<meta charset=windows-1252>caf\xC3\x83\xC2\xA9",
+                                                                                        CS_ANSI,    false },
+    { "<meta charset=ascii>plain",              "<meta charset=ascii>plain",            CS_ASCII,   true },
+};
+
+static void Test_Sniffing(void)
+{
+    for (size_t i = 0; i < TEST_COUNT(test_sniffs); i++) {
+        const test_sniff_t* test = &test_sniffs[i];
+        size_t length = test->length != 0 ? test->length : strlen(test->input);
+        size_t bom_len;
+
+        charsets_t charset = HTML_SniffCharset(test->input, length, &bom_len);
+
+        Test_Check(charset == test->charset && bom_len == test->bom_len,
+                    "sniffing case %zu gives charset %d with a %zu byte mark, not %d and %zu", i,
+                    test->charset, test->bom_len, charset, bom_len);
+    }
+
+    // Only the start of the document is looked at.
+    char late[HTML_PRESCAN_LEN + 64];
+    memset(late, ' ', HTML_PRESCAN_LEN);
+    strcpy(&late[HTML_PRESCAN_LEN], "<meta charset=cp1252>");
+
+    size_t bom_len;
+    Test_Check(HTML_SniffCharset(late, strlen(late), &bom_len) == CS_NONE,
+                "a <meta> past the first %d bytes is ignored", HTML_PRESCAN_LEN);
+}
+
+static void Test_FindingInvalidUTF8(void)
+{
+    for (size_t i = 0; i < TEST_COUNT(test_utf8); i++) {
+        const test_utf8_t* test = &test_utf8[i];
+        size_t length = strlen(test->input);
+        size_t expected = test->invalid != SIZE_MAX ? test->invalid : length;
+        size_t invalid = HTML_FindInvalidUTF8(test->input, length, 0);
+
+        Test_Check(invalid == expected, "UTF-8 case %zu is broken at %zu, not %zu", i, expected, invalid);
+    }
+}
+
+static void Test_Decoding(void)
+{
+    for (size_t i = 0; i < TEST_COUNT(test_decodes); i++) {
+        const test_decode_t* test = &test_decodes[i];
+        size_t length = strlen(test->input);
+        size_t expected_len = strlen(test->expected);
+        char* data = Test_CopyString(test->input, length);
+        uint64_t reported = Diag_Count(DIAG_CHARSET);
+        html_input_t input;
+
+        HTML_DecodeInput(&input, data, length);
+
+        Test_Check(input.length == expected_len && memcmp(input.data, test->expected, expected_len) == 0 &&
+                    input.data[input.length] == '\0',
+                    "decoding case %zu gives \"%s\", not \"%.*s\"", i, test->expected,
+                    (int)input.length, input.data);
+        Test_Check(input.charset == test->charset, "decoding case %zu is charset %d, not %d", i,
+                    test->charset, input.charset);
+        Test_Check((input.buffer == NULL) == test->in_place, "decoding case %zu %s used in place", i,
+                    test->in_place ? "is" : "isn't");
+
+        // Anything that had to be fixed gets reported.
+        bool fixed = !test->in_place && test->charset == CS_UTF8;
+        bool guessed = !test->in_place && test->charset == CS_ANSI && strstr(test->input, "<meta") == NULL;
+        Test_Check((Diag_Count(DIAG_CHARSET) > reported) == (fixed || guessed),
+                    "decoding case %zu %s reported", i, fixed || guessed ? "is" : "isn't");
+
+        HTML_FreeInput(&input);
+        free(data);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Diag_SetSink(NULL, NULL);
+
+    Test_Sniffing();
+    Test_FindingInvalidUTF8();
+    Test_Decoding();
+
+    return Test_Finish("test_charset");
+}
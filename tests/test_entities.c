@@ -0,0 +1,133 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include <arena.h>
+#include <html/html_entities.h>
+
+#include "test.h"
+
+//
+// Character references, decoded as text and as attribute
+// values: longest match among the names, the legacy ones
+// that go without a ';', numeric references and the ones
+// that are out of range or stand for nothing.
+//
+
+typedef struct {
+    const char*     input;
+    bool            attribute;
+    const char*     expected;
+} test_reference_t;
+
+static const test_reference_t test_references[] = {
+    // Named, with and without the ';'.
+    { "&amp;",              false,  "&" },
+    { "&amp",               false,  "&" },
+    { "&AMP;",              false,  "&" },
+    { "&lt;b&gt;",          false,  "<b>" },
+    { "&nbsp;",             false,  "\xC2\xA0" },
+    { "a &copy; b",         false,  "a \xC2\xA9 b" },
+    { "&&amp;&",            false,  "&&&" },
+
+    // Longest match: "notin;" needs its ';', "not" doesn't.
+    { "&notin;",            false,  "\xE2\x88\x89" },
+    { "&notit;",            false,  "\xC2\xACit;" },
+    { "&notin",             false,  "\xC2\xACin" },
+    { "&not",               false,  "\xC2\xAC" },
+    { "&copysr;",           false,  "\xE2\x84\x97" },
+    { "&copysr",            false,  "\xC2\xA9sr" },
+
+    // Names that aren't references, or need a ';' they
+    // don't have.
+    { "&unknown;",          false,  "&unknown;" },
+    { "&notin_",            false,  "\xC2\xACin_" },
+    { "&copysr_",           false,  "\xC2\xA9sr_" },
+    { "&Amp;",              false,  "&Amp;" },
+    { "&;",                 false,  "&;" },
+    { "&",                  false,  "&" },
+    { "a & b",              false,  "a & b" },
+
+    // Ones that come out longer than they went in.
+    { "&nGt;",              false,  "\xE2\x89\xAB\xE2\x83\x92" },
+    { "&nGt;&nGt;x",        false,  "\xE2\x89\xAB\xE2\x83\x92\xE2\x89\xAB\xE2\x83\x92x" },
+    { "&NotNestedLessLess;", false, "\xE2\xAA\xA1\xCC\xB8" },
+
+    // Numeric.
+    { "&#65;",              false,  "A" },
+    { "&#65",               false,  "A" },
+    { "&#65x",              false,  "Ax" },
+    { "&#x41;",             false,  "A" },
+    { "&#X41",              false,  "A" },
+    { "&#x263A;",           false,  "\xE2\x98\xBA" },
+    { "&#128512;",          false,  "\xF0\x9F\x98\x80" },
+    { "&#;",                false,  "&#;" },
+    { "&#x;",               false,  "&#x;" },
+    { "&#xg;",              false,  "&#xg;" },
+
+    // Out of range, surrogates and Windows-1252.
+    { "&#0;",               false,  "\xEF\xBF\xBD" },
+    { "&#x110000;",         false,  "\xEF\xBF\xBD" },
+    { "&#99999999999999;",  false,  "\xEF\xBF\xBD" },
+    { "&#xD800;",           false,  "\xEF\xBF\xBD" },
+    { "&#128;",             false,  "\xE2\x82\xAC" },
+    { "&#x99;",             false,  "\xE2\x84\xA2" },
+    { "&#x81;",             false,  "\xC2\x81" },
+
+    // Attribute values leave legacy names alone when a
+    // letter, digit or '=' follows.
+    { "a=1&copy=2",         true,   "a=1&copy=2" },
+    { "&copyx",             true,   "&copyx" },
+    { "&copy9",             true,   "&copy9" },
+    { "&copy",              true,   "\xC2\xA9" },
+    { "&copy ",             true,   "\xC2\xA9 " },
+    { "&copy;x",            true,   "\xC2\xA9x" },
+    { "&notit",             true,   "&notit" },
+    { "&notin;",            true,   "\xE2\x88\x89" },
+    { "&amp;",              true,   "&" },
+    { "&#65x",              true,   "Ax" },
+    { "?a=1&amp;b=2",       true,   "?a=1&b=2" },
+};
+
+int main(int argc, char *argv[])
+{
+    arena_t* arena = Arena_Create(ARENA_BLOCK_LEN);
+
+    for (size_t i = 0; i < sizeof(test_references) / sizeof(test_references[0]); i++) {
+        const test_reference_t* test = &test_references[i];
+        size_t expected_len = strlen(test->expected);
+
+        for (int copy = 0; copy < 2; copy++) {
+            slice_t decoded = HTML_DecodeText(arena, test->input, strlen(test->input), copy,
+                                                test->attribute);
+
+            Test_Check(decoded.len == expected_len && memcmp(decoded.ptr, test->expected, expected_len) == 0,
+                        "\"%s\"%s decodes to \"%s\", not \"%.*s\"", test->input,
+                        test->attribute ? " in an attribute" : "", test->expected, SLICE_ARGS(decoded));
+        }
+    }
+
+    Test_Check(HTML_FindReference("no references", 13) == 13, "text without a '&' has no reference");
+    Test_Check(HTML_FindReference("0123456789abcdefghij&", 21) == 20, "'&' found past a vector's worth");
+
+    Arena_Destroy(arena);
+
+    return Test_Finish("test_entities");
+}
@@ -0,0 +1,260 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <diag.h>
+#include <html/html_attributeparser.h>
+
+#include "test.h"
+
+//
+// Lengths: reading them out of attribute values with each
+// unit, absolute ones turned into pixels, lists of them as
+// framesets use, and resolving relative ones against a
+// context, including the document's cache of the answers.
+//
+
+#define TEST_COUNT(a)   (sizeof(a) / sizeof((a)[0]))
+#define TEST_MAX_LENGTHS 3
+
+typedef struct {
+    const char*     input;
+    double          value;      // In units of type, before fixed point.
+    int             type;
+    bool            valid;
+} test_length_t;
+
+typedef struct {
+    const char*     input;
+    size_t          count;      // How many there are, which can be more than TEST_MAX_LENGTHS.
+    length_t        lengths[TEST_MAX_LENGTHS];
+} test_multilength_t;
+
+typedef struct {
+    const char*     input;
+    double          pixels;
+} test_resolve_t;
+
+#define FIXED(x)    ((int32_t)((x) * LENGTH_ONE))
+
+static const test_length_t test_lengths[] = {
+    // Signs and decimals.
+    { "10",             10,         LEN_PIXEL,      true },
+    { "+10",            10,         LEN_PIXEL,      true },
+    { "-10px",          -10,        LEN_PIXEL,      true },
+    { "1.5em",          1.5,        LEN_EM,         true },
+    { ".5em",           0.5,        LEN_EM,         true },
+    { "-0.25rem",       -0.25,      LEN_REM,        true },
+    { "2.",             2,          LEN_PIXEL,      true },
+    { "  12  ",         12,         LEN_PIXEL,      true },
+
+    // Each unit, absolute ones in pixels.
+    { "3px",            3,          LEN_PIXEL,      true },
+    { "3PX",            3,          LEN_PIXEL,      true },
+    { "50%",            50,         LEN_PERCENT,    true },
+    { "2*",             2,          LEN_RELATIVE,   true },
+    { "*",              1,          LEN_RELATIVE,   true },
+    { "2ex",            2,          LEN_EX,         true },
+    { "2ch",            2,          LEN_CH,         true },
+    { "2vw",            2,          LEN_VW,         true },
+    { "2vh",            2,          LEN_VH,         true },
+    { "2vmin",          2,          LEN_VMIN,       true },
+    { "2vmax",          2,          LEN_VMAX,       true },
+    { "1in",            96,         LEN_PIXEL,      true },
+    { "2.54cm",         96,         LEN_PIXEL,      true },
+    { "2.5cm",          2.5 * 96 / 2.54, LEN_PIXEL, true },
+    { "10mm",           10 * 96 / 25.4, LEN_PIXEL,  true },
+    { "4q",             96 / 25.4,  LEN_PIXEL,      true },
+    { "12pt",           16,         LEN_PIXEL,      true },
+    { "1pc",            16,         LEN_PIXEL,      true },
+
+    // Not lengths at all, which come out as 0px.
+    { "",               0,          LEN_PIXEL,      false },
+    { "abc",            0,          LEN_PIXEL,      false },
+    { "1e3",            0,          LEN_PIXEL,      false },
+    { "12 px",          0,          LEN_PIXEL,      false },
+    { "-",              0,          LEN_PIXEL,      false },
+    { "px",             0,          LEN_PIXEL,      false },
+    { "5furlongs",      0,          LEN_PIXEL,      false },
+};
+
+static const test_multilength_t test_multilengths[] = {
+    { "1*,2*,50%",      3,  { { FIXED(1), LEN_RELATIVE }, { FIXED(2), LEN_RELATIVE }, { FIXED(50), LEN_PERCENT } } },
+    { " 10 , 20px,*",   3,  { { FIXED(10), LEN_PIXEL }, { FIXED(20), LEN_PIXEL }, { FIXED(1), LEN_RELATIVE } } },
+    { "100",            1,  { { FIXED(100), LEN_PIXEL } } },
+    { "1,2,",           2,  { { FIXED(1), LEN_PIXEL }, { FIXED(2), LEN_PIXEL } } },
+    { "",               0,  { { 0 } } },
+
+    // More than there's room for are still counted.
+    { "1,2,3,4,5",      5,  { { FIXED(1), LEN_PIXEL }, { FIXED(2), LEN_PIXEL }, { FIXED(3), LEN_PIXEL } } },
+
+    // Counting stops at the first broken one.
+    { "1*,abc,3",       1,  { { FIXED(1), LEN_RELATIVE } } },
+    { "1,,2",           1,  { { FIXED(1), LEN_PIXEL } } },
+};
+
+// Against a 200px box with a 16px font, a 10px root font
+// and a 1000x500 viewport.
+static const lengthcontext_t test_context = { FIXED(200), FIXED(16), FIXED(10), FIXED(1000), FIXED(500) };
+
+static const test_resolve_t test_resolves[] = {
+    { "7px",        7 },
+    { "1in",        96 },
+    { "1.5em",      24 },
+    { "2ex",        16 },
+    { "2ch",        16 },
+    { "2rem",       20 },
+    { "50%",        100 },
+    { "-25%",       -50 },
+    { "2vw",        20 },
+    { "10vh",       50 },
+    { "10vmin",     50 },
+    { "10vmax",     100 },
+    { "3*",         0 },
+};
+
+static bool Test_SameLength(length_t a, length_t b)
+{
+    return a.value == b.value && a.type == b.type;
+}
+
+static void Test_ParsingLengths(void)
+{
+    for (size_t i = 0; i < TEST_COUNT(test_lengths); i++) {
+        const test_length_t* test = &test_lengths[i];
+        uint64_t reported = Diag_Count(DIAG_BAD_VALUE);
+        length_t length = HTML_ParseLengthAttribute(Util_Slice(test->input, strlen(test->input)));
+        double expected = test->value * LENGTH_ONE;
+
+        Test_Check(length.type == test->type && fabs(length.value - expected) <= 0.5,
+                    "\"%s\" is %g of type %d, not %g of type %d", test->input, test->value, test->type,
+                    (double)length.value / LENGTH_ONE, length.type);
+        Test_Check((Diag_Count(DIAG_BAD_VALUE) > reported) == !test->valid,
+                    "\"%s\" %s reported", test->input, test->valid ? "isn't" : "is");
+    }
+}
+
+static void Test_ParsingMultiLengths(void)
+{
+    for (size_t i = 0; i < TEST_COUNT(test_multilengths); i++) {
+        const test_multilength_t* test = &test_multilengths[i];
+        length_t lengths[TEST_MAX_LENGTHS + 1];
+        length_t untouched = { -1, LEN_VMAX };
+
+        for (size_t l = 0; l < TEST_MAX_LENGTHS + 1; l++)
+            lengths[l] = untouched;
+
+        size_t count = HTML_ParseMultiLengths(Util_Slice(test->input, strlen(test->input)), lengths,
+                                                TEST_MAX_LENGTHS);
+        size_t stored = count < TEST_MAX_LENGTHS ? count : TEST_MAX_LENGTHS;
+        bool same = count == test->count;
+
+        for (size_t l = 0; same && l < stored; l++)
+            same = Test_SameLength(lengths[l], test->lengths[l]);
+
+        Test_Check(same, "\"%s\" is %zu lengths as expected, got %zu", test->input, test->count, count);
+
+        for (size_t l = stored; l < TEST_MAX_LENGTHS + 1; l++)
+            Test_Check(Test_SameLength(lengths[l], untouched), "\"%s\" leaves length %zu alone",
+                        test->input, l);
+    }
+}
+
+static void Test_Resolving(html_document_t* document)
+{
+    for (size_t i = 0; i < TEST_COUNT(test_resolves); i++) {
+        const test_resolve_t* test = &test_resolves[i];
+        length_t length = HTML_ParseLengthAttribute(Util_Slice(test->input, strlen(test->input)));
+        int32_t resolved = HTML_ResolveLength(document, length, &test_context);
+
+        Test_Check(fabs(resolved - test->pixels * LENGTH_ONE) <= 1, "\"%s\" resolves to %gpx, not %gpx",
+                    test->input, test->pixels, (double)resolved / LENGTH_ONE);
+    }
+}
+
+//
+// Test_ResolvingCached
+// -----
+// Marks the cached answer for a length so a repeat lookup
+// can be told apart from working it out again. The same
+// length in a different context mustn't get that answer.
+//
+static void Test_ResolvingCached(html_document_t* document)
+{
+    length_t half = { FIXED(50), LEN_PERCENT };
+    lengthcontext_t wider = test_context;
+    int32_t marked = FIXED(12345);
+
+    wider.containing = FIXED(400);
+
+    Test_Check(HTML_ResolveLength(document, half, &test_context) == FIXED(100), "50%% of 200px is 100px");
+
+    html_resolvedlength_t* entry = NULL;
+    for (int i = 0; i < HTML_LENGTH_CACHE_LEN && document->lengths != NULL; i++) {
+        html_resolvedlength_t* slot = &document->lengths[i];
+
+        if (slot->used && Test_SameLength(slot->length, half) &&
+            memcmp(&slot->context, &test_context, sizeof(lengthcontext_t)) == 0)
+            entry = slot;
+    }
+
+    if (!Test_Check(entry != NULL, "resolved length is cached"))
+        return;
+
+    entry->resolved = marked;
+    Test_Check(HTML_ResolveLength(document, half, &test_context) == marked,
+                "repeat lookup is answered from the cache");
+
+    Test_Check(HTML_ResolveLength(document, half, &wider) == FIXED(200),
+                "50%% of 400px is 200px, not the cached answer for 200px");
+
+    int32_t again = HTML_ResolveLength(document, half, &test_context);
+    Test_Check(again == marked || again == FIXED(100), "50%% of 200px isn't the cached answer for 400px");
+
+    // Contexts differing only in the containing box, any of
+    // which could land in the same slot as one before it.
+    for (int32_t containing = 1; containing <= 64; containing++) {
+        lengthcontext_t context = test_context;
+        context.containing = FIXED(containing * 10);
+
+        if (context.containing == test_context.containing)
+            continue;
+
+        Test_Check(HTML_ResolveLength(document, half, &context) == FIXED(containing * 5),
+                    "50%% of %dpx is %dpx", containing * 10, containing * 5);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    Diag_SetSink(NULL, NULL);
+
+    Test_ParsingLengths();
+    Test_ParsingMultiLengths();
+
+    html_document_t* document = HTML_CreateDocument();
+
+    Test_Resolving(document);
+    Test_ResolvingCached(document);
+
+    HTML_FreeDocument(document);
+
+    return Test_Finish("test_length");
+}
@@ -0,0 +1,115 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <diag.h>
+#include <html/html_parser.h>
+
+#include "test.h"
+
+//
+// Parses documents big enough to be cut into chunks with
+// different numbers of threads, and checks each tree
+// against a serial parse. Besides the generated ones there
+// are documents where a comment, an attribute value or a
+// script runs across where the chunks get cut.
+//
+
+#define TEST_DOCUMENTS      6
+#define TEST_DOCUMENT_LEN   (HTML_PARALLEL_MIN_CHUNK * 8)
+
+static const int test_threads[] = { 2, 3, 8 };
+
+//
+// Test_BuildSpanningDocument
+// -----
+// Plain paragraphs, with what the chunk cutter would take
+// for tags hidden inside of one piece that goes on for half
+// the document.
+//
+static char* Test_BuildSpanningDocument(const char* open, const char* close, size_t* out_length)
+{
+    size_t length = TEST_DOCUMENT_LEN;
+    char* doc = malloc(length + 1);
+    size_t len = 0;
+
+    while (len < length / 4)
+        len += sprintf(&doc[len], "<p class=\"a\">some text</p>\n");
+
+    len += sprintf(&doc[len], "%s", open);
+    while (len < length * 3 / 4)
+        len += sprintf(&doc[len], "<div><p>fake</p></div>\n");
+    len += sprintf(&doc[len], "%s", close);
+
+    while (len + 64 < length)
+        len += sprintf(&doc[len], "<p>more <b>text</b></p>\n");
+
+    *out_length = len;
+    return doc;
+}
+
+static void Test_ParallelDocument(const char* data, size_t length, const char* name)
+{
+    html_document_t* serial = Test_ParseSerial(data, length);
+
+    for (size_t i = 0; i < sizeof(test_threads) / sizeof(test_threads[0]); i++) {
+        char* copy = Test_CopyString(data, length);
+        html_document_t* parallel = HTML_BeginParseParallel(copy, length, test_threads[i]);
+
+        Test_Check(Test_CompareTrees(serial, parallel, true), "%s with %d threads", name, test_threads[i]);
+
+        HTML_FreeDocument(parallel);
+        free(copy);
+    }
+
+    Test_FreeSerial(serial);
+}
+
+int main(int argc, char *argv[])
+{
+    const char* spans[][3] = {
+        { "comment", "<!-- ", " -->" },
+        { "attribute", "<p title=\"", "\">" },
+        { "script", "<script>", "</script>" },
+        { "unclosed script", "<script>", "" },
+    };
+
+    Diag_SetSink(NULL, NULL);
+
+    for (size_t i = 0; i < sizeof(spans) / sizeof(spans[0]); i++) {
+        size_t length;
+        char* data = Test_BuildSpanningDocument(spans[i][1], spans[i][2], &length);
+
+        Test_ParallelDocument(data, length, spans[i][0]);
+        free(data);
+    }
+
+    for (uint32_t seed = 1; seed <= TEST_DOCUMENTS; seed++) {
+        size_t length;
+        char* data = Test_BuildDocument(seed, TEST_DOCUMENT_LEN, &length);
+        char name[64];
+
+        snprintf(name, sizeof(name), "document %u", seed);
+        Test_ParallelDocument(data, length, name);
+
+        free(data);
+    }
+
+    return Test_Finish("test_parallel");
+}
@@ -0,0 +1,151 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <diag.h>
+#include <html/html_parser.h>
+
+#include "test.h"
+
+//
+// Makes random edits to documents, and after every one
+// checks the re-parsed tree against parsing the edited
+// source from scratch. Some edits land anywhere, others
+// follow on from the last one like typing does.
+//
+
+#define TEST_DOCUMENTS      8
+#define TEST_DOCUMENT_LEN   8000
+#define TEST_EDITS          300
+
+static const char* test_inserts[] = {
+    "", "x", "hello world", " ", "\n", "  ", "<b>", "</b>", "<p class=\"c1\">", "</p>",
+    "<div>", "</div>", "<!--", "-->", "\"", "'", ">", "<", "</", "<br>", "&amp;", "&",
+    "<span class=\"q\" id=\"z\">", "</span>", "<table><tr><td>", "</td></tr></table>",
+    "<script>", "</script>", "<pre>", "</pre>", "<textarea>", "<!DOCTYPE html>", "=",
+};
+
+//
+// Test_CopySource
+// -----
+// Copies the edited source out from either side of its
+// gap, leaving the gap where the last edit put it.
+//
+static char* Test_CopySource(html_document_t* document)
+{
+    size_t gap = document->source_gap_len != 0 ? document->source_gap : document->source_len;
+    char* copy = malloc(document->source_len + 1);
+
+    memcpy(copy, document->source, gap);
+    memcpy(&copy[gap], &document->source[gap + document->source_gap_len], document->source_len - gap);
+    copy[document->source_len] = '\0';
+
+    return copy;
+}
+
+//
+// Test_ApplyEdit
+// -----
+// Makes the edit and checks the tree against parsing the
+// edited source from scratch. It's already been cleaned
+// and edits aren't, so this skips the cleaning
+// HTML_BeginParse would do.
+//
+static bool Test_ApplyEdit(html_document_t* document, const html_edit_t* edit, uint32_t seed, int e)
+{
+    if (!Test_Check(HTML_ReparseEdit(document, edit), "document %u edit %d applies", seed, e))
+        return false;
+
+    html_document_t* parsed = HTML_CreateDocument();
+    char* copy = Test_CopySource(document);
+
+    HTML_ParseMarkup(parsed, copy, document->source_len);
+    bool same = Test_CompareTrees(parsed, document, true);
+
+    HTML_FreeDocument(parsed);
+    free(copy);
+
+    return Test_Check(same, "document %u after edit %d (%zu bytes at %zu for \"%.40s\")", seed, e,
+                        edit->removed, edit->offset, edit->text);
+}
+
+static void Test_EditDocument(uint32_t seed)
+{
+    size_t length;
+    char* data = Test_BuildDocument(seed, TEST_DOCUMENT_LEN, &length);
+    html_document_t* document = Test_ParseSerial(data, length);
+    char* original = document->source;
+    size_t offset = 0;
+    bool same = true;
+
+    for (int e = 0; same && e < TEST_EDITS; e++) {
+        size_t source_len = document->source_len;
+        html_edit_t edit;
+
+        // Half of the edits carry on where the last one left
+        // off, the rest go anywhere.
+        if (Test_Random(&seed) % 2 == 0 || offset > source_len)
+            offset = Test_Random(&seed) % (source_len + 1);
+
+        size_t room = source_len - offset;
+
+        edit.offset = offset;
+        edit.removed = Test_Random(&seed) % 3 == 0 ? Test_Random(&seed) % (room < 20 ? room + 1 : 20) : 0;
+        edit.text = test_inserts[Test_Random(&seed) % (sizeof(test_inserts) / sizeof(test_inserts[0]))];
+        edit.text_len = strlen(edit.text);
+
+        same = Test_ApplyEdit(document, &edit, seed, e);
+        offset += edit.text_len;
+    }
+
+    // Pasting in a whole other document adds more nodes in
+    // the middle than there's room for.
+    size_t pasted_len;
+    char* pasted = Test_BuildDocument(seed, TEST_DOCUMENT_LEN * 2, &pasted_len);
+    html_edit_t paste = { document->source_len / 2, 0, pasted, pasted_len };
+
+    if (same)
+        same = Test_ApplyEdit(document, &paste, seed, TEST_EDITS);
+
+    char* expected = Test_CopySource(document);
+    char* source = HTML_DocumentSource(document);
+
+    Test_Check(memcmp(source, expected, document->source_len + 1) == 0,
+                "document %u source comes out in one piece", seed);
+
+    // Out of range edits are turned away.
+    html_edit_t bad = { document->source_len + 1, 0, "x", 1 };
+    Test_Check(!HTML_ReparseEdit(document, &bad), "document %u edit past the end is refused", seed);
+
+    HTML_FreeDocument(document);
+    free(expected);
+    free(pasted);
+    free(original);
+    free(data);
+}
+
+int main(int argc, char *argv[])
+{
+    Diag_SetSink(NULL, NULL);
+
+    for (uint32_t seed = 1; seed <= TEST_DOCUMENTS; seed++)
+        Test_EditDocument(seed);
+
+    return Test_Finish("test_reparse");
+}
@@ -0,0 +1,120 @@
+//
+// Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+//
+// Permission to use, copy, modify, and/or distribute this software
+// for any purpose with or without fee is hereby granted.
+//
+// THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+// WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+// WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+// THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+// CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+// LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+// NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+// CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <diag.h>
+#include <html/html_parser.h>
+#include <html/html_tokenizer.h>
+
+#include "test.h"
+
+//
+// Feeds documents to the streaming tokenizer in chunks of
+// every size, from a byte at a time up, and checks each
+// tree against parsing the whole document at once.
+//
+
+#define TEST_DOCUMENTS      40
+#define TEST_DOCUMENT_LEN   6000
+
+// Sizes to cut documents up into. 0 stands for random
+// sizes, different for every chunk.
+static const size_t test_chunk_sizes[] = { 1, 2, 3, 5, 7, 13, 64, 4096, 0 };
+
+// Documents that end (or get cut) in awkward places.
+static const char* test_cases[] = {
+    "",
+    "plain text",
+    "  leading and trailing  ",
+    "<p>a\n    b\n\n   c</p>",
+    "<pre>\n  keep   this\n</pre>  but   not   this",
+    "<textarea>  </textarea><p>  </p>",
+    "<script>if (a < b) x = '</scr' + 'ipt>';</script>after",
+    "<script>never closed </scr",
+    "<style>a{}</style  ><title>t &amp; t</title>",
+    "<!-- never closed <p>",
+    "<!---->x<!-->y<!--->z-->",
+    "<p class=\"never closed>and more text",
+    "a &amp b &notit; c &#x263A &#128;&",
+    "<div><span>unclosed",
+    "text ending in <",
+    "text ending in </",
+};
+
+static html_document_t* Test_ParseStreaming(const char* data, size_t length, size_t chunk_size,
+                                            uint32_t seed)
+{
+    html_tokenizer_t* tok = HTML_TokenizerCreate();
+    char* copy = Test_CopyString(data, length);
+    size_t pos = 0;
+
+    while (pos < length) {
+        size_t size = chunk_size != 0 ? chunk_size : 1 + Test_Random(&seed) % 300;
+
+        if (size > length - pos)
+            size = length - pos;
+
+        HTML_TokenizerFeed(tok, &copy[pos], size);
+        pos += size;
+    }
+
+    free(copy);
+
+    return HTML_TokenizerFinish(tok);
+}
+
+static void Test_StreamDocument(const char* data, size_t length, const char* name)
+{
+    html_document_t* serial = Test_ParseSerial(data, length);
+
+    for (size_t i = 0; i < sizeof(test_chunk_sizes) / sizeof(test_chunk_sizes[0]); i++) {
+        html_document_t* streamed = Test_ParseStreaming(data, length, test_chunk_sizes[i], i);
+
+        Test_Check(Test_CompareTrees(serial, streamed, false), "%s in chunks of %zu", name,
+                    test_chunk_sizes[i]);
+
+        HTML_FreeDocument(streamed);
+    }
+
+    Test_FreeSerial(serial);
+}
+
+int main(int argc, char *argv[])
+{
+    Diag_SetSink(NULL, NULL);
+
+    for (size_t i = 0; i < sizeof(test_cases) / sizeof(test_cases[0]); i++) {
+        char name[64];
+        snprintf(name, sizeof(name), "case %zu", i);
+        Test_StreamDocument(test_cases[i], strlen(test_cases[i]), name);
+    }
+
+    for (uint32_t seed = 1; seed <= TEST_DOCUMENTS; seed++) {
+        size_t length;
+        char* data = Test_BuildDocument(seed, TEST_DOCUMENT_LEN, &length);
+        char name[64];
+
+        snprintf(name, sizeof(name), "document %u", seed);
+        Test_StreamDocument(data, length, name);
+
+        free(data);
+    }
+
+    return Test_Finish("test_stream");
+}
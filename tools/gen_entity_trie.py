@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose with or without fee is hereby granted.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+# WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+# THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+# CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+# LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+# NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+# CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+
+#
+# gen_entity_trie.py
+# -----
+# Builds the trie HTML_DecodeReferences() walks to match
+# named character references, and prints it as C source.
+#
+# Input is read from stdin, one entry per line:
+#
+#     name    codepoint [codepoint]
+#
+# Names are case sensitive and include the ';' if it has
+# one. Nodes are laid out breadth first, so the children of
+# a node sit next to each other, sorted by character. Chains
+# of nodes with nothing to choose between are folded into
+# one node with a tail of characters, which leaves about a
+# third as many nodes. Tails and values (as UTF-8) live in
+# pools of length-prefixed strings, so the whole thing is
+# small enough to stay in cache.
+#
+# Usage:
+#     tools/gen_entity_trie.py <prefix> <node type> < keys.txt
+#
+# Emits a header with <prefix>_nodes[], <prefix>_tails[] and
+# <prefix>_values[], along with <PREFIX>_NODES,
+# <PREFIX>_LONGEST and <PREFIX>_GROWS defines. The node type
+# has to be declared before the header is included. Run
+# "make tables" to regenerate it.
+#
+
+import sys
+
+
+def print_pool(name, pool):
+    # Octal escapes stop after three digits, so unlike hex
+    # ones they can't run into the character after them.
+    print("static const char %s[%d] =" % (name, len(pool)))
+    for i in range(0, len(pool), 16):
+        print('    "' + "".join("\\%03o" % b for b in pool[i:i + 16]) + '"')
+    print(";")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: gen_entity_trie.py <prefix> <node type> < keys.txt")
+
+    prefix, node_type = sys.argv[1], sys.argv[2]
+
+    entries = {}
+    for line in sys.stdin:
+        line = line.strip()
+        if not line or line.startswith('#'):
+            continue
+        parts = line.split()
+        name = parts[0]
+        if name in entries:
+            sys.exit("gen_entity_trie: duplicate name '%s'" % name)
+        text = "".join(chr(int(cp)) for cp in parts[1:]).encode("utf-8")
+        if len(text) > 7:
+            sys.exit("gen_entity_trie: value of '%s' is too long" % name)
+        entries[name] = text
+
+    # Build the trie as nested dicts first.
+    root = {}
+    for name in entries:
+        node = root
+        for c in name:
+            node = node.setdefault(c, {})
+        node[None] = name
+
+    # Runs of nodes with one child and no value of their own
+    # are folded into the node above them, their characters
+    # going into a tail that has to match in one piece.
+    def fold(char, node):
+        tail = ""
+        while None not in node and len(node) == 1:
+            c = next(iter(node))
+            tail += c
+            node = node[c]
+        return char, tail, node
+
+    tails = bytearray(b"\0")
+    tail_index = {b"": 0}
+    values = bytearray(b"\0")
+    value_index = {b"": 0}
+
+    def pooled(pool, index, data):
+        if data not in index:
+            if len(data) > 255:
+                sys.exit("gen_entity_trie: '%s' is too long" % data)
+            index[data] = len(pool)
+            pool.append(len(data))
+            pool.extend(data)
+        return index[data]
+
+    nodes = []
+    queue = [fold(None, root)]
+    head = 0
+    while head < len(queue):
+        char, tail, node = queue[head]
+        head += 1
+        children = sorted(c for c in node if c is not None)
+        if len(children) > 255:
+            sys.exit("gen_entity_trie: too many children")
+
+        value = 0
+        if None in node:
+            value = pooled(values, value_index, entries[node[None]])
+
+        first = len(queue) if children else 0
+        nodes.append((char, len(children), first, pooled(tails, tail_index, tail.encode()), value))
+        for c in children:
+            queue.append(fold(c, node[c]))
+
+    if len(nodes) > 0xFFFF or len(tails) > 0xFFFF or len(values) > 0xFFFF:
+        sys.exit("gen_entity_trie: trie is too big")
+
+    # References that decode to more bytes than they take
+    # up (counting the '&'), which can't be decoded in place.
+    grows = sum(1 for name, text in entries.items() if len(text) > len(name) + 1)
+
+    guard = "_%s_TRIE_H_" % prefix.upper()
+
+    print("#ifndef %s" % guard)
+    print("#define %s" % guard)
+    print()
+    print("// Generated by tools/gen_entity_trie.py, do not edit by hand.")
+    print("#define %s_NODES %d" % (prefix.upper(), len(nodes)))
+    print("#define %s_LONGEST %d" % (prefix.upper(), max(len(n) for n in entries)))
+    print("#define %s_GROWS %d" % (prefix.upper(), grows))
+    print()
+    print("static const %s %s_nodes[%s_NODES] = {" % (node_type, prefix, prefix.upper()))
+    for char, count, first, tail, value in nodes:
+        shown = "0" if char is None else "'%s'" % char
+        print("    { %s, %d, %d, %d, %d }," % (shown, count, first, tail, value))
+    print("};")
+    print()
+    print_pool("%s_tails" % prefix, tails)
+    print()
+    print_pool("%s_values" % prefix, values)
+    print()
+    print("#endif // %s" % guard)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2023 by Ivy Bowling <motolegacy.git@gmail.com>
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose with or without fee is hereby granted.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+# WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL
+# THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+# CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM
+# LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+# NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+# CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+
+#
+# gen_perfect_hash.py
+# -----
+# Builds a collision-free ("perfect") hash table for a fixed
+# set of case-insensitive keys, and prints it as C source for
+# use with Util_HashFold() and Util_HashSlot() from util.h.
+#
+# Input is read from stdin, one entry per line:
+#
+#     key    value [value...]
+#
+# The values are pasted into the table entry verbatim after
+# the key, so they can be anything the entry struct expects.
+#
+# Usage:
+#     tools/gen_perfect_hash.py <prefix> <entry type> < keys.txt
+#
+# Emits a header with <prefix>_displace[] and <prefix>_table[],
+# along with <PREFIX>_SLOTS and <PREFIX>_BUCKETS defines. The
+# entry type has to be declared before the header is included.
+# Run "make tables" to regenerate all of them.
+#
+
+import sys
+
+MASK = 0xFFFFFFFF
+
+
+def hash_fold(key):
+    # Must match Util_HashFold: FNV-1a over bytes OR'd with
+    # 0x20, which lowercases letters and leaves digits and
+    # most punctuation alone.
+    h = 0x811C9DC5
+    for c in key.encode():
+        h ^= c | 0x20
+        h = (h * 0x01000193) & MASK
+    return h
+
+
+def hash_slot(h, d, mask):
+    # Must match Util_HashSlot.
+    h = (h + d * 0x9E3779B9) & MASK
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK
+    h ^= h >> 16
+    return h & mask
+
+
+def next_pow2(n):
+    p = 1
+    while p < n:
+        p <<= 1
+    return p
+
+
+def build(keys):
+    slots = next_pow2(len(keys))
+    buckets = next_pow2(max(1, len(keys) // 2))
+
+    hashes = [hash_fold(k) for k in keys]
+    grouped = [[] for _ in range(buckets)]
+    for i, h in enumerate(hashes):
+        grouped[h & (buckets - 1)].append(i)
+
+    displace = [0] * buckets
+    taken = [None] * slots
+
+    # Place the biggest buckets first, they're the hardest.
+    for b in sorted(range(buckets), key=lambda b: -len(grouped[b])):
+        if not grouped[b]:
+            continue
+        for d in range(1, 1 << 16):
+            placed = [hash_slot(hashes[i], d, slots - 1) for i in grouped[b]]
+            if len(set(placed)) != len(placed):
+                continue
+            if any(taken[s] is not None for s in placed):
+                continue
+            for i, s in zip(grouped[b], placed):
+                taken[s] = i
+            displace[b] = d
+            break
+        else:
+            sys.exit("gen_perfect_hash: could not place bucket %d" % b)
+
+    return slots, buckets, displace, taken
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: gen_perfect_hash.py <prefix> <entry type> < keys.txt")
+
+    prefix, entry_type = sys.argv[1], sys.argv[2]
+
+    keys, values = [], []
+    for line in sys.stdin:
+        line = line.strip()
+        if not line or line.startswith('#'):
+            continue
+        parts = line.split(None, 1)
+        key = parts[0]
+        if any((ord(c) | 0x20) != ord(c) for c in key):
+            sys.exit("gen_perfect_hash: key '%s' does not survive folding" % key)
+        keys.append(key)
+        values.append(parts[1] if len(parts) > 1 else "")
+
+    if len(set(keys)) != len(keys):
+        sys.exit("gen_perfect_hash: duplicate keys")
+
+    slots, buckets, displace, taken = build(keys)
+
+    guard = "_%s_HASH_H_" % prefix.upper()
+
+    print("#ifndef %s" % guard)
+    print("#define %s" % guard)
+    print()
+    print("// Generated by tools/gen_perfect_hash.py, do not edit by hand.")
+    print("#define %s_SLOTS %d" % (prefix.upper(), slots))
+    print("#define %s_BUCKETS %d" % (prefix.upper(), buckets))
+    print()
+    print("static const unsigned short %s_displace[%s_BUCKETS] = {" % (prefix, prefix.upper()))
+    for i in range(0, buckets, 12):
+        print("    " + ", ".join(str(d) for d in displace[i:i + 12]) + ",")
+    print("};")
+    print()
+    print("static const %s %s_table[%s_SLOTS] = {" % (entry_type, prefix, prefix.upper()))
+    for s in range(slots):
+        i = taken[s]
+        if i is None:
+            print("    { NULL, 0 },")
+        else:
+            rest = (", " + values[i]) if values[i] else ""
+            print('    { "%s", %d%s },' % (keys[i], len(keys[i]), rest))
+    print("};")
+    print()
+    print("#endif // %s" % guard)
+
+
+if __name__ == "__main__":
+    main()